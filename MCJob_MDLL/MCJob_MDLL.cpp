@@ -2113,6 +2113,51 @@ int TMCJobWrapper::SetMainKMCOptions(long long MCSP, int MainRecordAnz)
 	}
 }
 
+// Konvergenzkriterium der Hauptsimulation eingeben
+int TMCJobWrapper::SetConvergenceOptions(double ConvTargetError, long long ConvMinMCSP)
+{
+	try
+	{
+		if (m_Job == NULL) return KMCERR_INVALID_POINTER;
+
+		return m_Job->SetConvergenceOptions(ConvTargetError, ConvMinMCSP);
+	}
+	catch (System::Exception^ e)
+	{
+		System::Console::WriteLine("{0} {1}", KMCERRSTR_STDERR, e); return KMCERR_EXCEPTION_OCCURED;
+	}
+}
+
+// Adaptive Normierung eingeben
+int TMCJobWrapper::SetAdaptiveNormalization(bool DoAdaptNorm, double AdaptNormBudget)
+{
+	try
+	{
+		if (m_Job == NULL) return KMCERR_INVALID_POINTER;
+
+		return m_Job->SetAdaptiveNormalization(DoAdaptNorm, AdaptNormBudget);
+	}
+	catch (System::Exception^ e)
+	{
+		System::Console::WriteLine("{0} {1}", KMCERRSTR_STDERR, e); return KMCERR_EXCEPTION_OCCURED;
+	}
+}
+
+// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie eingeben
+int TMCJobWrapper::SetObservablesOptions(long long ObsInterval, long long TrjInterval)
+{
+	try
+	{
+		if (m_Job == NULL) return KMCERR_INVALID_POINTER;
+
+		return m_Job->SetObservablesOptions(ObsInterval, TrjInterval);
+	}
+	catch (System::Exception^ e)
+	{
+		System::Console::WriteLine("{0} {1}", KMCERRSTR_STDERR, e); return KMCERR_EXCEPTION_OCCURED;
+	}
+}
+
 // Einstellungen abschlieen, d.h. Parameter validieren, Ready = true setzen
 int TMCJobWrapper::MakeSettings()
 {
@@ -2452,6 +2497,72 @@ int TMCJobWrapper::GetMainKMCOptions(long long% MCSP, int% MainRecordAnz)
 	}
 }
 
+// Konvergenzkriterium der Hauptsimulation ausgeben
+int TMCJobWrapper::GetConvergenceOptions(double% ConvTargetError, long long% ConvMinMCSP)
+{
+	try
+	{
+		if (m_Job == NULL) return KMCERR_INVALID_POINTER;
+
+		double U_ConvTargetError = ConvTargetError;
+		long long U_ConvMinMCSP = ConvMinMCSP;
+
+		int ErrorCode = m_Job->GetConvergenceOptions(U_ConvTargetError, U_ConvMinMCSP);
+
+		ConvTargetError = U_ConvTargetError;
+		ConvMinMCSP = U_ConvMinMCSP;
+		return ErrorCode;
+	}
+	catch (System::Exception^ e)
+	{
+		System::Console::WriteLine("{0} {1}", KMCERRSTR_STDERR, e); return KMCERR_EXCEPTION_OCCURED;
+	}
+}
+
+// Adaptive Normierung ausgeben
+int TMCJobWrapper::GetAdaptiveNormalization(bool% DoAdaptNorm, double% AdaptNormBudget)
+{
+	try
+	{
+		if (m_Job == NULL) return KMCERR_INVALID_POINTER;
+
+		bool U_DoAdaptNorm = DoAdaptNorm;
+		double U_AdaptNormBudget = AdaptNormBudget;
+
+		int ErrorCode = m_Job->GetAdaptiveNormalization(U_DoAdaptNorm, U_AdaptNormBudget);
+
+		DoAdaptNorm = U_DoAdaptNorm;
+		AdaptNormBudget = U_AdaptNormBudget;
+		return ErrorCode;
+	}
+	catch (System::Exception^ e)
+	{
+		System::Console::WriteLine("{0} {1}", KMCERRSTR_STDERR, e); return KMCERR_EXCEPTION_OCCURED;
+	}
+}
+
+// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie ausgeben
+int TMCJobWrapper::GetObservablesOptions(long long% ObsInterval, long long% TrjInterval)
+{
+	try
+	{
+		if (m_Job == NULL) return KMCERR_INVALID_POINTER;
+
+		long long U_ObsInterval = ObsInterval;
+		long long U_TrjInterval = TrjInterval;
+
+		int ErrorCode = m_Job->GetObservablesOptions(U_ObsInterval, U_TrjInterval);
+
+		ObsInterval = U_ObsInterval;
+		TrjInterval = U_TrjInterval;
+		return ErrorCode;
+	}
+	catch (System::Exception^ e)
+	{
+		System::Console::WriteLine("{0} {1}", KMCERRSTR_STDERR, e); return KMCERR_EXCEPTION_OCCURED;
+	}
+}
+
 // Beschreibung der Einstellungen in Konsole schreiben
 int TMCJobWrapper::WriteSettingsToConsole()
 {
@@ -2594,6 +2705,25 @@ int TMCJobWrapper::GetResultSummary(System::String^ ValDelimiter, System::String
 	}
 }
 
+// *********************************** //
+// -> Zeitprofil
+// *********************************** //
+
+// Zeitprofil der Job-Pipeline (Laufzeit, Aufrufe und Speicheraenderung je Bereich) in Konsole schreiben
+int TMCJobWrapper::WriteProfileToConsole()
+{
+	try
+	{
+		if (m_Job == NULL) return KMCERR_INVALID_POINTER;
+
+		return m_Job->WriteProfileToConsole();
+	}
+	catch (System::Exception^ e)
+	{
+		System::Console::WriteLine("{0} {1}", KMCERRSTR_STDERR, e); return KMCERR_EXCEPTION_OCCURED;
+	}
+}
+
 // **************************** PROTECTED ********************************** //
 
 // Allgemein zum Transfer zwischen unmanaged und managed Variablen:
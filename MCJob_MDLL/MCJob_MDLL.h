@@ -151,6 +151,9 @@ public:
 	int SetPrerunOptions(bool DoPrerun, long long PreMCSP, int PreRecordAnz);											// KMC-Vorlaufparameter einstellen
 	int SetDynNormParameters(bool DoDynNorm, long long DynNormAttemptAnz, int DynNormRecordAnz, int DynNormNum);		// Parameter fr dyn. Normierungssimulation setzen
 	int SetMainKMCOptions(long long MCSP, int MainRecordAnz);															// KMC-Hauptsimulationsparameter eingeben
+	int SetConvergenceOptions(double ConvTargetError, long long ConvMinMCSP);											// Konvergenzkriterium der Hauptsimulation eingeben
+	int SetAdaptiveNormalization(bool DoAdaptNorm, double AdaptNormBudget);												// Adaptive Normierung eingeben
+	int SetObservablesOptions(long long ObsInterval, long long TrjInterval);											// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie eingeben
 	int MakeSettings();																					// Einstellungen abschlieen, d.h. Parameter validieren, Ready = true setzen
 	int GetTemperature(double% Temperature);																// Temperatur ausgeben
 	int GetAttemptFrequency(double% Frequency);															// Sprungfrequenz ausgeben
@@ -167,6 +170,9 @@ public:
 	int GetPrerunOptions(bool% DoPrerun, long long% PreMCSP, int% PreRecordAnz);											// KMC-Vorlaufparameter ausgeben
 	int GetDynNormParameters(bool% DoDynNorm, long long% DynNormAttemptAnz, int% DynNormRecordAnz, int% DynNormNum);		// Parameter fr dyn. Normierungssimulation ausgeben
 	int GetMainKMCOptions(long long% MCSP, int% MainRecordAnz);															// KMC-Hauptsimulationsparameter ausgeben
+	int GetConvergenceOptions(double% ConvTargetError, long long% ConvMinMCSP);										// Konvergenzkriterium der Hauptsimulation ausgeben
+	int GetAdaptiveNormalization(bool% DoAdaptNorm, double% AdaptNormBudget);											// Adaptive Normierung ausgeben
+	int GetObservablesOptions(long long% ObsInterval, long long% TrjInterval);										// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie ausgeben
 	int WriteSettingsToConsole();											// Beschreibung der Einstellungen in Konsole schreiben
 
 	// -> Simulation
@@ -180,6 +186,9 @@ public:
 	int GetResultSummaryDesc(System::String^ ValDelimiter, System::String^% SummaryDesc);		// Beschreibung der GetResultSummary-Ausgabe ausgeben
 	int GetResultSummary(System::String^ ValDelimiter, System::String^% Summary);				// Wichtigste Einstellungen und Ergebnisse mit ValDelimiter getrennt ausgeben
 
+	// -> Zeitprofil
+	int WriteProfileToConsole();											// Zeitprofil der Job-Pipeline (Laufzeit, Aufrufe und Speicheraenderung je Bereich) in Konsole schreiben
+
 };
 
 #endif
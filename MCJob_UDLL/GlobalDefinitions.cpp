@@ -16,11 +16,14 @@
 
 // Includes:
 #include <sstream>
+#include <fstream>
+#include <charconv>
 
 // Windows-Includes
 #if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
 
 #include <Windows.h>
+#include <Psapi.h>
 
 #endif
 
@@ -29,6 +32,7 @@
 
 #include <limits.h>
 #include <unistd.h>
+#include <sys/resource.h>
 
 #endif
 
@@ -193,6 +197,46 @@ bool ConvStrToDouble(std::string input, double& val)
 	return true;
 }
 
+// Funktion zum Schreiben eines int in einen Stream (per to_chars, entspricht output << input)
+void WriteNumber(std::ostream& output, int input)
+{
+	char buffer[32];
+	std::to_chars_result res = std::to_chars(buffer, buffer + sizeof(buffer), input);
+	output.write(buffer, res.ptr - buffer);
+}
+
+// Funktion zum Schreiben eines long long in einen Stream (per to_chars, entspricht output << input)
+void WriteNumber(std::ostream& output, long long input)
+{
+	char buffer[32];
+	std::to_chars_result res = std::to_chars(buffer, buffer + sizeof(buffer), input);
+	output.write(buffer, res.ptr - buffer);
+}
+
+// Funktion zum Schreiben eines unsigned long long in einen Stream (per to_chars, entspricht output << input)
+void WriteNumber(std::ostream& output, unsigned long long input)
+{
+	char buffer[32];
+	std::to_chars_result res = std::to_chars(buffer, buffer + sizeof(buffer), input);
+	output.write(buffer, res.ptr - buffer);
+}
+
+// Funktion zum Schreiben eines double in einen Stream (per to_chars mit der Praezision des Streams, entspricht output << input im Standardformat)
+// (to_chars mit chars_format::general und Praezision ist wie printf("%.*g") definiert, d.h. wie die Standard-Stream-Ausgabe)
+void WriteNumber(std::ostream& output, double input)
+{
+	char buffer[64];
+	int precision = (int)output.precision();
+	if (precision > 40) precision = 40;
+	std::to_chars_result res = std::to_chars(buffer, buffer + sizeof(buffer), input, std::chars_format::general, precision);
+	if (res.ec != std::errc())
+	{
+		output << input;
+		return;
+	}
+	output.write(buffer, res.ptr - buffer);
+}
+
 /*
 // Test equality of two double values
 bool DoubleEqual(const double d1, const double d2) {
@@ -269,6 +313,22 @@ bool GetApplicationPath(std::string& out_str)
 	return true;
 }
 
+// Bisherigen Spitzenwert des Arbeitsspeicherverbrauchs des Prozesses in Bytes ermitteln (WINDOWS)
+long long GetPeakMemoryUsage()
+{
+	PROCESS_MEMORY_COUNTERS t_counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &t_counters, sizeof(t_counters)) == 0) return -1LL;
+	return (long long)t_counters.PeakWorkingSetSize;
+}
+
+// Aktuellen Arbeitsspeicherverbrauch des Prozesses in Bytes ermitteln (WINDOWS)
+long long GetCurrentMemoryUsage()
+{
+	PROCESS_MEMORY_COUNTERS t_counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &t_counters, sizeof(t_counters)) == 0) return -1LL;
+	return (long long)t_counters.WorkingSetSize;
+}
+
 // Prepend application path to relative file name (WINDOWS)
 std::string PrependAppPath(std::string_view rel_filename)
 {
@@ -300,6 +360,26 @@ bool GetApplicationPath(std::string& out_str)
 	return true;
 }
 
+// Bisherigen Spitzenwert des Arbeitsspeicherverbrauchs des Prozesses in Bytes ermitteln (LINUX)
+long long GetPeakMemoryUsage()
+{
+	struct rusage t_usage;
+	if (getrusage(RUSAGE_SELF, &t_usage) != 0) return -1LL;
+	return (long long)t_usage.ru_maxrss * 1024LL;		// ru_maxrss in kB
+}
+
+// Aktuellen Arbeitsspeicherverbrauch des Prozesses in Bytes ermitteln (LINUX)
+long long GetCurrentMemoryUsage()
+{
+	std::ifstream t_statm("/proc/self/statm");
+	long long t_size = 0LL;
+	long long t_resident = 0LL;
+	if ((t_statm >> t_size >> t_resident).fail() == true) return -1LL;
+	long t_pagesize = sysconf(_SC_PAGESIZE);
+	if (t_pagesize <= 0) return -1LL;
+	return t_resident * (long long)t_pagesize;		// statm in Seiten
+}
+
 // Prepend application path to relative file name (LINUX)
 std::string PrependAppPath(std::string_view rel_filename)
 {
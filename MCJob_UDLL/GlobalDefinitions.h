@@ -18,6 +18,7 @@
 #include <string>
 #include <string_view>
 #include <array>
+#include <iosfwd>
 
 using namespace std::literals;
 
@@ -47,8 +48,36 @@ using namespace std::literals;
 [[maybe_unused]] constexpr std::string_view KMCPATH_ELEMDESC = "ElementsDrawInfo.ini"sv;
 // Dateiendung fuer Checkpoint-Dateien
 [[maybe_unused]] constexpr std::string_view KMCPATH_CHK_EXT = ".mcp"sv;
+// Dateiendung fuer Log-Dateien (Batch-Modus von iConSimulator)
+[[maybe_unused]] constexpr std::string_view KMCPATH_LOG_EXT = ".log"sv;
+// Unterverzeichnis der Warteschlange fuer laufende Jobs (Worker-Modus von iConSimulator)
+[[maybe_unused]] constexpr std::string_view KMCPATH_QUEUE_RUNNING = "running"sv;
+// Unterverzeichnis der Warteschlange fuer abgeschlossene Jobs (Worker-Modus von iConSimulator)
+[[maybe_unused]] constexpr std::string_view KMCPATH_QUEUE_DONE = "done"sv;
+// Unterverzeichnis der Warteschlange fuer fehlgeschlagene Jobs (Worker-Modus von iConSimulator)
+[[maybe_unused]] constexpr std::string_view KMCPATH_QUEUE_FAILED = "failed"sv;
+// Dateiendung fuer Lock-Dateien laufender Jobs im Worker-Modus (Aenderungszeit = letztes Lebenszeichen des Workers)
+[[maybe_unused]] constexpr std::string_view KMCPATH_LOCK_EXT = ".lock"sv;
+// Dateiendung fuer die Observablen-Zeitreihe (ersetzt die Endung der Checkpoint-Datei)
+[[maybe_unused]] constexpr std::string_view KMCPATH_OBS_EXT = ".obs.csv"sv;
+// Dateiendung fuer die Gittertrajektorie (ersetzt die Endung der Checkpoint-Datei)
+[[maybe_unused]] constexpr std::string_view KMCPATH_TRJ_EXT = ".trj"sv;
+// Erkennungsstring am Anfang einer Trajektorien-Datei (Formatversion)
+[[maybe_unused]] constexpr std::string_view KMCPATH_TRJ_MAGIC = "iConTRJ1"sv;
 // Standard-Summary-Dateiname
 [[maybe_unused]] constexpr std::string_view KMCPATH_DEFAULT_SUMMARY = "Summary.csv"sv;
+// Standard-Dateiname fuer den Summary-Index (bereits ausgewertete Jobs fuer iConSearcher)
+[[maybe_unused]] constexpr std::string_view KMCPATH_DEFAULT_SUMMARYINDEX = "Summary.idx"sv;
+// Dateiendung fuer Sprungmodell-Cache-Dateien (Codierung eines UniqueJumps)
+[[maybe_unused]] constexpr std::string_view KMCPATH_MODELCACHE_EXT = ".ujc"sv;
+// Dateikennung und Formatversion der Sprungmodell-Cache-Dateien (bei Aenderung der Codierung erhoehen)
+[[maybe_unused]] constexpr std::string_view KMCPATH_MODELCACHE_MAGIC = "iConUJC1"sv;
+// Dateiendung und Dateikennung fuer Sprungmodell-Cache-Dateien der Gitterspruenge (TJumps)
+[[maybe_unused]] constexpr std::string_view KMCPATH_JUMPCACHE_EXT = ".jmc"sv;
+[[maybe_unused]] constexpr std::string_view KMCPATH_JUMPCACHE_MAGIC = "iConJMC1"sv;
+// Dateiendung und Dateikennung fuer Sprungmodell-Cache-Dateien der einzigartigen Spruenge (TUniqueJumps)
+[[maybe_unused]] constexpr std::string_view KMCPATH_UJUMPCACHE_EXT = ".ujm"sv;
+[[maybe_unused]] constexpr std::string_view KMCPATH_UJUMPCACHE_MAGIC = "iConUJM1"sv;
 
 // *************************** STANDARDWERTE *************************** //
 
@@ -110,8 +139,50 @@ using namespace std::literals;
 [[maybe_unused]] constexpr int KMCVAR_LATTICESIZE_INIT = 16;
 // Standard-MCSP
 [[maybe_unused]] constexpr long long KMCVAR_MCSP_INIT = 10000LL;
+// Standard-Zielfehler des Konvergenzkriteriums der Hauptsimulation (relativer Standardfehler, 0 = kein vorzeitiger Abbruch)
+[[maybe_unused]] constexpr double KMCVAR_CONVTARGET_INIT = 0.0;
+// Standard-Mindest-MCSP der Hauptsimulation vor einem vorzeitigen Abbruch durch das Konvergenzkriterium
+[[maybe_unused]] constexpr long long KMCVAR_CONVMINMCSP_INIT = 1000LL;
+// Maximale Blockanzahl der Blockmittelung (Konvergenzkriterium), bei Erreichen werden je zwei Bloecke zusammengefasst (gerade Zahl)
+[[maybe_unused]] constexpr int KMCVAR_CONV_MAXBLOCKS = 64;
+// Mindestanzahl an Bloecken fuer die Fehlerabschaetzung der Blockmittelung
+[[maybe_unused]] constexpr int KMCVAR_CONV_MINBLOCKS = 16;
+// Standard-Flag fuer adaptive Normierung waehrend Vorlauf und beginnender Hauptsimulation (ersetzt die DynNorm-Phase)
+[[maybe_unused]] constexpr bool KMCVAR_DOADAPTNORM_INIT = false;
+// Standard-Anteil an Sprungversuchen, deren normierte Wahrscheinlichkeit >= 1 sein darf (Overkill-Budget der adaptiven Normierung)
+[[maybe_unused]] constexpr double KMCVAR_ADAPTNORMBUDGET_INIT = 1.0E-4;
+// Anzahl der logarithmischen Histogramm-Bins der adaptiven Normierung (je Bin Faktor 2^(1/4) in der Wahrscheinlichkeit)
+[[maybe_unused]] constexpr int KMCVAR_ADAPTNORM_BINS = 256;
+// Mindestanzahl an Sprungversuchen im Overkill-Bereich (Budget * Versuche), bevor die Normierung angepasst wird
+[[maybe_unused]] constexpr double KMCVAR_ADAPTNORM_MINTAILCOUNT = 100.0;
+// Anteil der Ziel-MCSP der Hauptsimulation, waehrend dem die adaptive Normierung noch angepasst wird
+[[maybe_unused]] constexpr double KMCVAR_ADAPTNORM_MAINFRACTION = 0.1;
+// Standard-Intervall [MCSP] fuer die Aufzeichnung der Observablen-Zeitreihe der Hauptsimulation (0 = keine Aufzeichnung)
+[[maybe_unused]] constexpr long long KMCVAR_OBSINTERVAL_INIT = 0LL;
+// Kapazitaet des Ringpuffers zwischen Simulation und Schreib-Thread der Observablen-Zeitreihe (Anzahl Messpunkte)
+[[maybe_unused]] constexpr size_t KMCVAR_OBS_RINGSIZE = 4096;
+// Intervall [ms], in dem der Schreib-Thread der Observablen-Zeitreihe den Ringpuffer leert
+[[maybe_unused]] constexpr int KMCVAR_OBS_WRITEINTERVAL = 200;
+// Standard-Intervall [MCSP] fuer die Aufzeichnung der Gittertrajektorie der Hauptsimulation (0 = keine Aufzeichnung)
+[[maybe_unused]] constexpr long long KMCVAR_TRJINTERVAL_INIT = 0LL;
+// Anzahl an Trajektorien-Frames je vollstaendigem Gitterabbild (Keyframe), dazwischen nur Sprungaenderungen (Delta-Frames)
+[[maybe_unused]] constexpr int KMCVAR_TRJ_KEYFRAMEINTERVAL = 50;
+// Maximaler Speicher [Byte] der Trajektorien-Frames, die auf den Schreib-Thread warten (danach wartet die Simulation, ein Frame wird immer angenommen)
+[[maybe_unused]] constexpr size_t KMCVAR_TRJ_MAXQUEUEBYTES = 64ULL * 1024ULL * 1024ULL;
+// Intervall [ms], in dem der Telemetrie-Thread je laufender Simulation eine JSON-Zeile schreibt
+[[maybe_unused]] constexpr int KMCVAR_TELEMETRY_INTERVAL = 5000;
 // Double-Precision fr Jobspeicherung (min. 17 ist ntig, weil 17 signifikante Stellen (Mantisse) fuer die Unterscheidung aller double-Werte noetig sind, dadurch sind Wertvernderungen beim Speichern und Laden ausgeschlossen)
 [[maybe_unused]] constexpr int KMCVAR_SAVEFILE_DOUBLEPRECISION = 17;
+// Blockgroesse [Byte] fuer das gepufferte Schreiben von Job- und Checkpoint-Dateien
+[[maybe_unused]] constexpr size_t KMCVAR_SAVEFILE_BLOCKSIZE = 1048576;
+// Worker-Modus: Standard-Wartezeit [s] ohne neuen Job, nach der ein Worker-Thread beendet wird
+[[maybe_unused]] constexpr int KMCVAR_WORKER_IDLETIMEOUT_INIT = 300;
+// Worker-Modus: Intervall [s] fuer die Suche nach neuen Jobs in der Warteschlange
+[[maybe_unused]] constexpr int KMCVAR_WORKER_POLLINTERVAL = 10;
+// Worker-Modus: Intervall [s] fuer die Aktualisierung der Lock-Dateien laufender Jobs
+[[maybe_unused]] constexpr int KMCVAR_WORKER_HEARTBEATINTERVAL = 30;
+// Worker-Modus: Alter [s] einer Lock-Datei, ab dem der Worker als beendet gilt und der Job erneut eingereiht wird (z.B. nach Erreichen des Walltime-Limits)
+[[maybe_unused]] constexpr int KMCVAR_WORKER_STALETIMEOUT = 600;
 // ==-Threshold fuer Wahrscheinlichkeiten (plus-Multiplikator)
 [[maybe_unused]] constexpr double KMCVAR_EQTHRESHOLD_PROBPLUS = 1.0001;
 // ==-Threshold fuer Wahrscheinlichkeiten (minus-Multiplikator)
@@ -229,6 +300,14 @@ using namespace std::literals;
 [[maybe_unused]] constexpr int KMCVAL_TSETTINGS_MAX_NORMNUM = 10000;
 // Maximale MCSP fuer Hauptsimulation
 [[maybe_unused]] constexpr long long KMCVAL_TSETTINGS_MAX_MCSP = 5000000LL;
+// Obergrenze (exklusiv) fuer den Zielfehler des Konvergenzkriteriums
+[[maybe_unused]] constexpr double KMCVAL_TSETTINGS_MAX_CONVTARGET = 1.0;
+// Obergrenze (inklusiv) fuer das Overkill-Budget der adaptiven Normierung
+[[maybe_unused]] constexpr double KMCVAL_TSETTINGS_MAX_ADAPTNORMBUDGET = 0.01;
+// Obergrenze (inklusiv) fuer das Aufzeichnungsintervall der Observablen-Zeitreihe
+[[maybe_unused]] constexpr long long KMCVAL_TSETTINGS_MAX_OBSINTERVAL = KMCVAL_TSETTINGS_MAX_MCSP;
+// Obergrenze (inklusiv) fuer das Aufzeichnungsintervall der Gittertrajektorie
+[[maybe_unused]] constexpr long long KMCVAL_TSETTINGS_MAX_TRJINTERVAL = KMCVAL_TSETTINGS_MAX_MCSP;
 // Maximalanzahl fuer aufzuzeichnende Boltzmann-Wahrscheinlichkeiten bei Hauptsimulation
 [[maybe_unused]] constexpr int KMCVAL_TSETTINGS_MAX_RECORDANZ = 10000;
 
@@ -602,6 +681,18 @@ using namespace std::literals;
 [[maybe_unused]] constexpr std::string_view KMCOUT_TSETTINGS_MAINMCSP = "MCSP:"sv;
 // Bezeichner fuer Wahrscheinlichkeitsliste der Hauptsimulation
 [[maybe_unused]] constexpr std::array KMCOUT_TSETTINGS_MAINRECORDANZ = { "ProbabilityList:"sv, "Wahrscheinlichkeitsliste:"sv };
+// Bezeichner fuer Zielfehler des Konvergenzkriteriums der Hauptsimulation
+[[maybe_unused]] constexpr std::array KMCOUT_TSETTINGS_CONVTARGET = { "ConvergenceTarget:"sv, "Konvergenzziel:"sv };
+// Bezeichner fuer Mindest-MCSP des Konvergenzkriteriums der Hauptsimulation
+[[maybe_unused]] constexpr std::array KMCOUT_TSETTINGS_CONVMINMCSP = { "ConvergenceMinMCSP:"sv, "Konvergenz-MinMCSP:"sv };
+// Bezeichner fuer Flag der adaptiven Normierung
+[[maybe_unused]] constexpr std::array KMCOUT_TSETTINGS_DOADAPTNORM = { "AdaptiveNormalization:"sv, "Adaptive-Normierung:"sv };
+// Bezeichner fuer Overkill-Budget der adaptiven Normierung
+[[maybe_unused]] constexpr std::array KMCOUT_TSETTINGS_ADAPTNORMBUDGET = { "AdaptiveNorm-OverkillBudget:"sv, "Adaptive-Normierung-Overkillanteil:"sv };
+// Bezeichner fuer Aufzeichnungsintervall der Observablen-Zeitreihe
+[[maybe_unused]] constexpr std::array KMCOUT_TSETTINGS_OBSINTERVAL = { "ObservablesInterval:"sv, "Observablen-Intervall:"sv };
+// Bezeichner fuer Aufzeichnungsintervall der Gittertrajektorie
+[[maybe_unused]] constexpr std::array KMCOUT_TSETTINGS_TRJINTERVAL = { "TrajectoryInterval:"sv, "Trajektorien-Intervall:"sv };
 // Maximalanzahl an signifikanten Stellen von double-Variablen bei cout-Ausgabe von TSettings
 [[maybe_unused]] constexpr int KMCOUT_TSETTINGS_COUT_PRECISION = 6;
 
@@ -664,6 +755,10 @@ using namespace std::literals;
 [[maybe_unused]] constexpr std::array KMCOUT_TSIMPHASEINFO_MCSPROB_START = { "<JumpProbabilities>"sv, "<MCS-Wahrscheinlichkeiten>"sv };
 // Erkennungsstring fuer TSimPhaseInfo-Sprungwahrscheinlichkeiten-Ende
 [[maybe_unused]] constexpr std::array KMCOUT_TSIMPHASEINFO_MCSPROB_END = { "</JumpProbabilities>"sv, "</MCS-Wahrscheinlichkeiten>"sv };
+// Erkennungsstring fuer TSimPhaseInfo-Konvergenzbloecke-Start
+[[maybe_unused]] constexpr std::array KMCOUT_TSIMPHASEINFO_CONV_START = { "<ConvergenceBlocks>"sv, "<Konvergenzbloecke>"sv };
+// Erkennungsstring fuer TSimPhaseInfo-Konvergenzbloecke-Ende
+[[maybe_unused]] constexpr std::array KMCOUT_TSIMPHASEINFO_CONV_END = { "</ConvergenceBlocks>"sv, "</Konvergenzbloecke>"sv };
 
 // -- TResults ---
 // Erkennungsstring fuer TResults-Start
@@ -718,6 +813,22 @@ using namespace std::literals;
 [[maybe_unused]] constexpr std::string_view KMCOUT_TRESULTS_VAC_MEANSQUAREDDISP = "Vac-<x*x+y*y+z*z>:"sv;
 // Bezeichner fuer Schwerpunktverschiebungsvektor (Leerstellen)
 [[maybe_unused]] constexpr std::string_view KMCOUT_TRESULTS_VAC_COMDISPVEC = "Vac-(sum(x),sum(y),sum(z)):"sv;
+// Bezeichner fuer Abbruch durch das Konvergenzkriterium
+[[maybe_unused]] constexpr std::array KMCOUT_TRESULTS_CONVERGED = { "Converged:"sv, "Konvergiert:"sv };
+// Bezeichner fuer relativen Standardfehler der Leitfaehigkeit (Blockmittelung)
+[[maybe_unused]] constexpr std::array KMCOUT_TRESULTS_COND_RELERROR = { "Conductivity-RelStdError:"sv, "Leitfaehigkeit-Relativfehler:"sv };
+// Bezeichner fuer relativen Standardfehler der MSD-Rate (Blockmittelung)
+[[maybe_unused]] constexpr std::array KMCOUT_TRESULTS_MSD_RELERROR = { "MSD-RelStdError:"sv, "MSD-Relativfehler:"sv };
+// Bezeichner fuer Anzahl der Bloecke der Blockmittelung
+[[maybe_unused]] constexpr std::array KMCOUT_TRESULTS_CONVBLOCKCOUNT = { "ConvergenceBlocks:"sv, "Konvergenzbloecke:"sv };
+// Bezeichner fuer MCSP je Block der Blockmittelung
+[[maybe_unused]] constexpr std::array KMCOUT_TRESULTS_CONVBLOCKMCSP = { "ConvergenceBlockMCSP:"sv, "Konvergenzblock-MCSP:"sv };
+
+// --- Summary-Index (iConSearcher) ---
+// Kopfzeile des Summary-Index (gefolgt von der Programmversion)
+[[maybe_unused]] constexpr std::string_view KMCOUT_SUMMARYINDEX_HEADER = "iConSearcher-Index"sv;
+// Bezeichner fuer einen Job-Eintrag im Summary-Index (gefolgt vom relativen Pfad)
+[[maybe_unused]] constexpr std::string_view KMCOUT_SUMMARYINDEX_JOB = "<Job>"sv;
 
 // ************************ EXCEPTION-STRINGS ************************** //
 
@@ -801,6 +912,18 @@ bool ConvStrToUnsignedLongLong(std::string input, unsigned long long& val);
 // Funktion zur Umwandlung eines string in einen double
 bool ConvStrToDouble(std::string input, double& val);
 
+// Funktion zum Schreiben eines int in einen Stream (per to_chars, entspricht output << input)
+void WriteNumber(std::ostream& output, int input);
+
+// Funktion zum Schreiben eines long long in einen Stream (per to_chars, entspricht output << input)
+void WriteNumber(std::ostream& output, long long input);
+
+// Funktion zum Schreiben eines unsigned long long in einen Stream (per to_chars, entspricht output << input)
+void WriteNumber(std::ostream& output, unsigned long long input);
+
+// Funktion zum Schreiben eines double in einen Stream (per to_chars mit der Praezision des Streams, entspricht output << input im Standardformat)
+void WriteNumber(std::ostream& output, double input);
+
 /*
 // Test equality of two double values
 bool DoubleEqual(const double d1, const double d2);
@@ -830,4 +953,10 @@ bool GetApplicationPath(std::string& out_str);
 // Prepend application path to relative file name
 std::string PrependAppPath(std::string_view rel_filename);
 
+// Bisherigen Spitzenwert des Arbeitsspeicherverbrauchs des Prozesses in Bytes ermitteln (-1 = nicht verfuegbar)
+long long GetPeakMemoryUsage();
+
+// Aktuellen Arbeitsspeicherverbrauch des Prozesses in Bytes ermitteln (-1 = nicht verfuegbar)
+long long GetCurrentMemoryUsage();
+
 #endif
\ No newline at end of file
@@ -0,0 +1,142 @@
+// **************************************************************** //
+//																	//
+//	Class: T4DLattice												//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Flat container for the 4D lattice Lattice[x][y][z][s]			//
+//	  (s = stack of unit cell atoms), stored contiguously in the	//
+//	  same order as the simulation arrays (x, y, z, s),				//
+//	  memory from TSimAlloc (huge pages, first touch on filling)	//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef T4DLattice_H
+#define T4DLattice_H
+
+// Includes:
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <type_traits>
+
+// Eigene Includes:
+#include "TSimAlloc.h"
+
+using namespace std;
+
+// Klassendeklaration:
+template <typename T>
+class T4DLattice
+{
+	// Member variables
+protected:
+	int LatticeSize;				// Anzahl der Elementarzellen je Raumrichtung
+	int StackSize;					// Anzahl der Gitterplaetze je Elementarzelle
+	vector<T, TSimAllocator<T>> Data;	// Gitterplaetze, Index = ((x * LatticeSize + y) * LatticeSize + z) * StackSize + s
+
+	// Member functions
+public:
+	T4DLattice() : LatticeSize(0), StackSize(0)
+	{									// Default-Constructor (leeres Gitter)
+	}
+	T4DLattice(int i_LatticeSize, int i_StackSize, const T& i_Value = T())
+	{									// Constructor mit Initialisierung aller Gitterplaetze
+		Assign(i_LatticeSize, i_StackSize, i_Value);
+	}
+	void Assign(int i_LatticeSize, int i_StackSize, const T& i_Value = T())
+	{									// Gitter anlegen und alle Gitterplaetze mit i_Value fuellen
+		if ((i_LatticeSize <= 0) || (i_StackSize <= 0))
+		{
+			Clear();
+			return;
+		}
+		LatticeSize = i_LatticeSize;
+		StackSize = i_StackSize;
+		Data.assign((size_t)LatticeSize * LatticeSize * LatticeSize * StackSize, i_Value);
+	}
+	template <typename TAlloc>
+	bool Assign(int i_LatticeSize, int i_StackSize, vector<T, TAlloc>&& i_Data)
+	{									// Gitter aus linearem Vektor uebernehmen (false = Groesse passt nicht), anderer Allokator: Kopie in eigenen Speicher
+		if ((i_LatticeSize <= 0) || (i_StackSize <= 0)) return false;
+		if (i_Data.size() != (size_t)i_LatticeSize * i_LatticeSize * i_LatticeSize * i_StackSize) return false;
+		LatticeSize = i_LatticeSize;
+		StackSize = i_StackSize;
+		if constexpr (is_same<TAlloc, TSimAllocator<T>>::value == true)
+		{
+			Data = std::move(i_Data);
+		}
+		else
+		{
+			Data.assign(i_Data.begin(), i_Data.end());
+			vector<T, TAlloc>().swap(i_Data);
+		}
+		return true;
+	}
+	void Clear()
+	{									// Gitter leeren (incl. Speicherfreigabe)
+		LatticeSize = 0;
+		StackSize = 0;
+		vector<T, TSimAllocator<T>>().swap(Data);
+	}
+	bool IsEmpty() const
+	{									// true = kein Gitter vorhanden
+		return Data.empty();
+	}
+	bool HasShape(int i_LatticeSize, int i_StackSize) const
+	{									// true = Gitter hat die angegebenen Dimensionen
+		return ((LatticeSize == i_LatticeSize) && (StackSize == i_StackSize) && (Data.empty() == false));
+	}
+	int GetLatticeSize() const
+	{									// Anzahl der Elementarzellen je Raumrichtung
+		return LatticeSize;
+	}
+	int GetStackSize() const
+	{									// Anzahl der Gitterplaetze je Elementarzelle
+		return StackSize;
+	}
+	size_t GetCount() const
+	{									// Gesamtzahl der Gitterplaetze
+		return Data.size();
+	}
+	size_t Index(int x, int y, int z, int s) const
+	{									// linearer Index eines Gitterplatzes
+		return (((size_t)x * LatticeSize + y) * LatticeSize + z) * StackSize + s;
+	}
+	T& operator () (int x, int y, int z, int s)
+	{									// Zugriff auf Gitterplatz
+		return Data[Index(x, y, z, s)];
+	}
+	const T& operator () (int x, int y, int z, int s) const
+	{									// Zugriff auf Gitterplatz (const)
+		return Data[Index(x, y, z, s)];
+	}
+	T& operator [] (size_t i)
+	{									// Zugriff ueber linearen Index
+		return Data[i];
+	}
+	const T& operator [] (size_t i) const
+	{									// Zugriff ueber linearen Index (const)
+		return Data[i];
+	}
+	T* GetData()
+	{									// Zeiger auf zusammenhaengenden Speicher
+		return Data.data();
+	}
+	const T* GetData() const
+	{									// Zeiger auf zusammenhaengenden Speicher (const)
+		return Data.data();
+	}
+	void Swap(T4DLattice<T>& io_Other)
+	{									// Inhalt mit anderem Gitter tauschen (ohne Kopie)
+		std::swap(LatticeSize, io_Other.LatticeSize);
+		std::swap(StackSize, io_Other.StackSize);
+		Data.swap(io_Other.Data);
+	}
+
+};
+
+#endif
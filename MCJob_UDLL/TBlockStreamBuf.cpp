@@ -0,0 +1,104 @@
+// **************************************************************** //
+//																	//
+//	Class: TBlockStreamBuf											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Output stream buffer that collects the output in large		//
+//    blocks before writing it to a target stream buffer			//
+//    (flushes, e.g. by endl, do not cause single writes)			//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TBlockStreamBuf.h"
+
+// Includes:
+#include <cstring>
+#include <algorithm>
+
+// Eigene Includes:
+
+using namespace std;
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor, i_BlockSize = Blockgroesse in Byte
+TBlockStreamBuf::TBlockStreamBuf(streambuf* i_Target, size_t i_BlockSize)
+{
+	Target = i_Target;
+	Failed = (Target == NULL);
+	if (i_BlockSize < 1) i_BlockSize = 1;
+	Block.resize(i_BlockSize);
+	setp(Block.data(), Block.data() + Block.size());
+}
+
+// Destructor, schreibt den restlichen Block
+TBlockStreamBuf::~TBlockStreamBuf()
+{
+	Flush();
+}
+
+// ***************************** PUBLIC *********************************** //
+
+// Aktuellen Block in Target schreiben und Target synchronisieren (false = Schreibfehler)
+bool TBlockStreamBuf::Flush()
+{
+	if (WriteBlock() == false) return false;
+	if (Target->pubsync() != 0) Failed = true;
+	return !Failed;
+}
+
+// ***************************** PROTECTED ******************************** //
+
+// Block voll: Block schreiben und Zeichen anhaengen
+TBlockStreamBuf::int_type TBlockStreamBuf::overflow(int_type ch)
+{
+	if (WriteBlock() == false) return traits_type::eof();
+	if (traits_type::eq_int_type(ch, traits_type::eof()) == false)
+	{
+		*pptr() = traits_type::to_char_type(ch);
+		pbump(1);
+	}
+	return traits_type::not_eof(ch);
+}
+
+// Mehrere Zeichen anhaengen
+streamsize TBlockStreamBuf::xsputn(const char* s, streamsize n)
+{
+	streamsize written = 0;
+	while (written < n)
+	{
+		if (pptr() == epptr())
+		{
+			if (WriteBlock() == false) return written;
+		}
+		streamsize count = min(n - written, (streamsize)(epptr() - pptr()));
+		memcpy(pptr(), s + written, (size_t)count);
+		pbump((int)count);
+		written += count;
+	}
+	return written;
+}
+
+// Flush des Streams (z.B. durch endl) ignorieren, Schreiben erfolgt blockweise
+int TBlockStreamBuf::sync()
+{
+	return (Failed == true) ? -1 : 0;
+}
+
+// Aktuellen Block in Target schreiben (ohne Synchronisierung)
+bool TBlockStreamBuf::WriteBlock()
+{
+	if (Failed == true) return false;
+	streamsize count = (streamsize)(pptr() - pbase());
+	if (count > 0)
+	{
+		if (Target->sputn(pbase(), count) != count) Failed = true;
+	}
+	setp(Block.data(), Block.data() + Block.size());
+	return !Failed;
+}
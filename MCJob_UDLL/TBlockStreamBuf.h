@@ -0,0 +1,49 @@
+// **************************************************************** //
+//																	//
+//	Class: TBlockStreamBuf											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Output stream buffer that collects the output in large		//
+//    blocks before writing it to a target stream buffer			//
+//    (flushes, e.g. by endl, do not cause single writes)			//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TBlockStreamBuf_H
+#define TBlockStreamBuf_H
+
+// Includes:
+#include <streambuf>
+#include <vector>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TBlockStreamBuf : public streambuf
+{
+	// Member variables
+protected:
+	streambuf* Target;			// Ziel der Ausgabe (z.B. rdbuf() eines ofstream)
+	vector<char> Block;			// Puffer fuer den aktuellen Block
+	bool Failed;				// Flag, ob das Schreiben in Target fehlgeschlagen ist
+
+	// Member functions
+public:
+	TBlockStreamBuf(streambuf* i_Target, size_t i_BlockSize);		// Constructor, i_BlockSize = Blockgroesse in Byte
+	~TBlockStreamBuf();											// Destructor, schreibt den restlichen Block
+	bool Flush();													// Aktuellen Block in Target schreiben und Target synchronisieren (false = Schreibfehler)
+
+protected:
+	int_type overflow(int_type ch) override;					// Block voll: Block schreiben und Zeichen anhaengen
+	streamsize xsputn(const char* s, streamsize n) override;	// Mehrere Zeichen anhaengen
+	int sync() override;										// Flush des Streams (z.B. durch endl) ignorieren, Schreiben erfolgt blockweise
+	bool WriteBlock();											// Aktuellen Block in Target schreiben (ohne Synchronisierung)
+};
+
+#endif
@@ -0,0 +1,68 @@
+// **************************************************************** //
+//																	//
+//	Class: TCompensatedSum											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Compensated summation (Kahan-Babuska-Neumaier) of doubles,	//
+//	  used for the reductions over large lattices					//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TCompensatedSum_H
+#define TCompensatedSum_H
+
+// Includes:
+#include <cmath>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TCompensatedSum
+{
+	// Member variables
+protected:
+	double Sum;						// laufende Summe
+	double Compensation;			// aufgelaufene Rundungsfehler
+
+	// Member functions
+public:
+	TCompensatedSum() : Sum(0.0), Compensation(0.0)
+	{								// Default-Constructor (Summe = 0)
+	}
+	void Clear()
+	{								// Summe zuruecksetzen
+		Sum = 0.0;
+		Compensation = 0.0;
+	}
+	void Add(double i_Value)
+	{								// Wert addieren (Neumaier: Rundungsfehler auch fuer |i_Value| > |Sum| erfassen)
+		double t = Sum + i_Value;
+		if (fabs(Sum) >= fabs(i_Value))
+		{
+			Compensation += (Sum - t) + i_Value;
+		}
+		else
+		{
+			Compensation += (i_Value - t) + Sum;
+		}
+		Sum = t;
+	}
+	void Add(const TCompensatedSum& i_Other)
+	{								// Teilsumme addieren
+		Add(i_Other.Sum);
+		Compensation += i_Other.Compensation;
+	}
+	double GetSum() const
+	{								// kompensierte Summe ausgeben
+		return Sum + Compensation;
+	}
+
+};
+
+#endif
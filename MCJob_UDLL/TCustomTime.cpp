@@ -208,10 +208,13 @@ TCustomTime TCustomTime::GetCurrentTime(bool if_write_time)
 
 	if (if_write_time == true)
 	{
-		cout << setfill('0') << setw(2) << current_time.tm_mday << ".";
-		cout << setw(2) << current_time.tm_mon + 1 << "." << setw(4) << current_time.tm_year + 1900;
-		cout << " - " << setw(2) << current_time.tm_hour << ":" << setw(2) << current_time.tm_min << ":";
-		cout << setw(2) << current_time.tm_sec << setfill(' ');
+		// Formatierung in lokalem Stream (cout wird parallel von mehreren Jobs benutzt)
+		stringstream t_stream;
+		t_stream << setfill('0') << setw(2) << current_time.tm_mday << ".";
+		t_stream << setw(2) << current_time.tm_mon + 1 << "." << setw(4) << current_time.tm_year + 1900;
+		t_stream << " - " << setw(2) << current_time.tm_hour << ":" << setw(2) << current_time.tm_min << ":";
+		t_stream << setw(2) << current_time.tm_sec;
+		cout << t_stream.str();
 	}
 
 	return temp;
@@ -26,6 +26,7 @@
 #include "GlobalDefinitions.h"
 #include "TKMCJob/TKMCJob.h"
 #include "TElementsDesc.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -533,6 +534,7 @@ int TElementsBase::LoadFromStream(istream& input)
 	vector<string> i_Name;
 	vector<double> i_Charge;
 	string line = "";
+	TLineTokenizer linestream;
 	bool if_failed = false;
 	string s_temp = "";
 	int i_temp = 0;
@@ -546,12 +548,12 @@ int TElementsBase::LoadFromStream(istream& input)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TELEMENTS_ELEMENT)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -561,7 +563,7 @@ int TElementsBase::LoadFromStream(istream& input)
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -579,7 +581,7 @@ int TElementsBase::LoadFromStream(istream& input)
 			{
 				i_Symbol.push_back(s_temp);
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -597,7 +599,7 @@ int TElementsBase::LoadFromStream(istream& input)
 			{
 				i_Name.push_back(s_temp);
 			}
-			if ((linestream >> d_temp).fail() == true)
+			if (linestream.Next(d_temp) == false)
 			{
 				if_failed = true;
 				break;
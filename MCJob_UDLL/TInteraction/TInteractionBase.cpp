@@ -27,6 +27,7 @@
 #include "TKMCJob/TKMCJob.h"
 #include "TInteraction/TInteraction.h"
 #include "TStructure/TStructure.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -61,7 +62,7 @@ TInteractionBase::~TInteractionBase()
 // ***************************** PUBLIC *********************************** //
 
 // Interaction erstellen aus drei absoluten 4D-Koordinaten
-int TInteractionBase::MakeInteraction(T4DLatticeVector StartPos, T4DLatticeVector WWPos, T4DLatticeVector DestPos, int i_InteractionShellCount)
+int TInteractionBase::MakeInteraction(T4DLatticeVector StartPos, T4DLatticeVector WWPos, T4DLatticeVector DestPos, int i_InteractionShellCount, TInteractionCache* i_Cache)
 {
 	if (Ready != false)
 	{
@@ -135,73 +136,40 @@ int TInteractionBase::MakeInteraction(T4DLatticeVector StartPos, T4DLatticeVecto
 	}
 
 	// Schalenanalyse (StartPos->VacPos)
-	T3DVector ww_center = startvec + (wwvec - startvec) * 0.5;		// Analysenmitte setzen
-
-	vector<T4DLatticeVector> no_atoms;		// Liste mit nicht-beruecksichtigten Atomen definieren
-	no_atoms.push_back(StartPos);
-	no_atoms.push_back(WWPos);
-
-	vector<int> elem_ids;					// Liste mit erlaubten Elementen definieren
-	elem_ids.clear();						// leer = alle Elemente erlaubt
-
-	vector<T4DLatticeVector> out_atoms;		// Output-Liste mit absoluten Umgebungspositionen
-
 	int ErrorCode = KMCERR_OK;
-	ErrorCode = m_Job->m_Structure->NNAnalysis(ww_center, i_InteractionShellCount, &elem_ids, &no_atoms, &out_atoms);
+	vector<T3DVector> i_StartWWCoord;
+	vector<int> i_StartWWElemID;
+	ErrorCode = MakeWWShell(StartPos, WWPos, i_InteractionShellCount, &i_StartWWCoord, &i_StartWWElemID, i_Cache);
 	if (ErrorCode != KMCERR_OK)
 	{
 		cout << "Critical Error: NN Analysis 1 failed (in TUniqueJumpsBase::MakeInteraction)" << endl;
 		cout << "                Input: " << StartPos << " " << WWPos << " " << DestPos << " " << i_InteractionShellCount << endl << endl;
 		return ErrorCode;
 	}
-	if ((int)out_atoms.size() == 0)
+	if ((int)i_StartWWCoord.size() == 0)
 	{
 		cout << "Critical Error: No environment 1 shells found (in TUniqueJumpsBase::MakeInteraction)" << endl;
 		cout << "                Input: " << StartPos << " " << WWPos << " " << DestPos << " " << i_InteractionShellCount << endl << endl;
 		return KMCERR_NO_SHELLS_FOUND;
 	}
 
-	vector<T3DVector> i_StartWWCoord;
-	vector<int> i_StartWWElemID;
-	for (int i = 0; i < (int)out_atoms.size(); i++)
-	{				// 3D-Vektoren von Wechselwirkungsmittelpunkt zu Umgebungsatomen berechnen
-		i_StartWWCoord.push_back(m_Job->m_Structure->Get3DVector(out_atoms[i]) - ww_center);
-		i_StartWWElemID.push_back(m_Job->m_Structure->GetElemID(out_atoms[i].s));
-	}
-
 	// Schalenanalyse (DestPos->VacPos)
-	ww_center = destvec + (wwvec - destvec) * 0.5;		// Analysenmitte setzen
-
-	no_atoms.clear();		// Liste mit nicht-beruecksichtigten Atomen definieren
-	no_atoms.push_back(DestPos);
-	no_atoms.push_back(WWPos);
-
-	elem_ids.clear();		// Liste mit erlaubten Elementen definieren, leer = alle Elemente erlaubt
-
-	out_atoms.clear();		// Output-Liste mit absoluten Umgebungspositionen
-
-	ErrorCode = m_Job->m_Structure->NNAnalysis(ww_center, i_InteractionShellCount, &elem_ids, &no_atoms, &out_atoms);
+	vector<T3DVector> i_DestWWCoord;
+	vector<int> i_DestWWElemID;
+	ErrorCode = MakeWWShell(DestPos, WWPos, i_InteractionShellCount, &i_DestWWCoord, &i_DestWWElemID, i_Cache);
 	if (ErrorCode != KMCERR_OK)
 	{
 		cout << "Critical Error: NN Analysis 2 failed (in TUniqueJumpsBase::MakeInteraction)" << endl;
 		cout << "                Input: " << StartPos << " " << WWPos << " " << DestPos << " " << i_InteractionShellCount << endl << endl;
 		return ErrorCode;
 	}
-	if ((int)out_atoms.size() == 0)
+	if ((int)i_DestWWCoord.size() == 0)
 	{
 		cout << "Critical Error: No environment 2 shells found (in TUniqueJumpsBase::MakeInteraction)" << endl;
 		cout << "                Input: " << StartPos << " " << WWPos << " " << DestPos << " " << i_InteractionShellCount << endl << endl;
 		return KMCERR_NO_SHELLS_FOUND;
 	}
 
-	vector<T3DVector> i_DestWWCoord;
-	vector<int> i_DestWWElemID;
-	for (int i = 0; i < (int)out_atoms.size(); i++)
-	{		// 3D-Vektoren von Wechselwirkungsmittelpunkt zu Umgebungsatomen berechnen
-		i_DestWWCoord.push_back(m_Job->m_Structure->Get3DVector(out_atoms[i]) - ww_center);
-		i_DestWWElemID.push_back(m_Job->m_Structure->GetElemID(out_atoms[i].s));
-	}
-
 	// Normalenvektor berechnen (= Einheitsvektor senkrecht zur Ebene, die durch wwvec - startvec und wwvec - destvec aufgespannt wird),
 	// falls diese auf einer Geraden liegen, wird das erste Umgebungsatom mit y != 0 verwendet (s. UniqueJump)
 	// dieser Normalenvektor wird fuer beide Umgebungen verwendet, sodass eine spaetere gemeinsame Darstellung beider Umgebungen moeglich ist
@@ -704,6 +672,7 @@ int TInteractionBase::LoadFromStream(istream& input)
 	vector<int> i_DestWWElemID;
 
 	string line = "";
+	TLineTokenizer linestream;
 	bool if_failed = false;
 	string s_temp = "";
 	int i_temp = 0;
@@ -716,12 +685,12 @@ int TInteractionBase::LoadFromStream(istream& input)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TINTERACTION_STARTDIST)
 		{
-			if ((linestream >> i_StartDist).fail() == true)
+			if (linestream.Next(i_StartDist) == false)
 			{
 				if_failed = true;
 				break;
@@ -729,7 +698,7 @@ int TInteractionBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TINTERACTION_WWELEMID)
 		{
-			if ((linestream >> i_ElemID).fail() == true)
+			if (linestream.Next(i_ElemID) == false)
 			{
 				if_failed = true;
 				break;
@@ -737,7 +706,7 @@ int TInteractionBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TINTERACTION_DESTDIST)
 		{
-			if ((linestream >> i_DestDist).fail() == true)
+			if (linestream.Next(i_DestDist) == false)
 			{
 				if_failed = true;
 				break;
@@ -745,7 +714,7 @@ int TInteractionBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TINTERACTION_STARTWW)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -757,27 +726,27 @@ int TInteractionBase::LoadFromStream(istream& input)
 			}
 			i_StartWWElemID.push_back(-1);
 			i_StartWWCoord.push_back(T3DVector());
-			if ((linestream >> i_StartWWElemID.back()).fail() == true)
+			if (linestream.Next(i_StartWWElemID.back()) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_StartWWCoord.back().x).fail() == true)
+			if (linestream.Next(i_StartWWCoord.back().x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_StartWWCoord.back().y).fail() == true)
+			if (linestream.Next(i_StartWWCoord.back().y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_StartWWCoord.back().z).fail() == true)
+			if (linestream.Next(i_StartWWCoord.back().z) == false)
 			{
 				if_failed = true;
 				break;
@@ -785,7 +754,7 @@ int TInteractionBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TINTERACTION_DESTWW)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -797,27 +766,27 @@ int TInteractionBase::LoadFromStream(istream& input)
 			}
 			i_DestWWElemID.push_back(-1);
 			i_DestWWCoord.push_back(T3DVector());
-			if ((linestream >> i_DestWWElemID.back()).fail() == true)
+			if (linestream.Next(i_DestWWElemID.back()) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_DestWWCoord.back().x).fail() == true)
+			if (linestream.Next(i_DestWWCoord.back().x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_DestWWCoord.back().y).fail() == true)
+			if (linestream.Next(i_DestWWCoord.back().y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_DestWWCoord.back().z).fail() == true)
+			if (linestream.Next(i_DestWWCoord.back().z) == false)
 			{
 				if_failed = true;
 				break;
@@ -885,4 +854,74 @@ int TInteractionBase::LoadFromStream(istream& input)
 	return KMCERR_OK;
 }
 
-// ***************************** PRIVATE ********************************** //
\ No newline at end of file
+// ***************************** PRIVATE ********************************** //
+
+// Schalenanalyse um die Mitte von PairPos und WWPos (3D-Vektoren bzgl. Analysenmitte)
+// (Analyse ist verschiebungsinvariant, daher werden die Umgebungsatome bzgl. der Elementarzelle von PairPos in i_Cache wiederverwendet)
+int TInteractionBase::MakeWWShell(const T4DLatticeVector& PairPos, const T4DLatticeVector& WWPos, int i_InteractionShellCount,
+	vector<T3DVector>* o_Coord, vector<int>* o_ElemID, TInteractionCache* i_Cache)
+{
+	o_Coord->clear();
+	o_ElemID->clear();
+
+	T3DVector pairvec = m_Job->m_Structure->Get3DVector(PairPos);
+	T3DVector wwvec = m_Job->m_Structure->Get3DVector(WWPos);
+	T3DVector ww_center = pairvec + (wwvec - pairvec) * 0.5;		// Analysenmitte setzen
+	T4DLatticeVector pair_shift(PairPos.x, PairPos.y, PairPos.z, 0);	// Verschiebung der Elementarzelle von PairPos
+	T4DLatticeVector ww_rel = WWPos - pair_shift;					// WWPos bzgl. Elementarzelle von PairPos
+
+	// Zwischenspeicher pruefen, ansonsten Schalenanalyse durchfuehren
+	int ErrorCode = KMCERR_OK;
+	vector<T4DLatticeVector> out_atoms;		// Output-Liste mit Umgebungspositionen bzgl. Elementarzelle von PairPos
+	vector<T4DLatticeVector>* rel_atoms = &out_atoms;
+	if ((i_Cache != NULL) && (PairPos.s >= 0) && (PairPos.s < 1024) && (ww_rel.s >= 0) && (ww_rel.s < 1024) &&
+		(abs(ww_rel.x) < 8192) && (abs(ww_rel.y) < 8192) && (abs(ww_rel.z) < 8192))
+	{
+		unsigned long long cache_key = ((((unsigned long long)PairPos.s * 1024ULL + (unsigned long long)ww_rel.s) * 16384ULL + (unsigned long long)(ww_rel.x + 8192)) * 16384ULL +
+			(unsigned long long)(ww_rel.y + 8192)) * 16384ULL + (unsigned long long)(ww_rel.z + 8192);
+		auto cache_it = i_Cache->Shells.find(cache_key);
+		if (cache_it == i_Cache->Shells.end())
+		{
+			ErrorCode = MakeWWShellAtoms(PairPos, WWPos, i_InteractionShellCount, &out_atoms);
+			if (ErrorCode != KMCERR_OK) return ErrorCode;
+			cache_it = i_Cache->Shells.insert(make_pair(cache_key, out_atoms)).first;
+		}
+		rel_atoms = &cache_it->second;
+	}
+	else
+	{
+		ErrorCode = MakeWWShellAtoms(PairPos, WWPos, i_InteractionShellCount, &out_atoms);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+	}
+
+	for (int i = 0; i < (int)rel_atoms->size(); i++)
+	{				// 3D-Vektoren von Wechselwirkungsmittelpunkt zu Umgebungsatomen berechnen
+		o_Coord->push_back(m_Job->m_Structure->Get3DVector(rel_atoms->at(i) + pair_shift) - ww_center);
+		o_ElemID->push_back(m_Job->m_Structure->GetElemID(rel_atoms->at(i).s));
+	}
+
+	return KMCERR_OK;
+}
+
+// Umgebungsatome um die Mitte von PairPos und WWPos bzgl. der Elementarzelle von PairPos ermitteln
+int TInteractionBase::MakeWWShellAtoms(const T4DLatticeVector& PairPos, const T4DLatticeVector& WWPos, int i_InteractionShellCount, vector<T4DLatticeVector>* o_Atoms)
+{
+	T3DVector pairvec = m_Job->m_Structure->Get3DVector(PairPos);
+	T3DVector wwvec = m_Job->m_Structure->Get3DVector(WWPos);
+	T3DVector ww_center = pairvec + (wwvec - pairvec) * 0.5;		// Analysenmitte setzen
+
+	vector<T4DLatticeVector> no_atoms;		// Liste mit nicht-beruecksichtigten Atomen definieren
+	no_atoms.push_back(PairPos);
+	no_atoms.push_back(WWPos);
+
+	vector<int> elem_ids;					// Liste mit erlaubten Elementen definieren, leer = alle Elemente erlaubt
+
+	int ErrorCode = m_Job->m_Structure->NNAnalysis(ww_center, i_InteractionShellCount, &elem_ids, &no_atoms, o_Atoms);
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+	// Umgebungsatome auf Elementarzelle von PairPos beziehen
+	T4DLatticeVector pair_shift(PairPos.x, PairPos.y, PairPos.z, 0);
+	for (int i = 0; i < (int)o_Atoms->size(); i++) o_Atoms->at(i) = o_Atoms->at(i) - pair_shift;
+
+	return KMCERR_OK;
+}
\ No newline at end of file
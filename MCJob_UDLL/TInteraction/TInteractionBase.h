@@ -20,6 +20,7 @@
 // Includes:
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 // Eigene Includes:
 #include "T3DVector.h"
@@ -31,6 +32,13 @@ using namespace std;
 class TKMCJob;
 class TInteraction;
 
+// Zwischenspeicher fuer das Erstellen und Vergleichen von Interactions (gemeinsam fuer alle UniqueJumps, bei gleicher InteractionShellCount)
+struct TInteractionCache
+{
+	unordered_map<unsigned long long, vector<int>> Index;								// Suchindex: Schluessel aus ElemID, StartDist und DestDist -> Indizes der Interactions
+	unordered_map<unsigned long long, vector<T4DLatticeVector>> Shells;				// Schalenanalysen: Schluessel aus Paaratom und rel. WW-Atom -> Umgebungsatome bzgl. Elementarzelle des Paaratoms
+};
+
 // Klassendeklaration:
 class TInteractionBase
 {
@@ -51,7 +59,8 @@ protected:
 	// Member functions
 public:
 	// NON-PUBLISHED
-	int MakeInteraction(T4DLatticeVector StartPos, T4DLatticeVector WWPos, T4DLatticeVector DestPos, int i_InteractionShellCount);		// Interaction erstellen aus drei absoluten 4D-Koordinaten
+	int MakeInteraction(T4DLatticeVector StartPos, T4DLatticeVector WWPos, T4DLatticeVector DestPos, int i_InteractionShellCount,
+		TInteractionCache* i_Cache = NULL);		// Interaction erstellen aus drei absoluten 4D-Koordinaten (i_Cache = optionaler Zwischenspeicher fuer die Schalenanalysen)
 	int Compare(TInteraction& toInteraction);		// Interaction mit anderer Interaction vergleichen
 
 	TInteractionBase(TKMCJob* pJob);				// Constructor, Ready = false setzen
@@ -61,6 +70,12 @@ public:
 
 protected:
 	~TInteractionBase();							// Destructor
+
+private:
+	int MakeWWShell(const T4DLatticeVector& PairPos, const T4DLatticeVector& WWPos, int i_InteractionShellCount,
+		vector<T3DVector>* o_Coord, vector<int>* o_ElemID, TInteractionCache* i_Cache);	// Schalenanalyse um die Mitte von PairPos und WWPos (3D-Vektoren bzgl. Analysenmitte)
+	int MakeWWShellAtoms(const T4DLatticeVector& PairPos, const T4DLatticeVector& WWPos, int i_InteractionShellCount,
+		vector<T4DLatticeVector>* o_Atoms);																// Umgebungsatome um die Mitte von PairPos und WWPos bzgl. der Elementarzelle von PairPos
 };
 
 #endif
\ No newline at end of file
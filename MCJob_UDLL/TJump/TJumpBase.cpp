@@ -28,6 +28,7 @@
 #include "TKMCJob/TKMCJob.h"
 #include "TStructure/TStructure.h"
 #include "TJumps/TJumps.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -415,6 +416,55 @@ int TJumpBase::MakeJump(int JumpStartShellCount, int JumpTSShellCount, int JumpD
 	return KMCERR_OK;
 }
 
+// absolute 4D-Positionen der Sprungumgebung setzen (statt MakeJump, z.B. aus dem Sprungmodell-Cache), Ready = true setzen
+int TJumpBase::SetEnvPos(vector<T4DLatticeVector>* pos)
+{
+	if (Ready != false)
+	{
+		cout << "Critical Error: TJump ready too early (in TJumpBase::SetEnvPos)" << endl << endl;
+		return KMCERR_READY_NOT_FALSE;
+	}
+
+	// Gueltigkeit des Inputs pruefen
+	if (pos == NULL)
+	{
+		cout << "Critical Error: Invalid input pointer (in TJumpBase::SetEnvPos)" << endl << endl;
+		return KMCERR_INVALID_POINTER;
+	}
+	if (pos->size() == 0)
+	{
+		cout << "Critical Error: No environment atoms (in TJumpBase::SetEnvPos)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+	if ((StartPos.s == -1) || (BackjumpDirID < 0))
+	{
+		cout << "Critical Error: Start position or backjump not specified (in TJumpBase::SetEnvPos)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+	if (DestPos == T4DLatticeVector(0, 0, 0, 0))
+	{
+		cout << "Critical Error: Destination position not specified (in TJumpBase::SetEnvPos)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+
+	// absolute Positionen zu relativen Positionen umsetzen
+	vector<T4DLatticeVector> env_atoms;
+	env_atoms.reserve(pos->size());
+	for (int i = 0; i < (int)pos->size(); i++)
+	{
+		if (pos->at(i).s < 0)
+		{
+			cout << "Critical Error: Negative vector index (in TJumpBase::SetEnvPos)" << endl << endl;
+			return KMCERR_INVALID_INPUT_CRIT;
+		}
+		env_atoms.push_back(pos->at(i) - StartPos);
+	}
+
+	EnvPos = env_atoms;
+	Ready = true;
+	return KMCERR_OK;
+}
+
 // UniqueJumpID setzen und EnvPos entsprechend mapping umordnen
 int TJumpBase::SetUniqueJump(int ID, vector<int>* mapping)
 {
@@ -616,6 +666,7 @@ int TJumpBase::LoadFromStream(istream& input)
 	vector<T4DLatticeVector> i_EnvPos;
 
 	string line = "";
+	TLineTokenizer linestream;
 	bool if_failed = false;
 	string s_temp = "";
 	int i_temp = 0;
@@ -628,12 +679,12 @@ int TJumpBase::LoadFromStream(istream& input)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TJUMP_UNIQUEID)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -649,7 +700,7 @@ int TJumpBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TJUMP_BACKJUMPDIRID)
 		{
-			if ((linestream >> i_BackjumpDirID).fail() == true)
+			if (linestream.Next(i_BackjumpDirID) == false)
 			{
 				if_failed = true;
 				break;
@@ -657,27 +708,27 @@ int TJumpBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TJUMP_STARTATOM)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_StartPos.x).fail() == true)
+			if (linestream.Next(i_StartPos.x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_StartPos.y).fail() == true)
+			if (linestream.Next(i_StartPos.y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_StartPos.z).fail() == true)
+			if (linestream.Next(i_StartPos.z) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_StartPos.s).fail() == true)
+			if (linestream.Next(i_StartPos.s) == false)
 			{
 				if_failed = true;
 				break;
@@ -685,27 +736,27 @@ int TJumpBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TJUMP_DESTATOM)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_DestPos.x).fail() == true)
+			if (linestream.Next(i_DestPos.x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_DestPos.y).fail() == true)
+			if (linestream.Next(i_DestPos.y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_DestPos.z).fail() == true)
+			if (linestream.Next(i_DestPos.z) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_DestPos.s).fail() == true)
+			if (linestream.Next(i_DestPos.s) == false)
 			{
 				if_failed = true;
 				break;
@@ -713,7 +764,7 @@ int TJumpBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TJUMP_ENVATOM)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -723,28 +774,28 @@ int TJumpBase::LoadFromStream(istream& input)
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
 			i_EnvPos.push_back(T4DLatticeVector());
-			if ((linestream >> i_EnvPos.back().x).fail() == true)
+			if (linestream.Next(i_EnvPos.back().x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_EnvPos.back().y).fail() == true)
+			if (linestream.Next(i_EnvPos.back().y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_EnvPos.back().z).fail() == true)
+			if (linestream.Next(i_EnvPos.back().z) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_EnvPos.back().s).fail() == true)
+			if (linestream.Next(i_EnvPos.back().s) == false)
 			{
 				if_failed = true;
 				break;
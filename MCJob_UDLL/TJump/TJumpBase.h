@@ -52,6 +52,7 @@ public:
 	int SetDestPos(T4DLatticeVector pos);				// absolute 4D-Position des Zielatoms setzen (Vektor von (0,0,0,0) zu Zielatom)
 	int SetBackjumpDirID(int dirID);					// DirID des Ruecksprungs setzen
 	int MakeJump(int JumpStartShellCount, int JumpTSShellCount, int JumpDestShellCount);		// Schalenanalyse zur Bestimmung der Sprungumgebungs-4D-Vektoren, Ready = true setzen
+	int SetEnvPos(vector<T4DLatticeVector>* pos);		// absolute 4D-Positionen der Sprungumgebung setzen (statt MakeJump, z.B. aus dem Sprungmodell-Cache), Ready = true setzen
 	int SetUniqueJump(int ID, vector<int>* mapping);	// UniqueJumpID setzen und EnvPos entsprechend mapping umordnen
 
 	TJumpBase(TKMCJob* pJob);				// Constructor, Ready = false setzen
@@ -21,13 +21,18 @@
 // Includes:
 #include <iomanip>
 #include <sstream>
+#include <unordered_map>
 
 // Eigene Includes:
 #include "ErrorCodes.h"
 #include "GlobalDefinitions.h"
 #include "TKMCJob/TKMCJob.h"
 #include "T3DVector.h"
+#include "TParallel.h"
+#include "TModelCache.h"
+#include "TElements/TElements.h"
 #include "TStructure/TStructure.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -57,6 +62,8 @@ TJumpsBase::~TJumpsBase()
 // mit Parametern MovShellCount und Jump[..]ShellCount alle Gittersprnge und deren Umgebung finden, und Ready = true setzen
 int TJumpsBase::MakeJumps(int i_MovShellCount, int i_JumpStartShellCount, int i_JumpTSShellCount, int i_JumpDestShellCount)
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "MakeJumps");
+
 	if (Ready != false)
 	{
 		cout << "Critical Error: TJumps ready too early (in TJumpsBase::MakeJumps)" << endl;
@@ -97,12 +104,7 @@ int TJumpsBase::MakeJumps(int i_MovShellCount, int i_JumpStartShellCount, int i_
 	}
 
 	// fuer jedes MovVac-Atom in der Elementarzelle Sprungziele suchen:
-	T4DLatticeVector StartPos;					// Startposition des Sprungs
-	T3DVector center;							// Suchzentrum der Schalenanalyse
-	vector<T4DLatticeVector> no_atoms;			// Liste mit nicht-beruecksichtigten Atomen definieren
-	vector<int> elem_ids;						// Liste mit erlaubten Elementen definieren
-	elem_ids.push_back(0);
-	vector<T4DLatticeVector> out_atoms;			// Output-Liste mit absoluten Umgebungspositionen
+	vector<vector<T4DLatticeVector>> out_atoms;	// Output-Listen mit absoluten Umgebungspositionen (fuer jede Startposition)
 	vector<vector<TJump>> i_Jumps;
 	int ErrorCode = KMCERR_OK;
 
@@ -116,26 +118,51 @@ int TJumpsBase::MakeJumps(int i_MovShellCount, int i_JumpStartShellCount, int i_
 		return KMCERR_OBJECT_NOT_READY;
 	}
 
-	for (int s = 0; s < mov_anz; s++)
+	// Sprungmodell-Cache pruefen (Gitterspruenge haengen nur von Elementen, Struktur und Schalenanzahlen ab)
+	string t_CachePath = m_Job->GetModelCachePath();
+	unsigned long long cache_key = 0;
+	if (t_CachePath != "")
 	{
-		StartPos.Set(0, 0, 0, s);
-
-		// -> Schalenanalyse 
-		center = m_Job->m_Structure->Get3DVector(StartPos);	// Zentrum setzen
-
-		no_atoms.clear();
-		no_atoms.push_back(StartPos);		// Startatom nicht beruecksichtigen
-
-		out_atoms.clear();
-		ErrorCode = m_Job->m_Structure->NNAnalysis(center, i_MovShellCount, &elem_ids, &no_atoms, &out_atoms);
-		if (ErrorCode != KMCERR_OK)
+		if (MakeJumpCacheKey(i_MovShellCount, i_JumpStartShellCount, i_JumpTSShellCount, i_JumpDestShellCount, cache_key) == false) t_CachePath = "";
+	}
+	if (t_CachePath != "")
+	{
+		if (LoadJumpsFromCache(t_CachePath, cache_key, mov_anz, i_Jumps) == true)
 		{
-			cout << "Critical Error: NN-Analysis failed (in TJumpsBase::MakeJumps)" << endl;
-			cout << "                Input: " << i_MovShellCount << " " << i_JumpStartShellCount << " " << i_JumpTSShellCount << " ";
-			cout << i_JumpDestShellCount << endl << endl;
-			return ErrorCode;
+			MovShellCount = i_MovShellCount;
+			JumpStartShellCount = i_JumpStartShellCount;
+			JumpTSShellCount = i_JumpTSShellCount;
+			JumpDestShellCount = i_JumpDestShellCount;
+			Jumps = i_Jumps;
+
+			Ready = true;
+			if (IfReady() == false) Ready = false;
+			return KMCERR_OK;
 		}
-		if ((int)out_atoms.size() == 0)
+		i_Jumps.clear();
+	}
+
+	// -> Schalenanalysen der Startpositionen parallel ausfuehren (NNAnalysis veraendert TStructure nicht)
+	out_atoms.resize(mov_anz);
+	ErrorCode = TParallel::For(mov_anz, [&](int s) -> int
+	{
+		T4DLatticeVector StartPos(0, 0, 0, s);						// Startposition des Sprungs
+		T3DVector center = m_Job->m_Structure->Get3DVector(StartPos);	// Suchzentrum der Schalenanalyse
+		vector<T4DLatticeVector> no_atoms(1, StartPos);				// Startatom nicht beruecksichtigen
+		vector<int> elem_ids(1, 0);									// nur bewegliche Spezies als Sprungziel erlaubt
+		return m_Job->m_Structure->NNAnalysis(center, i_MovShellCount, &elem_ids, &no_atoms, &out_atoms[s]);
+	});
+	if (ErrorCode != KMCERR_OK)
+	{
+		cout << "Critical Error: NN-Analysis failed (in TJumpsBase::MakeJumps)" << endl;
+		cout << "                Input: " << i_MovShellCount << " " << i_JumpStartShellCount << " " << i_JumpTSShellCount << " ";
+		cout << i_JumpDestShellCount << endl << endl;
+		return ErrorCode;
+	}
+
+	for (int s = 0; s < mov_anz; s++)
+	{
+		if ((int)out_atoms[s].size() == 0)
 		{
 			cout << "Critical Error: NN-Analysis found no shells (in TJumpsBase::MakeJumps)" << endl;
 			cout << "                Input: " << i_MovShellCount << " " << i_JumpStartShellCount << " " << i_JumpTSShellCount << " ";
@@ -145,18 +172,50 @@ int TJumpsBase::MakeJumps(int i_MovShellCount, int i_JumpStartShellCount, int i_
 
 		// -> Verarbeitung der ermittelten Sprungziele
 		i_Jumps.push_back(vector<TJump>());
-		for (int i = 0; i < (int)out_atoms.size(); i++)
+		for (int i = 0; i < (int)out_atoms[s].size(); i++)
 		{
 			i_Jumps[s].push_back(TJump(m_Job));
-			ErrorCode = i_Jumps[s][i].SetStartPos(StartPos);
+			ErrorCode = i_Jumps[s][i].SetStartPos(T4DLatticeVector(0, 0, 0, s));
 			if (ErrorCode != KMCERR_OK) return ErrorCode;
-			ErrorCode = i_Jumps[s][i].SetDestPos(out_atoms[i]);
+			ErrorCode = i_Jumps[s][i].SetDestPos(out_atoms[s][i]);
 			if (ErrorCode != KMCERR_OK) return ErrorCode;
 		}
 	}
 
+	// Hash-Tabellen fuer die Ruecksprungsuche: relativer Zielvektor (Dest - Start) -> kleinste DirID, fuer jede Startposition
+	auto rel_key = [](const T4DLatticeVector& rel) -> unsigned long long
+	{
+		return ((((unsigned long long)(rel.x + 32768) * 65536ULL + (unsigned long long)(rel.y + 32768)) * 65536ULL +
+			(unsigned long long)(rel.z + 32768)) * 65536ULL) + (unsigned long long)(rel.s + 32768);
+	};
+	vector<unordered_map<unsigned long long, int>> rel_dirids(i_Jumps.size());
+	T4DLatticeVector ij_Start, ij_Dest;
+	for (int i = 0; i < (int)i_Jumps.size(); i++)
+	{
+		rel_dirids[i].reserve(i_Jumps[i].size() * 2);
+		for (int j = 0; j < (int)i_Jumps[i].size(); j++)
+		{
+			ErrorCode = i_Jumps[i][j].GetStartPos(ij_Start);
+			if (ErrorCode != KMCERR_OK)
+			{
+				cout << "Critical Error: Cannot retrieve backjump start position (in TJumpsBase::MakeJumps)" << endl;
+				cout << "                Input: " << i_MovShellCount << " " << i_JumpStartShellCount << " " << i_JumpTSShellCount << " ";
+				cout << i_JumpDestShellCount << endl << endl;
+				return ErrorCode;
+			}
+			ErrorCode = i_Jumps[i][j].GetDestPos(ij_Dest);
+			if (ErrorCode != KMCERR_OK)
+			{
+				cout << "Critical Error: Cannot retrieve backjump destination position (in TJumpsBase::MakeJumps)" << endl;
+				cout << "                Input: " << i_MovShellCount << " " << i_JumpStartShellCount << " " << i_JumpTSShellCount << " ";
+				cout << i_JumpDestShellCount << endl << endl;
+				return ErrorCode;
+			}
+			rel_dirids[i].insert(make_pair(rel_key(ij_Dest - ij_Start), j));
+		}
+	}
+
 	// Pruefung, ob alle Rueckspruenge fuer jeden ermittelten Sprung vorhanden sind, sonst hinzufuegen
-	T4DLatticeVector ij_Start, ij_Dest, t_Start, t_Dest;
 	int backjump_dirid = -1;
 	for (int i = 0; i < (int)i_Jumps.size(); i++)
 	{
@@ -206,35 +265,10 @@ int TJumpsBase::MakeJumps(int i_MovShellCount, int i_JumpStartShellCount, int i_
 			}
 			if ((backjump_dirid >= 0) && (backjump_dirid < (int)i_Jumps[ij_Dest.s].size())) continue;
 
-			// Ruecksprung finden
+			// Ruecksprung finden (rel. Zielvektor des Ruecksprungs == - rel. Zielvektor des Sprungs)
 			backjump_dirid = -1;
-			for (int t = 0; t < (int)i_Jumps[ij_Dest.s].size(); t++)
-			{
-
-				ErrorCode = i_Jumps[ij_Dest.s][t].GetStartPos(t_Start);
-				if (ErrorCode != KMCERR_OK)
-				{
-					cout << "Critical Error: Cannot retrieve backjump start position (in TJumpsBase::MakeJumps)" << endl;
-					cout << "                Input: " << i_MovShellCount << " " << i_JumpStartShellCount << " " << i_JumpTSShellCount << " ";
-					cout << i_JumpDestShellCount << endl << endl;
-					return ErrorCode;
-				}
-				ErrorCode = i_Jumps[ij_Dest.s][t].GetDestPos(t_Dest);
-				if (ErrorCode != KMCERR_OK)
-				{
-					cout << "Critical Error: Cannot retrieve backjump destination position (in TJumpsBase::MakeJumps)" << endl;
-					cout << "                Input: " << i_MovShellCount << " " << i_JumpStartShellCount << " " << i_JumpTSShellCount << " ";
-					cout << i_JumpDestShellCount << endl << endl;
-					return ErrorCode;
-				}
-
-				// Wenn rel. Zielvektor 1 == - rel. Zielvektor 2, dann Ruecksprung gefunden
-				if (ij_Dest - ij_Start == t_Start - t_Dest)
-				{
-					backjump_dirid = t;
-					break;
-				}
-			}
+			auto rel_it = rel_dirids[ij_Dest.s].find(rel_key(ij_Start - ij_Dest));
+			if (rel_it != rel_dirids[ij_Dest.s].end()) backjump_dirid = rel_it->second;
 			if (backjump_dirid == -1)
 			{
 				i_Jumps[ij_Dest.s].push_back(TJump(m_Job));
@@ -243,6 +277,7 @@ int TJumpsBase::MakeJumps(int i_MovShellCount, int i_JumpStartShellCount, int i_
 				ErrorCode = i_Jumps[ij_Dest.s].back().SetDestPos(T4DLatticeVector(0, 0, 0, ij_Dest.s) - ij_Dest + ij_Start);
 				if (ErrorCode != KMCERR_OK) return ErrorCode;
 				backjump_dirid = i_Jumps[ij_Dest.s].size() - 1;
+				rel_dirids[ij_Dest.s].insert(make_pair(rel_key(ij_Start - ij_Dest), backjump_dirid));
 			}
 
 			// Ruecksprung-IDs setzen
@@ -253,15 +288,17 @@ int TJumpsBase::MakeJumps(int i_MovShellCount, int i_JumpStartShellCount, int i_
 		}
 	}
 
-	// MakeJump fuer die Sprungumgebungen aufrufen
+	// MakeJump fuer die Sprungumgebungen parallel aufrufen (jeder Sprung veraendert nur sich selbst)
+	vector<pair<int, int>> jump_ids;
 	for (int i = 0; i < (int)i_Jumps.size(); i++)
 	{
-		for (int j = 0; j < (int)i_Jumps[i].size(); j++)
-		{
-			ErrorCode = i_Jumps[i][j].MakeJump(i_JumpStartShellCount, i_JumpTSShellCount, i_JumpDestShellCount);
-			if (ErrorCode != KMCERR_OK) return ErrorCode;
-		}
+		for (int j = 0; j < (int)i_Jumps[i].size(); j++) jump_ids.push_back(make_pair(i, j));
 	}
+	ErrorCode = TParallel::For((int)jump_ids.size(), [&](int k) -> int
+	{
+		return i_Jumps[jump_ids[k].first][jump_ids[k].second].MakeJump(i_JumpStartShellCount, i_JumpTSShellCount, i_JumpDestShellCount);
+	});
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
 
 	MovShellCount = i_MovShellCount;
 	JumpStartShellCount = i_JumpStartShellCount;
@@ -271,6 +308,16 @@ int TJumpsBase::MakeJumps(int i_MovShellCount, int i_JumpStartShellCount, int i_
 
 	Ready = true;
 	if (IfReady() == false) Ready = false;
+
+	// Gitterspruenge im Sprungmodell-Cache ablegen
+	if ((Ready == true) && (t_CachePath != ""))
+	{
+		vector<int> cache_ints;
+		if (GetCacheData(&cache_ints) == KMCERR_OK)
+		{
+			TModelCache::Save(t_CachePath, KMCPATH_JUMPCACHE_EXT, KMCPATH_JUMPCACHE_MAGIC, cache_key, cache_ints, vector<double>());
+		}
+	}
 	return KMCERR_OK;
 }
 
@@ -316,6 +363,50 @@ int TJumpsBase::SetUniqueJumps(vector<vector<int>>* IDs, vector<vector<vector<in
 	return KMCERR_OK;
 }
 
+// Gitterspruenge als Ganzzahlliste fuer den Sprungmodell-Cache ausgeben
+// (Atomanzahl, je Atom: Richtungsanzahl, je Sprung: Start (x,y,z,s), Ziel (x,y,z,s), Ruecksprung-DirID, Umgebungsanzahl, Umgebung (je x,y,z,s), alles absolut)
+int TJumpsBase::GetCacheData(vector<int>* o_Ints)
+{
+	if (IfReady() != true) return KMCERR_READY_NOT_TRUE;
+	if (o_Ints == NULL) return KMCERR_INVALID_POINTER;
+
+	int ErrorCode = KMCERR_OK;
+	T4DLatticeVector t_Start, t_Dest;
+	vector<T4DLatticeVector> t_Env;
+	int t_BackjumpDirID = -1;
+	auto add_vector = [o_Ints](const T4DLatticeVector& vec)
+	{
+		o_Ints->push_back(vec.x);
+		o_Ints->push_back(vec.y);
+		o_Ints->push_back(vec.z);
+		o_Ints->push_back(vec.s);
+	};
+
+	o_Ints->clear();
+	o_Ints->push_back((int)Jumps.size());
+	for (int i = 0; i < (int)Jumps.size(); i++)
+	{
+		o_Ints->push_back((int)Jumps[i].size());
+		for (int j = 0; j < (int)Jumps[i].size(); j++)
+		{
+			ErrorCode = Jumps[i][j].GetStartPos(t_Start);
+			if (ErrorCode != KMCERR_OK) return ErrorCode;
+			ErrorCode = Jumps[i][j].GetDestPos(t_Dest);
+			if (ErrorCode != KMCERR_OK) return ErrorCode;
+			ErrorCode = Jumps[i][j].GetJumpBackjumpDirID(t_BackjumpDirID);
+			if (ErrorCode != KMCERR_OK) return ErrorCode;
+			ErrorCode = Jumps[i][j].GetEnvPos(&t_Env);
+			if (ErrorCode != KMCERR_OK) return ErrorCode;
+			add_vector(t_Start);
+			add_vector(t_Dest);
+			o_Ints->push_back(t_BackjumpDirID);
+			o_Ints->push_back((int)t_Env.size());
+			for (int k = 0; k < (int)t_Env.size(); k++) add_vector(t_Env[k]);
+		}
+	}
+	return KMCERR_OK;
+}
+
 // Rueckgabe von Ready
 bool TJumpsBase::IfReady()
 {
@@ -432,6 +523,8 @@ int TJumpsBase::SaveToStream(ostream& output, int offset)
 // Elemente aus einem Stream laden, nur bei Ready == false moeglich
 int TJumpsBase::LoadFromStream(istream& input)
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "LoadJumps");
+
 	if (Ready != false)
 	{
 		cout << "Critical Error: TJumps ready too early (in TJumpsBase::LoadFromStream)" << endl << endl;
@@ -469,6 +562,7 @@ int TJumpsBase::LoadFromStream(istream& input)
 	vector<vector<bool>> i_JumpChecked;
 
 	string line = "";
+	TLineTokenizer linestream;
 	bool if_failed = false;
 	bool make_done = false;
 	string s_temp = "";
@@ -484,12 +578,12 @@ int TJumpsBase::LoadFromStream(istream& input)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TJUMPS_MOVSHELLCOUNT)
 		{
-			if ((linestream >> i_MovShellCount).fail() == true)
+			if (linestream.Next(i_MovShellCount) == false)
 			{
 				if_failed = true;
 				break;
@@ -512,7 +606,7 @@ int TJumpsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TJUMPS_JUMPSTARTSHELLCOUNT)
 		{
-			if ((linestream >> i_JumpStartShellCount).fail() == true)
+			if (linestream.Next(i_JumpStartShellCount) == false)
 			{
 				if_failed = true;
 				break;
@@ -535,7 +629,7 @@ int TJumpsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TJUMPS_JUMPTSSHELLCOUNT)
 		{
-			if ((linestream >> i_JumpTSShellCount).fail() == true)
+			if (linestream.Next(i_JumpTSShellCount) == false)
 			{
 				if_failed = true;
 				break;
@@ -558,7 +652,7 @@ int TJumpsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TJUMPS_JUMPDESTSHELLCOUNT)
 		{
-			if ((linestream >> i_JumpDestShellCount).fail() == true)
+			if (linestream.Next(i_JumpDestShellCount) == false)
 			{
 				if_failed = true;
 				break;
@@ -581,7 +675,7 @@ int TJumpsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TJUMPS_JUMPCOUNT)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -592,7 +686,7 @@ int TJumpsBase::LoadFromStream(istream& input)
 				break;
 			}
 			i_JumpCounts.push_back(0);
-			if ((linestream >> i_JumpCounts.back()).fail() == true)
+			if (linestream.Next(i_JumpCounts.back()) == false)
 			{
 				if_failed = true;
 				break;
@@ -605,22 +699,22 @@ int TJumpsBase::LoadFromStream(istream& input)
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i2_temp).fail() == true)
+			if (linestream.Next(i2_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -693,4 +787,99 @@ int TJumpsBase::LoadFromStream(istream& input)
 	return KMCERR_OK;
 }
 
-// ***************************** PRIVATE ********************************** //
\ No newline at end of file
+// ***************************** PRIVATE ********************************** //
+
+// Schluessel fuer den Sprungmodell-Cache aus Elementen, Struktur und Schalenanzahlen (false = nicht moeglich)
+bool TJumpsBase::MakeJumpCacheKey(int i_MovShellCount, int i_JumpStartShellCount, int i_JumpTSShellCount, int i_JumpDestShellCount, unsigned long long& o_Key)
+{
+	if ((m_Job == 0) || (m_Job->m_Elements == 0) || (m_Job->m_Structure == 0)) return false;
+
+	stringstream model_stream;
+	if (m_Job->m_Elements->SaveToStream(model_stream, 0) != KMCERR_OK) return false;
+	if (m_Job->m_Structure->SaveToStream(model_stream, 0) != KMCERR_OK) return false;
+
+	TModelCache cache_key(KMCPATH_JUMPCACHE_MAGIC);
+	cache_key.AddString(model_stream.str());
+	cache_key.AddInt(i_MovShellCount);
+	cache_key.AddInt(i_JumpStartShellCount);
+	cache_key.AddInt(i_JumpTSShellCount);
+	cache_key.AddInt(i_JumpDestShellCount);
+	o_Key = cache_key.GetKey();
+	return true;
+}
+
+// Gitterspruenge aus dem Cache laden (false = nicht vorhanden oder ungueltig, Format siehe GetCacheData)
+bool TJumpsBase::LoadJumpsFromCache(const string& i_CachePath, unsigned long long i_Key, int i_MovCount, vector<vector<TJump>>& o_Jumps)
+{
+	vector<int> t_Ints;
+	vector<double> t_Doubles;
+	if (TModelCache::Load(i_CachePath, KMCPATH_JUMPCACHE_EXT, KMCPATH_JUMPCACHE_MAGIC, i_Key, t_Ints, t_Doubles) == false) return false;
+	if (t_Doubles.size() != 0) return false;
+
+	// Ganzzahlliste lesen (mit Bereichspruefung)
+	size_t pos = 0;
+	auto next_int = [&t_Ints, &pos](int& val) -> bool
+	{
+		if (pos >= t_Ints.size()) return false;
+		val = t_Ints[pos];
+		pos++;
+		return true;
+	};
+	auto next_vector = [&next_int](T4DLatticeVector& vec) -> bool
+	{
+		return ((next_int(vec.x) == true) && (next_int(vec.y) == true) && (next_int(vec.z) == true) && (next_int(vec.s) == true));
+	};
+
+	int atom_count = 0;
+	if (next_int(atom_count) == false) return false;
+	if (atom_count != i_MovCount) return false;
+
+	vector<vector<TJump>> t_Jumps(atom_count, vector<TJump>());
+	T4DLatticeVector t_Start, t_Dest;
+	vector<T4DLatticeVector> t_Env;
+	int dir_count = 0;
+	int backjump_dirid = -1;
+	int env_count = 0;
+	for (int i = 0; i < atom_count; i++)
+	{
+		if (next_int(dir_count) == false) return false;
+		if (dir_count <= 0) return false;
+		for (int j = 0; j < dir_count; j++)
+		{
+			if (next_vector(t_Start) == false) return false;
+			if (next_vector(t_Dest) == false) return false;
+			if (next_int(backjump_dirid) == false) return false;
+			if (next_int(env_count) == false) return false;
+			if ((t_Start != T4DLatticeVector(0, 0, 0, i)) || (env_count <= 0) || (env_count > (int)(t_Ints.size() - pos) / 4)) return false;
+			t_Env.resize(env_count);
+			for (int k = 0; k < env_count; k++)
+			{
+				if (next_vector(t_Env[k]) == false) return false;
+			}
+
+			t_Jumps[i].push_back(TJump(m_Job));
+			if ((t_Dest.s < 0) || (t_Dest.s >= atom_count)) return false;
+			if (t_Jumps[i].back().SetStartPos(t_Start) != KMCERR_OK) return false;
+			if (t_Jumps[i].back().SetDestPos(t_Dest) != KMCERR_OK) return false;
+			if (t_Jumps[i].back().SetBackjumpDirID(backjump_dirid) != KMCERR_OK) return false;
+			if (t_Jumps[i].back().SetEnvPos(&t_Env) != KMCERR_OK) return false;
+		}
+	}
+	if (pos != t_Ints.size()) return false;
+
+	// Ruecksprung-IDs pruefen
+	for (int i = 0; i < atom_count; i++)
+	{
+		for (int j = 0; j < (int)t_Jumps[i].size(); j++)
+		{
+			if (t_Jumps[i][j].GetDestPos(t_Dest) != KMCERR_OK) return false;
+			if (t_Jumps[i][j].GetJumpBackjumpDirID(backjump_dirid) != KMCERR_OK) return false;
+			if (backjump_dirid >= (int)t_Jumps[t_Dest.s].size()) return false;
+			if (t_Jumps[t_Dest.s][backjump_dirid].GetJumpBackjumpDirID(dir_count) != KMCERR_OK) return false;
+			if (dir_count != j) return false;
+		}
+	}
+
+	o_Jumps = t_Jumps;
+	return true;
+}
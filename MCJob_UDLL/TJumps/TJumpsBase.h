@@ -57,8 +57,13 @@ public:
 	int SaveToStream(ostream& output, int offset);		// Jumps in einen Stream schreiben, nur bei Ready == true moeglich
 	int LoadFromStream(istream& input);				// Jumps aus einem Stream laden, nur bei Ready == false moeglich
 
+	int GetCacheData(vector<int>* o_Ints);				// Gitterspruenge (Start, Ziel, Ruecksprung, Umgebung) als Ganzzahlliste fuer den Sprungmodell-Cache ausgeben
+
 protected:
 	~TJumpsBase();							// Destructor
+
+	bool MakeJumpCacheKey(int i_MovShellCount, int i_JumpStartShellCount, int i_JumpTSShellCount, int i_JumpDestShellCount, unsigned long long& o_Key);	// Schluessel fuer den Sprungmodell-Cache aus Elementen, Struktur und Schalenanzahlen (false = nicht moeglich)
+	bool LoadJumpsFromCache(const string& i_CachePath, unsigned long long i_Key, int i_MovCount, vector<vector<TJump>>& o_Jumps);		// Gitterspruenge aus dem Cache laden (false = nicht vorhanden oder ungueltig)
 };
 
 #endif
\ No newline at end of file
@@ -249,6 +249,8 @@ int TJumpsFunc::CreateJumpDirList(int& o_count, int*& o_dircount, int*& o_dirlin
 // Minimalbeschreibung aller aktiven Spruenge und einzigartigen Spruenge fuer die Simulation erstellen
 int TJumpsFunc::CreateSimJumps(int last_movstacksize, TSimJump**& o_simjumps, TSimUniqueJump*& o_simuniquejumps)
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "CreateSimJumps");
+
 	if (IfReady() != true) return KMCERR_READY_NOT_TRUE;
 
 	if (Jumps.size() == 0) return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
@@ -23,6 +23,8 @@
 
 // Includes:
 #include <string>
+#include <vector>
+#include <memory>
 
 using namespace std;
 
@@ -47,6 +49,8 @@ struct IKMCJob
 	virtual int SaveToString(string& Output) = 0;					// Job in String speichern
 	virtual int LoadFromFile(string Filename) = 0;					// Job aus Datei laden
 	virtual int LoadFromString(string Input) = 0;					// Job aus String laden
+	virtual int LoadSummaryFromFile(string Filename, bool& IfCompleted) = 0;	// Nur die fuer GetResultSummary noetigen Abschnitte laden (ohne Jumps und UniqueJumps), IfCompleted = Ergebnisse vollstaendig
+	virtual int SetModelCachePath(string CachePath) = 0;			// Verzeichnis fuer Sprungmodell-Cache setzen ("" = kein Cache), vor LoadFromFile/MakeUniqueCodes aufrufen
 
 	// -> Elemente
 	virtual int ClearElements() = 0;																		// Eingegebene Elemente loeschen
@@ -138,6 +142,8 @@ struct IKMCJob
 
 	// -> Einstellungen
 	virtual int ClearSettings() = 0;																	// Einstellungen lschen
+	virtual int SaveSettingsToString(string& Output) = 0;											// Nur die Einstellungen in String speichern (z.B. zur Wiederherstellung nach Energieaenderungen)
+	virtual int LoadSettingsFromString(string Input) = 0;											// Nur die Einstellungen aus String laden (bisherige Einstellungen werden ersetzt)
 	virtual int SetTemperature(double Temperature) = 0;												// Temperatur einstellen
 	virtual int SetAttemptFrequency(double Frequency) = 0;												// Sprungfrequenz einstellen
 	virtual int SetCheckpointFlags(bool WriteCheckpoint, bool LoadCheckpoint) = 0;						// Checkpoint-Flags setzen
@@ -148,6 +154,9 @@ struct IKMCJob
 	virtual int SetPrerunOptions(bool DoPrerun, long long PreMCSP, int PreRecordAnz) = 0;											// KMC-Vorlaufparameter einstellen
 	virtual int SetDynNormParameters(bool DoDynNorm, long long DynNormAttemptAnz, int DynNormRecordAnz, int DynNormNum) = 0;		// Parameter fr dyn. Normierungssimulation setzen
 	virtual int SetMainKMCOptions(long long MCSP, int MainRecordAnz) = 0;															// KMC-Hauptsimulationsparameter eingeben
+	virtual int SetConvergenceOptions(double ConvTargetError, long long ConvMinMCSP) = 0;											// Konvergenzkriterium der Hauptsimulation eingeben
+	virtual int SetAdaptiveNormalization(bool DoAdaptNorm, double AdaptNormBudget) = 0;											// Adaptive Normierung eingeben
+	virtual int SetObservablesOptions(long long ObsInterval, long long TrjInterval) = 0;											// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie eingeben
 	virtual int MakeSettings() = 0;																	// Einstellungen abschlieen, d.h. Parameter validieren, Ready = true setzen
 	virtual int GetTemperature(double& Temperature) = 0;																	// Temperatur ausgeben
 	virtual int GetAttemptFrequency(double& Frequency) = 0;																// Sprungfrequenz ausgeben
@@ -164,6 +173,9 @@ struct IKMCJob
 	virtual int GetPrerunOptions(bool& DoPrerun, long long& PreMCSP, int& PreRecordAnz) = 0;											// KMC-Vorlaufparameter ausgeben
 	virtual int GetDynNormParameters(bool& DoDynNorm, long long& DynNormAttemptAnz, int& DynNormRecordAnz, int& DynNormNum) = 0;		// Parameter fr dyn. Normierungssimulation ausgeben
 	virtual int GetMainKMCOptions(long long& MCSP, int& MainRecordAnz) = 0;															// KMC-Hauptsimulationsparameter ausgeben
+	virtual int GetConvergenceOptions(double& ConvTargetError, long long& ConvMinMCSP) = 0;										// Konvergenzkriterium der Hauptsimulation ausgeben
+	virtual int GetAdaptiveNormalization(bool& DoAdaptNorm, double& AdaptNormBudget) = 0;										// Adaptive Normierung ausgeben
+	virtual int GetObservablesOptions(long long& ObsInterval, long long& TrjInterval) = 0;										// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie ausgeben
 	virtual int WriteSettingsToConsole() = 0;											// Beschreibung der Einstellungen in Konsole schreiben
 
 	// -> Simulation
@@ -171,12 +183,17 @@ struct IKMCJob
 	virtual int InitializeSimulation() = 0;						// Simulationsdaten initialisieren
 	virtual int SetCheckPointPath(string CheckPointPath) = 0;		// CheckPoint-Dateipfad setzen
 	virtual int LoadCheckPoint() = 0;								// Daten aus CheckPoint-Datei laden
+	virtual int CreateSharedStartLattice(shared_ptr<const vector<int>>& Lattice) = 0;	// Zufaelliges Startgitter erzeugen und zur Verwendung in weiteren Jobs ausgeben (nach InitializeSimulation)
+	virtual int SetSharedStartLattice(shared_ptr<const vector<int>> Lattice) = 0;		// Gemeinsames Startgitter anstelle eines zufaelligen Startgitters verwenden (nach InitializeSimulation)
 	virtual int MakeSimulation() = 0;								// Simulation durchfuehren
 
 	// -> Ergebnisse
 	virtual int GetResultSummaryDesc(string ValDelimiter, string& SummaryDesc) = 0;		// Beschreibung der GetResultSummary-Ausgabe ausgeben
 	virtual int GetResultSummary(string ValDelimiter, string& Summary) = 0;				// Wichtigste Einstellungen und Ergebnisse mit ValDelimiter getrennt ausgeben 
 
+	// -> Zeitprofil
+	virtual int WriteProfileToConsole() = 0;											// Zeitprofil der Job-Pipeline (Laufzeit, Aufrufe und Speicheraenderung je Bereich) in Konsole schreiben
+
 };
 
 // Exportierte Funktion zur Erstellung einer Instanz der Klasse
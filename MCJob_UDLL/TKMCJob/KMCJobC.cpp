@@ -0,0 +1,607 @@
+// **************************************************************** //
+//																	//
+//	C-API: KMCJobC													//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    C-compatible interface of the KMC job for embedding the		//
+//    simulation in other programs (Linux shared library,			//
+//    "make lib"): typed job construction, simulation with			//
+//    progress/observables callbacks, results as structs/arrays		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Funktionen:
+#include "TKMCJob/KMCJobC.h"
+
+// Includes:
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <iostream>
+#include <streambuf>
+
+// Eigene Includes:
+#include "ErrorCodes.h"
+#include "TParallel.h"
+#include "TThreadLogBuf.h"
+#include "TKMCJob/TKMCJob.h"
+#include "TResults/TResults.h"
+
+using namespace std;
+
+// Daten hinter einem Handle
+struct KMCJobC
+{
+	TKMCJob Job;									// KMC-Job
+	KMCJobProgressCallback ProgressCallback;		// Fortschritts-Callback (NULL = keiner)
+	KMCJobObservablesCallback ObservablesCallback;	// Observablen-Callback (NULL = keiner)
+	void* User;										// Pointer fuer die Callbacks
+	vector<KMCJobObsSample> ObsSeries;				// Observablen-Zeitreihe der letzten Simulation
+};
+
+namespace
+{
+	// Streampuffer, der die Ausgaben zeilenweise an einen Log-Callback weiterleitet
+	class TLogCallbackBuf : public streambuf
+	{
+	protected:
+		KMCJobLogCallback Callback;		// Ziel der Zeilen
+		void* User;						// Pointer fuer den Callback
+		string Line;					// Aktuelle (unvollstaendige) Zeile
+
+	public:
+		TLogCallbackBuf(KMCJobLogCallback i_Callback, void* i_User) : Callback(i_Callback), User(i_User) {}
+		~TLogCallbackBuf() { sync(); }
+
+	protected:
+		// Einzelnes Zeichen anhaengen, bei Zeilenende weiterleiten
+		int_type overflow(int_type ch) override
+		{
+			if (traits_type::eq_int_type(ch, traits_type::eof()) == true) return traits_type::not_eof(ch);
+			if (traits_type::to_char_type(ch) == '\n')
+			{
+				Callback(Line.c_str(), User);
+				Line.clear();
+			}
+			else
+			{
+				Line.push_back(traits_type::to_char_type(ch));
+			}
+			return ch;
+		}
+
+		// Mehrere Zeichen anhaengen
+		streamsize xsputn(const char* s, streamsize n) override
+		{
+			for (streamsize i = 0; i < n; i++) overflow(traits_type::to_int_type(s[i]));
+			return n;
+		}
+
+		// Unvollstaendige Zeile bleibt bis zum Zeilenende im Puffer (cout wird bei jedem endl synchronisiert)
+		int sync() override
+		{
+			return 0;
+		}
+	};
+
+	// Log-Puffer des aktuellen Threads (NULL = Ausgabe nach cout)
+	thread_local unique_ptr<TLogCallbackBuf> ThreadLogBuf;
+
+	// Umleitung von cout auf die Ziele der einzelnen Threads (einmalig beim ersten Log-Callback eingerichtet)
+	TThreadLogBuf& GetCoutRedirect()
+	{
+		static TThreadLogBuf CoutRedirect(cout);
+		return CoutRedirect;
+	}
+
+	// Funktion auf dem Job eines Handles aufrufen (keine Ausnahmen ueber die C-Schnittstelle)
+	template <typename TFunc>
+	int CallJob(KMCJobC* job, TFunc func)
+	{
+		if (job == NULL) return KMCERR_INVALID_POINTER;
+		try
+		{
+			return func(job->Job);
+		}
+		catch (...)
+		{
+			return KMCERR_EXCEPTION_OCCURED;
+		}
+	}
+
+	// T3DVector in double-Array kopieren
+	void CopyVector(const T3DVector& i_vec, double o_vec[3])
+	{
+		o_vec[0] = i_vec.x;
+		o_vec[1] = i_vec.y;
+		o_vec[2] = i_vec.z;
+	}
+}
+
+// ******************************************** //
+// -> Allgemein
+// ******************************************** //
+
+// Job erzeugen (NULL = Fehler)
+KMCJobC* KMCJob_Create(void)
+{
+	KMCJobC* o_job = NULL;
+	try
+	{
+		o_job = new KMCJobC;
+		o_job->ProgressCallback = NULL;
+		o_job->ObservablesCallback = NULL;
+		o_job->User = NULL;
+		if (o_job->Job.IfReady() == false)
+		{
+			delete o_job;
+			return NULL;
+		}
+	}
+	catch (...)
+	{
+		delete o_job;
+		return NULL;
+	}
+	return o_job;
+}
+
+// Job freigeben
+void KMCJob_Release(KMCJobC* job)
+{
+	try
+	{
+		delete job;
+	}
+	catch (...)
+	{
+	}
+}
+
+// Konsolenausgaben des aufrufenden Threads zeilenweise an callback leiten (NULL = wieder nach cout)
+int KMCJob_SetThreadLogCallback(KMCJobLogCallback callback, void* user)
+{
+	try
+	{
+		GetCoutRedirect();
+		TThreadLogBuf::SetThreadTarget(NULL);
+		ThreadLogBuf.reset();
+		if (callback != NULL)
+		{
+			ThreadLogBuf = make_unique<TLogCallbackBuf>(callback, user);
+			TThreadLogBuf::SetThreadTarget(ThreadLogBuf.get());
+		}
+		return KMCERR_OK;
+	}
+	catch (...)
+	{
+		return KMCERR_EXCEPTION_OCCURED;
+	}
+}
+
+// Obergrenze der Threads fuer parallele Modellerstellung (0 = keine), z.B. bei mehreren parallelen Jobs
+int KMCJob_SetMaxThreadCount(int max_threads)
+{
+	if (max_threads < 0) return KMCERR_INVALID_INPUT;
+	TParallel::SetMaxThreadCount(max_threads);
+	return KMCERR_OK;
+}
+
+// Job aus String (Inhalt einer *.kmc-Datei) laden
+int KMCJob_LoadFromString(KMCJobC* job, const char* input)
+{
+	if (input == NULL) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job) { return Job.LoadFromString(input); });
+}
+
+// Job in buffer speichern (length = benoetigte Groesse incl. Nullzeichen, buffer = NULL: nur length)
+int KMCJob_SaveToString(KMCJobC* job, char* buffer, size_t size, size_t* length)
+{
+	if (length == NULL) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job)
+	{
+		string t_output = "";
+		int ErrorCode = Job.SaveToString(t_output);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+		*length = t_output.size() + 1;
+		if (buffer == NULL) return KMCERR_OK;
+		if (size < *length) return KMCERR_INVALID_INPUT;
+		memcpy(buffer, t_output.c_str(), *length);
+		return KMCERR_OK;
+	});
+}
+
+// Projektstatus ausgeben
+int KMCJob_GetProjectState(KMCJobC* job, int* state)
+{
+	if (state == NULL) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job) { return Job.GetProjectState(*state); });
+}
+
+// ******************************************** //
+// -> Elemente
+// ******************************************** //
+
+// Element hinzufuegen
+int KMCJob_AddElement(KMCJobC* job, const char* symbol, const char* name, double charge)
+{
+	if ((symbol == NULL) || (name == NULL)) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job) { return Job.AddElement(symbol, name, charge); });
+}
+
+// Element als bewegliche Spezies setzen
+int KMCJob_SetMovingElement(KMCJobC* job, const char* symbol, const char* name, double charge)
+{
+	if ((symbol == NULL) || (name == NULL)) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetMovingElement(symbol, name, charge); });
+}
+
+// Elementliste schliessen
+int KMCJob_MakeElements(KMCJobC* job)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.MakeElements(); });
+}
+
+// ******************************************** //
+// -> Struktur
+// ******************************************** //
+
+// Name der Struktur setzen
+int KMCJob_SetStructureName(KMCJobC* job, const char* name)
+{
+	if (name == NULL) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetStructureName(name); });
+}
+
+// Basis aus Gitterparametern (Angstrom, Grad)
+int KMCJob_SetBasisByLatticeParam(KMCJobC* job, double a, double b, double c, double alpha, double beta, double gamma)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetBasisByLatticeParam(a, b, c, alpha, beta, gamma); });
+}
+
+// Basis aus Gittervektoren (Ax, Ay, Az, Bx, ..., Cz in Angstrom)
+int KMCJob_SetBasisByLatticeVectors(KMCJobC* job, const double vectors[9])
+{
+	if (vectors == NULL) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job)
+	{
+		return Job.SetBasisByLatticeVectors(vectors[0], vectors[1], vectors[2], vectors[3], vectors[4], vectors[5], vectors[6], vectors[7], vectors[8]);
+	});
+}
+
+// Atom hinzufuegen
+int KMCJob_AddAtom(KMCJobC* job, double x_rel, double y_rel, double z_rel, const char* symbol, const char* name, double charge)
+{
+	if ((symbol == NULL) || (name == NULL)) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job) { return Job.AddAtom(x_rel, y_rel, z_rel, symbol, name, charge); });
+}
+
+// Dotierung hinzufuegen
+int KMCJob_AddDoping(KMCJobC* job, const char* doped_symbol, const char* doped_name, double doped_charge,
+	const char* dopand_symbol, const char* dopand_name, double dopand_charge, double vac_dop_ratio)
+{
+	if ((doped_symbol == NULL) || (doped_name == NULL) || (dopand_symbol == NULL) || (dopand_name == NULL)) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job)
+	{
+		return Job.AddDoping(doped_symbol, doped_name, doped_charge, dopand_symbol, dopand_name, dopand_charge, vac_dop_ratio);
+	});
+}
+
+// Struktur abschliessen
+int KMCJob_MakeStructure(KMCJobC* job)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.MakeStructure(); });
+}
+
+// ******************************************** //
+// -> Gitterspruenge
+// ******************************************** //
+
+// Gitterspruenge finden
+int KMCJob_MakeJumps(KMCJobC* job, int mov_shells, int start_shells, int ts_shells, int dest_shells)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.MakeJumps(mov_shells, start_shells, ts_shells, dest_shells); });
+}
+
+// Einzigartige Spruenge finden
+int KMCJob_MakeUniqueJumps(KMCJobC* job)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.MakeUniqueJumps(); });
+}
+
+// Anzahl der einzigartigen Spruenge ausgeben
+int KMCJob_GetUniqueJumpCount(KMCJobC* job, int* count)
+{
+	if (count == NULL) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job) { return Job.GetUJumpCount(*count); });
+}
+
+// Sprung aktivieren/deaktivieren
+int KMCJob_SetJumpActive(KMCJobC* job, int jump_id, int state)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetJumpActive(jump_id, state != 0); });
+}
+
+// Umgebungsatom ignorieren
+int KMCJob_SetAtomIgnore(KMCJobC* job, int jump_id, int coord_id, int state)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetAtomIgnore(jump_id, coord_id, state != 0); });
+}
+
+// Umgebungsatom additiv setzen
+int KMCJob_SetAtomAdditive(KMCJobC* job, int jump_id, int coord_id, int state)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetAtomAdditive(jump_id, coord_id, state != 0); });
+}
+
+// Umgebungsatom aktivieren
+int KMCJob_SetAtomActive(KMCJobC* job, int jump_id, int coord_id, int state)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetAtomActive(jump_id, coord_id, state != 0); });
+}
+
+// Umgebungsbesetzungen bestimmen
+int KMCJob_MakeUniqueCodes(KMCJobC* job, int interaction_shells)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.MakeUniqueCodes(interaction_shells); });
+}
+
+// Anzahl der Wechselwirkungen ausgeben
+int KMCJob_GetInteractionCount(KMCJobC* job, int* count)
+{
+	if (count == NULL) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job) { return Job.GetInteractionCount(*count); });
+}
+
+// Anzahl der UniqueCodes eines einzigartigen Sprungs ausgeben
+int KMCJob_GetCodeCount(KMCJobC* job, int jump_id, int* count)
+{
+	if (count == NULL) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job) { return Job.GetUJumpUCodesCount(jump_id, *count); });
+}
+
+// WW-Energie [eV] einer Wechselwirkung setzen
+int KMCJob_SetInteractionEnergy(KMCJobC* job, int interaction_id, int id, double energy)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetInteractionEnergyByInteraction(interaction_id, id, energy); });
+}
+
+// Code-Energie [eV] setzen
+int KMCJob_SetCodeEnergy(KMCJobC* job, int jump_id, int code_id, double energy)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetCodeEnergy(jump_id, code_id, energy); });
+}
+
+// ******************************************** //
+// -> Einstellungen
+// ******************************************** //
+
+// Temperatur [K]
+int KMCJob_SetTemperature(KMCJobC* job, double temperature)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetTemperature(temperature); });
+}
+
+// Sprungfrequenz [Hz]
+int KMCJob_SetAttemptFrequency(KMCJobC* job, double frequency)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetAttemptFrequency(frequency); });
+}
+
+// E-Feld (Richtung, maximaler Beitrag in kBT)
+int KMCJob_SetEField(KMCJobC* job, double dir_x, double dir_y, double dir_z, double max_efield)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetEField(dir_x, dir_y, dir_z, max_efield); });
+}
+
+// Gittergroesse
+int KMCJob_SetLatticeSize(KMCJobC* job, int lattice_size)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetLatticeSize(lattice_size); });
+}
+
+// Zusaetzliche Leerstellen
+int KMCJob_SetAdditionalVacAnz(KMCJobC* job, long long vac_count)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetAdditionalVacAnz(vac_count); });
+}
+
+// Dotierkonzentration
+int KMCJob_SetDopandConcentration(KMCJobC* job, int doping_id, double conc)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetDopandConcentration(doping_id, conc); });
+}
+
+// Vorlauf
+int KMCJob_SetPrerunOptions(KMCJobC* job, int do_prerun, long long mcsp, int record_count)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetPrerunOptions(do_prerun != 0, mcsp, record_count); });
+}
+
+// Dyn. Normierung
+int KMCJob_SetDynNormParameters(KMCJobC* job, int do_dynnorm, long long attempts, int record_count, int list_entry)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetDynNormParameters(do_dynnorm != 0, attempts, record_count, list_entry); });
+}
+
+// Hauptsimulation
+int KMCJob_SetMainKMCOptions(KMCJobC* job, long long mcsp, int record_count)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetMainKMCOptions(mcsp, record_count); });
+}
+
+// Konvergenzkriterium
+int KMCJob_SetConvergenceOptions(KMCJobC* job, double target_error, long long min_mcsp)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetConvergenceOptions(target_error, min_mcsp); });
+}
+
+// Adaptive Normierung
+int KMCJob_SetAdaptiveNormalization(KMCJobC* job, int do_adaptnorm, double budget)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.SetAdaptiveNormalization(do_adaptnorm != 0, budget); });
+}
+
+// Intervall [MCSP] der Observablen-Zeitreihe (0 = keine, die Gittertrajektorie bleibt unveraendert)
+int KMCJob_SetObservablesInterval(KMCJobC* job, long long interval)
+{
+	return CallJob(job, [&](TKMCJob& Job)
+	{
+		long long t_ObsInterval = 0LL;
+		long long t_TrjInterval = 0LL;
+		int ErrorCode = Job.GetObservablesOptions(t_ObsInterval, t_TrjInterval);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+		return Job.SetObservablesOptions(interval, t_TrjInterval);
+	});
+}
+
+// Einstellungen abschliessen
+int KMCJob_MakeSettings(KMCJobC* job)
+{
+	return CallJob(job, [&](TKMCJob& Job) { return Job.MakeSettings(); });
+}
+
+// ******************************************** //
+// -> Simulation
+// ******************************************** //
+
+// Callbacks setzen (NULL = keiner)
+int KMCJob_SetCallbacks(KMCJobC* job, KMCJobProgressCallback progress, KMCJobObservablesCallback observables, void* user)
+{
+	if (job == NULL) return KMCERR_INVALID_POINTER;
+	job->ProgressCallback = progress;
+	job->ObservablesCallback = observables;
+	job->User = user;
+	return KMCERR_OK;
+}
+
+// Simulation initialisieren
+int KMCJob_InitializeSimulation(KMCJobC* job)
+{
+	return CallJob(job, [&](TKMCJob& Job)
+	{
+		int ErrorCode = Job.ClearSimulation();
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+		return Job.InitializeSimulation();
+	});
+}
+
+// Simulation durchfuehren (Observablen werden immer gesammelt, Callbacks nur fuer die Dauer der Simulation gesetzt)
+int KMCJob_MakeSimulation(KMCJobC* job)
+{
+	return CallJob(job, [&](TKMCJob& Job)
+	{
+		job->ObsSeries.clear();
+
+		TSimCallbacks t_callbacks;
+		if (job->ProgressCallback != NULL)
+		{
+			t_callbacks.Progress = [job](const TSimTelemetryCounters& i_counters)
+			{
+				KMCJobProgress t_progress;
+				t_progress.Phase = i_counters.Phase.load(memory_order_relaxed);
+				t_progress.MCSP = i_counters.MCSP.load(memory_order_relaxed);
+				t_progress.TargetMCSP = i_counters.TargetMCSP.load(memory_order_relaxed);
+				t_progress.JumpAttempts = i_counters.JumpAttempts.load(memory_order_relaxed);
+				t_progress.TargetJumpAttempts = i_counters.TargetJumpAttempts.load(memory_order_relaxed);
+				t_progress.NonsenseAttempts = i_counters.NonsenseAttempts.load(memory_order_relaxed);
+				t_progress.OverkillAttempts = i_counters.OverkillAttempts.load(memory_order_relaxed);
+				t_progress.SiteBlocking = i_counters.SiteBlocking.load(memory_order_relaxed);
+				t_progress.Normalization = i_counters.Normalization.load(memory_order_relaxed);
+				job->ProgressCallback(&t_progress, job->User);
+			};
+		}
+		t_callbacks.Observables = [job](const TSimObsSample& i_sample)
+		{
+			KMCJobObsSample t_sample;
+			t_sample.MCSP = i_sample.MCSP;
+			t_sample.Time = i_sample.Time;
+			t_sample.MSD = i_sample.MSD;
+			t_sample.COM[0] = i_sample.COMx;
+			t_sample.COM[1] = i_sample.COMy;
+			t_sample.COM[2] = i_sample.COMz;
+			t_sample.CollMSD = i_sample.CollMSD;
+			t_sample.HavenRatio = i_sample.HavenRatio;
+			t_sample.Conductivity = i_sample.Conductivity;
+			job->ObsSeries.push_back(t_sample);
+			if (job->ObservablesCallback != NULL) job->ObservablesCallback(&t_sample, job->User);
+		};
+
+		Job.SetSimCallbacks(t_callbacks);
+		int ErrorCode = Job.MakeSimulation();
+		Job.SetSimCallbacks(TSimCallbacks());
+		return ErrorCode;
+	});
+}
+
+// ******************************************** //
+// -> Ergebnisse
+// ******************************************** //
+
+// Ergebnisse der Hauptsimulation ausgeben
+int KMCJob_GetResults(KMCJobC* job, KMCJobResults* results)
+{
+	if (results == NULL) return KMCERR_INVALID_POINTER;
+	return CallJob(job, [&](TKMCJob& Job)
+	{
+		if (Job.m_Results == NULL) return KMCERR_INVALID_POINTER;
+
+		TResultsData t_data;
+		int ErrorCode = Job.m_Results->GetData(t_data);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+		results->MCSP = t_data.MCSP;
+		results->JumpAttempts = t_data.JumpAttempts;
+		results->NonsenseJumpAttempts = t_data.NonsenseJumpAttempts;
+		results->OverkillJumpAttempts = t_data.OverkillJumpAttempts;
+		results->SiteBlockingCounter = t_data.SiteBlockingCounter;
+		results->Normalization = t_data.Normalization;
+		results->RuntimeSeconds = t_data.RuntimeSeconds;
+		results->SimulatedTime = t_data.SimulatedTime;
+		results->Conductivity = t_data.Conductivity;
+
+		results->MovMeanJumpCount = t_data.MovMeanJumpCount;
+		CopyVector(t_data.MovMeanDispVec, results->MovMeanDispVec);
+		results->MovDispParallel = t_data.MovDispParallel;
+		results->MovDispPerpendicular = t_data.MovDispPerpendicular;
+		results->MovMeanDisp = t_data.MovMeanDisp;
+		results->MovMeanSquaredDisp = t_data.MovMeanSquaredDisp;
+		CopyVector(t_data.MovComDispVec, results->MovComDispVec);
+
+		results->VacMeanJumpCount = t_data.VacMeanJumpCount;
+		CopyVector(t_data.VacMeanDispVec, results->VacMeanDispVec);
+		results->VacDispParallel = t_data.VacDispParallel;
+		results->VacDispPerpendicular = t_data.VacDispPerpendicular;
+		results->VacMeanDisp = t_data.VacMeanDisp;
+		results->VacMeanSquaredDisp = t_data.VacMeanSquaredDisp;
+		CopyVector(t_data.VacComDispVec, results->VacComDispVec);
+
+		results->Converged = (t_data.Converged == true) ? 1 : 0;
+		results->CondRelError = t_data.CondRelError;
+		results->MSDRelError = t_data.MSDRelError;
+		results->ConvBlockCount = t_data.ConvBlockCount;
+		results->ConvBlockMCSP = t_data.ConvBlockMCSP;
+
+		return KMCERR_OK;
+	});
+}
+
+// Observablen-Zeitreihe der letzten Simulation ausgeben (count = Anzahl, samples = NULL: nur count)
+int KMCJob_GetObservables(KMCJobC* job, KMCJobObsSample* samples, size_t capacity, size_t* count)
+{
+	if (job == NULL) return KMCERR_INVALID_POINTER;
+	if (count == NULL) return KMCERR_INVALID_POINTER;
+
+	*count = job->ObsSeries.size();
+	if (samples == NULL) return KMCERR_OK;
+	if (capacity < *count) return KMCERR_INVALID_INPUT;
+	if (*count > 0) memcpy(samples, job->ObsSeries.data(), *count * sizeof(KMCJobObsSample));
+
+	return KMCERR_OK;
+}
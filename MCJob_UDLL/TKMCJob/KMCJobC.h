@@ -0,0 +1,184 @@
+// **************************************************************** //
+//																	//
+//	C-API: KMCJobC													//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    C-compatible interface of the KMC job for embedding the		//
+//    simulation in other programs (Linux shared library,			//
+//    "make lib"): typed job construction, simulation with			//
+//    progress/observables callbacks, results as structs/arrays		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef KMCJobC_H
+#define KMCJobC_H
+
+// Includes:
+#include <stddef.h>
+
+// Export der C-Funktionen (Bibliothek wird mit -fvisibility=hidden erstellt)
+#if defined(__GNUC__)
+#define KMCJOBC_API __attribute__((visibility("default")))
+#else
+#define KMCJOBC_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Konventionen:
+// - Rueckgabewerte der int-Funktionen sind die Fehlercodes aus ErrorCodes.h (0 = OK, < 0 = Fehler),
+//   ungueltige Handles oder NULL-Pointer ergeben KMCERR_INVALID_POINTER (-6)
+// - bool-Parameter als int (0 = false, sonst true), Strings als nullterminierte char-Arrays
+// - Ein Handle darf nur von einem Thread gleichzeitig verwendet werden, verschiedene Handles auch parallel
+// - Ohne CheckPoint-Pfad werden keine Dateien geschrieben (Observablen nur an Callback und KMCJob_GetObservables)
+
+// Fehlercode: kein Fehler
+#define KMCJOBC_OK 0
+
+// Simulationsphasen (KMCJobProgress.Phase)
+#define KMCJOBC_PHASE_PRERUN 1
+#define KMCJOBC_PHASE_DYNNORM 2
+#define KMCJOBC_PHASE_MAIN 3
+
+// Handle eines KMC-Jobs (opak)
+typedef struct KMCJobC KMCJobC;
+
+// Fortschritt der laufenden Simulation (einmal pro MCSP und am Ende jeder Phase)
+typedef struct KMCJobProgress
+{
+	int Phase;								// aktuelle Simulationsphase (KMCJOBC_PHASE_...)
+	unsigned long long MCSP;				// MCSP-Zaehler
+	unsigned long long TargetMCSP;			// Ziel-MCSP (0 = durch Sprungversuche begrenzt)
+	unsigned long long JumpAttempts;		// Sprungversuche
+	unsigned long long TargetJumpAttempts;	// Ziel-Sprungversuche (0 = durch MCSP begrenzt)
+	unsigned long long NonsenseAttempts;	// Sprungversuche mit Ruecksprungwahrscheinlichkeit >= 1
+	unsigned long long OverkillAttempts;	// Sprungversuche mit Hinsprungwahrscheinlichkeit >= 1
+	unsigned long long SiteBlocking;		// Sprungversuche auf besetzte Zielplaetze
+	double Normalization;					// aktuelle Normierung
+} KMCJobProgress;
+
+// Messpunkt der Observablen-Zeitreihe der Hauptsimulation (siehe ObservablesInterval)
+typedef struct KMCJobObsSample
+{
+	unsigned long long MCSP;				// MCSP-Zaehler
+	double Time;							// simulierte Zeit in s
+	double MSD;								// mittlere quadratische Verschiebung der beweglichen Spezies in cm^2
+	double COM[3];							// mittlerer Verschiebungsvektor (= Schwerpunktverschiebung je Atom) in cm
+	double CollMSD;							// kollektive quadratische Verschiebung |sum(r)|^2 / N in cm^2
+	double HavenRatio;						// Haven-Verhaeltnis MSD / CollMSD (0 = nicht bestimmbar)
+	double Conductivity;					// Leitfaehigkeit in S/cm (0 = nicht bestimmbar)
+} KMCJobObsSample;
+
+// Ergebnisse der Hauptsimulation
+typedef struct KMCJobResults
+{
+	unsigned long long MCSP;				// Monte-Carlo-Steps per Particle
+	unsigned long long JumpAttempts;		// Sprungversuchsanzahl
+	unsigned long long NonsenseJumpAttempts;	// Sprungversuche mit Ruecksprungwahrscheinlichkeit >= 1
+	unsigned long long OverkillJumpAttempts;	// Sprungversuche mit Hinsprungwahrscheinlichkeit >= 1
+	unsigned long long SiteBlockingCounter;	// Sprungversuche auf besetzte Zielplaetze
+	double Normalization;					// Normierungsfaktor der Wahrscheinlichkeiten
+	double RuntimeSeconds;					// Laufzeit der Simulation in s
+	double SimulatedTime;					// Simulierte Zeitspanne in s
+	double Conductivity;					// Ionische Leitfaehigkeit in E-Feldvektorrichtung in S/cm
+
+	double MovMeanJumpCount;				// Mov: mittlere Sprunganzahl
+	double MovMeanDispVec[3];				// Mov: mittlerer Verschiebungsvektor in cm
+	double MovDispParallel;					// Mov: Verschiebung parallel zum E-Feld in cm
+	double MovDispPerpendicular;			// Mov: Verschiebung senkrecht zum E-Feld in cm
+	double MovMeanDisp;						// Mov: mittlere Verschiebung in cm
+	double MovMeanSquaredDisp;				// Mov: mittlere quadratische Verschiebung in cm^2
+	double MovComDispVec[3];				// Mov: Schwerpunktverschiebungsvektor in cm
+
+	double VacMeanJumpCount;				// Vac: mittlere Sprunganzahl
+	double VacMeanDispVec[3];				// Vac: mittlerer Verschiebungsvektor in cm
+	double VacDispParallel;					// Vac: Verschiebung parallel zum E-Feld in cm
+	double VacDispPerpendicular;			// Vac: Verschiebung senkrecht zum E-Feld in cm
+	double VacMeanDisp;						// Vac: mittlere Verschiebung in cm
+	double VacMeanSquaredDisp;				// Vac: mittlere quadratische Verschiebung in cm^2
+	double VacComDispVec[3];				// Vac: Schwerpunktverschiebungsvektor in cm
+
+	int Converged;							// 1 = Hauptsimulation durch das Konvergenzkriterium vorzeitig beendet
+	double CondRelError;					// relativer Standardfehler der Leitfaehigkeit (-1 = nicht bestimmbar)
+	double MSDRelError;						// relativer Standardfehler der MSD-Rate (-1 = nicht bestimmbar)
+	int ConvBlockCount;						// Anzahl der abgeschlossenen Bloecke (0 = keine Blockmittelung)
+	unsigned long long ConvBlockMCSP;		// MCSP je Block
+} KMCJobResults;
+
+// Callbacks (Aufruf im Thread von KMCJob_MakeSimulation, user = bei KMCJob_SetCallbacks uebergebener Pointer)
+typedef void (*KMCJobProgressCallback)(const KMCJobProgress* progress, void* user);
+typedef void (*KMCJobObservablesCallback)(const KMCJobObsSample* sample, void* user);
+typedef void (*KMCJobLogCallback)(const char* line, void* user);
+
+// -> Allgemein
+KMCJOBC_API KMCJobC* KMCJob_Create(void);																// Job erzeugen (NULL = Fehler)
+KMCJOBC_API void KMCJob_Release(KMCJobC* job);															// Job freigeben
+KMCJOBC_API int KMCJob_SetThreadLogCallback(KMCJobLogCallback callback, void* user);					// Konsolenausgaben des aufrufenden Threads zeilenweise an callback leiten (NULL = wieder nach cout)
+KMCJOBC_API int KMCJob_SetMaxThreadCount(int max_threads);												// Obergrenze der Threads fuer parallele Modellerstellung (0 = keine), z.B. bei mehreren parallelen Jobs
+KMCJOBC_API int KMCJob_LoadFromString(KMCJobC* job, const char* input);								// Job aus String (Inhalt einer *.kmc-Datei) laden
+KMCJOBC_API int KMCJob_SaveToString(KMCJobC* job, char* buffer, size_t size, size_t* length);			// Job in buffer speichern (length = benoetigte Groesse incl. Nullzeichen, buffer = NULL: nur length)
+KMCJOBC_API int KMCJob_GetProjectState(KMCJobC* job, int* state);										// Projektstatus ausgeben
+
+// -> Elemente
+KMCJOBC_API int KMCJob_AddElement(KMCJobC* job, const char* symbol, const char* name, double charge);			// Element hinzufuegen
+KMCJOBC_API int KMCJob_SetMovingElement(KMCJobC* job, const char* symbol, const char* name, double charge);	// Element als bewegliche Spezies setzen
+KMCJOBC_API int KMCJob_MakeElements(KMCJobC* job);																// Elementliste schliessen
+
+// -> Struktur
+KMCJOBC_API int KMCJob_SetStructureName(KMCJobC* job, const char* name);														// Name der Struktur setzen
+KMCJOBC_API int KMCJob_SetBasisByLatticeParam(KMCJobC* job, double a, double b, double c, double alpha, double beta, double gamma);	// Basis aus Gitterparametern (Angstrom, Grad)
+KMCJOBC_API int KMCJob_SetBasisByLatticeVectors(KMCJobC* job, const double vectors[9]);										// Basis aus Gittervektoren (Ax, Ay, Az, Bx, ..., Cz in Angstrom)
+KMCJOBC_API int KMCJob_AddAtom(KMCJobC* job, double x_rel, double y_rel, double z_rel, const char* symbol, const char* name, double charge);	// Atom hinzufuegen
+KMCJOBC_API int KMCJob_AddDoping(KMCJobC* job, const char* doped_symbol, const char* doped_name, double doped_charge,
+	const char* dopand_symbol, const char* dopand_name, double dopand_charge, double vac_dop_ratio);							// Dotierung hinzufuegen
+KMCJOBC_API int KMCJob_MakeStructure(KMCJobC* job);																			// Struktur abschliessen
+
+// -> Gitterspruenge
+KMCJOBC_API int KMCJob_MakeJumps(KMCJobC* job, int mov_shells, int start_shells, int ts_shells, int dest_shells);	// Gitterspruenge finden
+KMCJOBC_API int KMCJob_MakeUniqueJumps(KMCJobC* job);																// Einzigartige Spruenge finden
+KMCJOBC_API int KMCJob_GetUniqueJumpCount(KMCJobC* job, int* count);												// Anzahl der einzigartigen Spruenge ausgeben
+KMCJOBC_API int KMCJob_SetJumpActive(KMCJobC* job, int jump_id, int state);										// Sprung aktivieren/deaktivieren
+KMCJOBC_API int KMCJob_SetAtomIgnore(KMCJobC* job, int jump_id, int coord_id, int state);							// Umgebungsatom ignorieren
+KMCJOBC_API int KMCJob_SetAtomAdditive(KMCJobC* job, int jump_id, int coord_id, int state);						// Umgebungsatom additiv setzen
+KMCJOBC_API int KMCJob_SetAtomActive(KMCJobC* job, int jump_id, int coord_id, int state);							// Umgebungsatom aktivieren
+KMCJOBC_API int KMCJob_MakeUniqueCodes(KMCJobC* job, int interaction_shells);										// Umgebungsbesetzungen bestimmen
+KMCJOBC_API int KMCJob_GetInteractionCount(KMCJobC* job, int* count);												// Anzahl der Wechselwirkungen ausgeben
+KMCJOBC_API int KMCJob_GetCodeCount(KMCJobC* job, int jump_id, int* count);										// Anzahl der UniqueCodes eines einzigartigen Sprungs ausgeben
+KMCJOBC_API int KMCJob_SetInteractionEnergy(KMCJobC* job, int interaction_id, int id, double energy);				// WW-Energie [eV] einer Wechselwirkung setzen
+KMCJOBC_API int KMCJob_SetCodeEnergy(KMCJobC* job, int jump_id, int code_id, double energy);						// Code-Energie [eV] setzen
+
+// -> Einstellungen
+KMCJOBC_API int KMCJob_SetTemperature(KMCJobC* job, double temperature);											// Temperatur [K]
+KMCJOBC_API int KMCJob_SetAttemptFrequency(KMCJobC* job, double frequency);										// Sprungfrequenz [Hz]
+KMCJOBC_API int KMCJob_SetEField(KMCJobC* job, double dir_x, double dir_y, double dir_z, double max_efield);		// E-Feld (Richtung, maximaler Beitrag in kBT)
+KMCJOBC_API int KMCJob_SetLatticeSize(KMCJobC* job, int lattice_size);											// Gittergroesse
+KMCJOBC_API int KMCJob_SetAdditionalVacAnz(KMCJobC* job, long long vac_count);									// Zusaetzliche Leerstellen
+KMCJOBC_API int KMCJob_SetDopandConcentration(KMCJobC* job, int doping_id, double conc);							// Dotierkonzentration
+KMCJOBC_API int KMCJob_SetPrerunOptions(KMCJobC* job, int do_prerun, long long mcsp, int record_count);			// Vorlauf
+KMCJOBC_API int KMCJob_SetDynNormParameters(KMCJobC* job, int do_dynnorm, long long attempts, int record_count, int list_entry);	// Dyn. Normierung
+KMCJOBC_API int KMCJob_SetMainKMCOptions(KMCJobC* job, long long mcsp, int record_count);							// Hauptsimulation
+KMCJOBC_API int KMCJob_SetConvergenceOptions(KMCJobC* job, double target_error, long long min_mcsp);				// Konvergenzkriterium
+KMCJOBC_API int KMCJob_SetAdaptiveNormalization(KMCJobC* job, int do_adaptnorm, double budget);					// Adaptive Normierung
+KMCJOBC_API int KMCJob_SetObservablesInterval(KMCJobC* job, long long interval);									// Intervall [MCSP] der Observablen-Zeitreihe (0 = keine)
+KMCJOBC_API int KMCJob_MakeSettings(KMCJobC* job);																	// Einstellungen abschliessen
+
+// -> Simulation
+KMCJOBC_API int KMCJob_SetCallbacks(KMCJobC* job, KMCJobProgressCallback progress, KMCJobObservablesCallback observables, void* user);	// Callbacks setzen (NULL = keiner)
+KMCJOBC_API int KMCJob_InitializeSimulation(KMCJobC* job);																				// Simulation initialisieren
+KMCJOBC_API int KMCJob_MakeSimulation(KMCJobC* job);																						// Simulation durchfuehren
+
+// -> Ergebnisse
+KMCJOBC_API int KMCJob_GetResults(KMCJobC* job, KMCJobResults* results);											// Ergebnisse der Hauptsimulation ausgeben
+KMCJOBC_API int KMCJob_GetObservables(KMCJobC* job, KMCJobObsSample* samples, size_t capacity, size_t* count);	// Observablen-Zeitreihe der letzten Simulation ausgeben (count = Anzahl, samples = NULL: nur count)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -35,6 +35,9 @@
 #include "TSimulation/TSimulation.h"
 #include "TResults/TResults.h"
 #include "TElementsDesc.h"
+#include "TMemoryStreamBuf.h"
+#include "TBlockStreamBuf.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -50,6 +53,7 @@ TKMCJobBase::TKMCJobBase()
 		UserName = KMCVAR_USERNAME_INIT;
 		SetProjectDate();
 		ProjectDescription = KMCVAR_PROJECTDESC_INIT;
+		ModelCachePath = "";
 		m_ElementsDesc = NULL;
 		m_Elements = NULL;
 		m_Structure = NULL;
@@ -231,6 +235,8 @@ int TKMCJobBase::SaveToFile(string Filename)
 {
 	try
 	{
+		TProfileScope ProfileScope(&m_Profile, "SaveToFile");
+
 		if (Ready != true)
 		{
 			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::SaveToFile)" << endl;
@@ -247,11 +253,20 @@ int TKMCJobBase::SaveToFile(string Filename)
 			return KMCERR_INVALID_INPUT;
 		}
 
+		// Blockweise gepufferten Stream erstellen (endl fuehrt dann nicht zu einzelnen Schreibvorgaengen)
+		TBlockStreamBuf outbuf(outfile.rdbuf(), KMCVAR_SAVEFILE_BLOCKSIZE);
+		ostream outstream(&outbuf);
+
 		// Double-Precision setzen
-		outfile.precision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
+		outstream.precision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
 
 		// Daten in Datei schreiben
-		int ErrorCode = SaveToStream(outfile, 0);
+		int ErrorCode = SaveToStream(outstream, 0);
+		if ((outbuf.Flush() == false) && (ErrorCode == KMCERR_OK))
+		{
+			cout << "Error: Cannot write to file: " << Trim(Filename) << endl << endl;
+			ErrorCode = KMCERR_INVALID_INPUT;
+		}
 		outfile.close();
 
 		if (ErrorCode != KMCERR_OK) return ErrorCode;
@@ -304,6 +319,8 @@ int TKMCJobBase::LoadFromFile(string Filename)
 {
 	try
 	{
+		TProfileScope ProfileScope(&m_Profile, "LoadFromFile");
+
 		if (Ready != true)
 		{
 			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::LoadFromFile)" << endl;
@@ -311,23 +328,15 @@ int TKMCJobBase::LoadFromFile(string Filename)
 			return KMCERR_READY_NOT_TRUE;
 		}
 
-		// Datei oeffnen
-		ifstream infile(std::string(Trim(Filename)));
-		if (infile.is_open() == false)
-		{
-			cout << "Error: Invalid file name: " << Trim(Filename) << endl;
-			cout << "       Cannot read from this file." << endl << endl;
-			return KMCERR_INVALID_INPUT;
-		}
-
-		// Zeilenenden korrigieren
-		string infilestr((istreambuf_iterator<char>(infile)), istreambuf_iterator<char>());
-		infile.close();
-		infilestr.erase(remove(infilestr.begin(), infilestr.end(), '\r'), infilestr.end());
-		stringstream infilestream(infilestr);
+		// Datei in Puffer lesen (ohne \r) und ohne weitere Kopie als Stream verwenden
+		string infilestr = "";
+		int ErrorCode = ReadJobFile(Filename, infilestr);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+		TMemoryStreamBuf infilebuf(infilestr);
+		istream infilestream(&infilebuf);
 
 		// Daten aus Datei auslesen
-		int ErrorCode = LoadFromStream(infilestream);
+		ErrorCode = LoadFromStream(infilestream);
 		if (ErrorCode != KMCERR_OK) return ErrorCode;
 
 		return KMCERR_OK;
@@ -355,7 +364,8 @@ int TKMCJobBase::LoadFromString(string Input)
 
 		// Zeilenenden korrigieren
 		Input.erase(remove(Input.begin(), Input.end(), '\r'), Input.end());
-		stringstream instr(Input);
+		TMemoryStreamBuf inbuf(Input);
+		istream instr(&inbuf);
 
 		// Daten aus Stringstream auslesen
 		int ErrorCode = LoadFromStream(instr);
@@ -373,6 +383,82 @@ int TKMCJobBase::LoadFromString(string Input)
 	}
 }
 
+// Nur die fuer GetResultSummary noetigen Abschnitte laden (ohne Jumps und UniqueJumps), IfCompleted = Ergebnisse vollstaendig
+// (die Abschnitte mit dem Sprungmodell werden uebersprungen, d.h. der Job ist danach nur fuer die Ergebnisausgabe geeignet)
+int TKMCJobBase::LoadSummaryFromFile(string Filename, bool& IfCompleted)
+{
+	try
+	{
+		IfCompleted = false;
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::LoadSummaryFromFile)" << endl;
+			cout << "                Input: " << Trim(Filename) << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		// Datei in Puffer lesen (ohne \r) und ohne weitere Kopie als Stream verwenden
+		string infilestr = "";
+		int ErrorCode = ReadJobFile(Filename, infilestr);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+		TMemoryStreamBuf infilebuf(infilestr);
+		istream infilestream(&infilebuf);
+
+		// Daten aus Datei auslesen (ohne Jumps und UniqueJumps)
+		ErrorCode = LoadFromStream(infilestream, true);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+		// Vollstaendigkeit der Ergebnisse pruefen (entspricht ProjectState 9 nach vollstaendigem Laden)
+		if ((m_Settings == NULL) || (m_Results == NULL))
+		{
+			cout << "Critical Error: Invalid member pointer (in TKMCJobBase::LoadSummaryFromFile)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+		if (m_Settings->IfReady() == false) return KMCERR_OK;
+		long long required_MCSP = 0;
+		int rec_anz = 0;
+		ErrorCode = m_Settings->GetMainKMCOptions(required_MCSP, rec_anz);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+		IfCompleted = m_Results->IfCompleted(required_MCSP);
+
+		return KMCERR_OK;
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
+// Verzeichnis fuer Sprungmodell-Cache setzen ("" = kein Cache)
+// (der Cache wird von MakeUniqueCodes verwendet, d.h. auch beim Laden eines Jobs, und ueberlebt das Loeschen der Member-Klassen)
+int TKMCJobBase::SetModelCachePath(string CachePath)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::SetModelCachePath)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		ModelCachePath = std::string(Trim(CachePath));
+
+		return KMCERR_OK;
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
 // ******************************************** //
 // -> Elemente
 // ******************************************** //
@@ -1283,6 +1369,107 @@ int TKMCJobBase::ClearSettings()
 	}
 }
 
+// Nur die Einstellungen in String speichern (z.B. zur Wiederherstellung nach Energieaenderungen)
+int TKMCJobBase::SaveSettingsToString(string& Output)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::SaveSettingsToString)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		// m_Settings pruefen
+		if (m_Settings == NULL)
+		{
+			cout << "Critical Error: Invalid m_Settings pointer (in TKMCJobBase::SaveSettingsToString)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+		if (m_Settings->IfReady() == false)
+		{
+			cout << "Error: Settings are incomplete (in TKMCJobBase::SaveSettingsToString)" << endl << endl;
+			return KMCERR_OBJECT_NOT_READY;
+		}
+
+		// Einstellungen in Stringstream schreiben (gleiche Genauigkeit wie in der Job-Datei)
+		stringstream outstr;
+		outstr.precision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
+		int ErrorCode = m_Settings->SaveToStream(outstr, 0);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+		Output = outstr.str();
+
+		return KMCERR_OK;
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
+// Nur die Einstellungen aus String laden (bisherige Einstellungen werden ersetzt)
+// (Elemente, Struktur und Sprungmodell bleiben erhalten, Simulation und Ergebnisse werden geloescht)
+int TKMCJobBase::LoadSettingsFromString(string Input)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::LoadSettingsFromString)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		// Bisherige Einstellungen loeschen
+		int ErrorCode = ClearSettings();
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+		// Zeilenenden korrigieren
+		Input.erase(remove(Input.begin(), Input.end(), '\r'), Input.end());
+		TMemoryStreamBuf inbuf(Input);
+		istream instr(&inbuf);
+
+		// Startzeile des Einstellungsabschnitts suchen
+		string line = "";
+		string s_temp = "";
+		bool start_found = false;
+		while (getline(instr, line))
+		{
+			stringstream linestream(line);
+			if ((linestream >> s_temp).fail() == true) continue;
+			if (s_temp == KMCOUT_TSETTINGS_START) start_found = true;
+			break;
+		}
+		if (start_found == false)
+		{
+			cout << "Error: Invalid settings input (in TKMCJobBase::LoadSettingsFromString)" << endl << endl;
+			return KMCERR_INVALID_INPUT;
+		}
+
+		// Einstellungen laden
+		ErrorCode = m_Settings->LoadFromStream(instr);
+		if (ErrorCode != KMCERR_OK)
+		{
+			RCClasses(4);
+			return ErrorCode;
+		}
+
+		return KMCERR_OK;
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
 // Temperatur einstellen
 int TKMCJobBase::SetTemperature(double Temperature)
 {
@@ -1633,6 +1820,111 @@ int TKMCJobBase::SetMainKMCOptions(long long MCSP, int MainRecordAnz)
 	}
 }
 
+// Konvergenzkriterium der Hauptsimulation eingeben
+int TKMCJobBase::SetConvergenceOptions(double ConvTargetError, long long ConvMinMCSP)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::SetConvergenceOptions)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		// m_Settings pruefen
+		if (m_Settings == NULL)
+		{
+			cout << "Critical Error: Invalid m_Settings pointer (in TKMCJobBase::SetConvergenceOptions)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+
+		// Funktion aufrufen
+		int ErrorCode = m_Settings->SetConvergenceOptions(ConvTargetError, ConvMinMCSP);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+		// uebrige Resultate falls vorhanden loeschen
+		return RCClasses(5);
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
+// Adaptive Normierung eingeben
+int TKMCJobBase::SetAdaptiveNormalization(bool DoAdaptNorm, double AdaptNormBudget)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::SetAdaptiveNormalization)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		// m_Settings pruefen
+		if (m_Settings == NULL)
+		{
+			cout << "Critical Error: Invalid m_Settings pointer (in TKMCJobBase::SetAdaptiveNormalization)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+
+		// Funktion aufrufen
+		int ErrorCode = m_Settings->SetAdaptiveNormalization(DoAdaptNorm, AdaptNormBudget);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+		// uebrige Resultate falls vorhanden loeschen
+		return RCClasses(5);
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
+// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie eingeben
+int TKMCJobBase::SetObservablesOptions(long long ObsInterval, long long TrjInterval)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::SetObservablesOptions)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		// m_Settings pruefen
+		if (m_Settings == NULL)
+		{
+			cout << "Critical Error: Invalid m_Settings pointer (in TKMCJobBase::SetObservablesOptions)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+
+		// Funktion aufrufen
+		int ErrorCode = m_Settings->SetObservablesOptions(ObsInterval, TrjInterval);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+		// uebrige Resultate falls vorhanden loeschen
+		return RCClasses(5);
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
 // Einstellungen abschlieen, d.h. Parameter validieren, Ready = true setzen
 int TKMCJobBase::MakeSettings()
 {
@@ -1701,6 +1993,8 @@ int TKMCJobBase::InitializeSimulation()
 {
 	try
 	{
+		TProfileScope ProfileScope(&m_Profile, "InitializeSimulation");
+
 		if (Ready != true)
 		{
 			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::InitializeSimulation)" << endl << endl;
@@ -1771,6 +2065,8 @@ int TKMCJobBase::LoadCheckPoint()
 {
 	try
 	{
+		TProfileScope ProfileScope(&m_Profile, "LoadCheckPoint");
+
 		if (Ready != true)
 		{
 			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::LoadCheckPoint)" << endl << endl;
@@ -1801,9 +2097,73 @@ int TKMCJobBase::LoadCheckPoint()
 	}
 }
 
+// Zufaelliges Startgitter erzeugen und zur Verwendung in weiteren Jobs ausgeben (nach InitializeSimulation)
+int TKMCJobBase::CreateSharedStartLattice(shared_ptr<const vector<int>>& Lattice)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::CreateSharedStartLattice)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		// m_Simulation pruefen
+		if (m_Simulation == NULL)
+		{
+			cout << "Critical Error: Invalid m_Simulation pointer (in TKMCJobBase::CreateSharedStartLattice)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+
+		// Funktion aufrufen
+		return m_Simulation->CreateSharedStartLattice(Lattice);
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
+// Gemeinsames Startgitter anstelle eines zufaelligen Startgitters verwenden (nach InitializeSimulation)
+int TKMCJobBase::SetSharedStartLattice(shared_ptr<const vector<int>> Lattice)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::SetSharedStartLattice)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		// m_Simulation pruefen
+		if (m_Simulation == NULL)
+		{
+			cout << "Critical Error: Invalid m_Simulation pointer (in TKMCJobBase::SetSharedStartLattice)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+
+		// Funktion aufrufen
+		return m_Simulation->SetSharedStartLattice(Lattice);
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
 // Simulation durchfuehren
 int TKMCJobBase::MakeSimulation()
 {
+	TProfileScope ProfileScope(&m_Profile, "MakeSimulation");
+
 	if (Ready != true)
 	{
 		cout << "Critical Error: TKMCJob not ready (in TKMCJobBase::MakeSimulation)" << endl << endl;
@@ -1850,8 +2210,61 @@ bool TKMCJobBase::IfReady()
 	return Ready;
 }
 
+// Rueckgabe von ModelCachePath
+string TKMCJobBase::GetModelCachePath()
+{
+	return ModelCachePath;
+}
+
+// Callbacks der Simulation setzen (bleiben bei Aenderungen der Einstellungen erhalten)
+void TKMCJobBase::SetSimCallbacks(const TSimCallbacks& Callbacks)
+{
+	SimCallbacks = Callbacks;
+}
+
+// Rueckgabe von SimCallbacks
+const TSimCallbacks& TKMCJobBase::GetSimCallbacks() const
+{
+	return SimCallbacks;
+}
+
 // ***************************** PROTECTED ********************************** //
 
+// Job-Datei vollstaendig in o_Content lesen und \r entfernen (Puffergroesse vorab aus Dateigroesse, keine Zwischenkopie)
+int TKMCJobBase::ReadJobFile(string Filename, string& o_Content)
+{
+	// Datei oeffnen
+	ifstream infile(std::string(Trim(Filename)), ios::binary);
+	if (infile.is_open() == false)
+	{
+		cout << "Error: Invalid file name: " << Trim(Filename) << endl;
+		cout << "       Cannot read from this file." << endl << endl;
+		return KMCERR_INVALID_INPUT;
+	}
+
+	// Inhalt lesen
+	o_Content.clear();
+	infile.seekg(0, ios::end);
+	streamoff filesize = infile.tellg();
+	infile.seekg(0, ios::beg);
+	if (filesize > 0)
+	{
+		o_Content.resize((size_t)filesize);
+		infile.read(&o_Content[0], filesize);
+		o_Content.resize((size_t)infile.gcount());
+	}
+	else
+	{
+		o_Content.assign(istreambuf_iterator<char>(infile), istreambuf_iterator<char>());
+	}
+	infile.close();
+
+	// Zeilenenden korrigieren (in-place)
+	o_Content.erase(remove(o_Content.begin(), o_Content.end(), '\r'), o_Content.end());
+
+	return KMCERR_OK;
+}
+
 // Projekt in einen Stream schreiben
 int TKMCJobBase::SaveToStream(ostream& output, int offset)
 {
@@ -2055,7 +2468,7 @@ int TKMCJobBase::SaveToStream(ostream& output, int offset)
 }
 
 // Projekt aus einem Stream laden
-int TKMCJobBase::LoadFromStream(istream& input)
+int TKMCJobBase::LoadFromStream(istream& input, bool i_SummaryOnly)
 {
 	TElements* t_Elements = NULL;
 	TStructure* t_Structure = NULL;
@@ -2101,6 +2514,18 @@ int TKMCJobBase::LoadFromStream(istream& input)
 		string s_temp = "";
 		bool job_found = false;
 		bool if_failed = false;
+		TLineTokenizer linestream;
+		auto skip_section = [&input, &line, &linestream](string_view i_EndKey) -> bool
+		{	// Zeilen bis einschliesslich i_EndKey ueberspringen (false = Dateiende erreicht)
+			string_view sv_temp;
+			do
+			{
+				if (getline(input, line).fail() == true) return false;
+				linestream.SetLine(line);
+				if (linestream.Next(sv_temp) == false) sv_temp = "";
+			} while (sv_temp != i_EndKey);
+			return true;
+		};
 		while (input.good() == true)
 		{
 			// Zeile laden
@@ -2110,13 +2535,13 @@ int TKMCJobBase::LoadFromStream(istream& input)
 				break;
 			}
 			// Zeile interpretieren
-			stringstream linestream(line);
-			if ((linestream >> s_temp).fail() == true) s_temp = "";
+			linestream.SetLine(line);
+			if (linestream.Next(s_temp) == false) s_temp = "";
 
 			// Version pruefen (nur wenn Version angegeben ist, ohne Revisionsnummer)
 			if (s_temp == KMCOUT_VERSION)
 			{
-				if ((linestream >> s_temp).fail() == true)
+				if (linestream.Next(s_temp) == false)
 				{
 					if_failed = true;
 					break;
@@ -2150,7 +2575,7 @@ int TKMCJobBase::LoadFromStream(istream& input)
 			// Projektnamen laden
 			if ((s_temp == KMCOUT_TKMCJOB_NAME) && (job_found == true))
 			{
-				if (getline(linestream, s_temp).fail() == true)
+				if (linestream.Rest(s_temp) == false)
 				{
 					if_failed = true;
 					break;
@@ -2166,7 +2591,7 @@ int TKMCJobBase::LoadFromStream(istream& input)
 			// Usernamen laden
 			if ((s_temp == KMCOUT_TKMCJOB_USERNAME) && (job_found == true))
 			{
-				if (getline(linestream, s_temp).fail() == true)
+				if (linestream.Rest(s_temp) == false)
 				{
 					if_failed = true;
 					break;
@@ -2185,7 +2610,7 @@ int TKMCJobBase::LoadFromStream(istream& input)
 				int i_Day = 0;
 				int i_Month = 0;
 				int i_Year = 0;
-				if ((linestream >> i_Day).fail() == true)
+				if (linestream.Next(i_Day) == false)
 				{
 					if_failed = true;
 					break;
@@ -2195,12 +2620,12 @@ int TKMCJobBase::LoadFromStream(istream& input)
 					if_failed = true;
 					break;
 				}
-				if ((linestream >> s_temp).fail() == true)
+				if (linestream.Next(s_temp) == false)
 				{
 					if_failed = true;
 					break;
 				}
-				if ((linestream >> i_Month).fail() == true)
+				if (linestream.Next(i_Month) == false)
 				{
 					if_failed = true;
 					break;
@@ -2210,12 +2635,12 @@ int TKMCJobBase::LoadFromStream(istream& input)
 					if_failed = true;
 					break;
 				}
-				if ((linestream >> s_temp).fail() == true)
+				if (linestream.Next(s_temp) == false)
 				{
 					if_failed = true;
 					break;
 				}
-				if ((linestream >> i_Year).fail() == true)
+				if (linestream.Next(i_Year) == false)
 				{
 					if_failed = true;
 					break;
@@ -2242,8 +2667,8 @@ int TKMCJobBase::LoadFromStream(istream& input)
 						if_failed = true;
 						break;
 					}
-					stringstream desc_linestream(line);
-					if ((desc_linestream >> s_temp).fail() == true) s_temp = "";
+					linestream.SetLine(line);
+					if (linestream.Next(s_temp) == false) s_temp = "";
 					if (s_temp != KMCOUT_TKMCJOB_DESCEND) i_Desc.emplace_back(RightTrim(line));
 				} while ((s_temp != KMCOUT_TKMCJOB_DESCEND) && (input.good() == true));
 				if ((if_failed == true) || (input.good() != true))
@@ -2333,6 +2758,17 @@ int TKMCJobBase::LoadFromStream(istream& input)
 					break;
 				}
 
+				// Abschnitt ueberspringen, falls nur die Ergebnisse benoetigt werden (kein MakeJumps, Settings uebernehmen das gespeicherte E-Feld)
+				if (i_SummaryOnly == true)
+				{
+					if (skip_section(KMCOUT_TJUMPS_END) == false)
+					{
+						if_failed = true;
+						break;
+					}
+					continue;
+				}
+
 				// m_Jumps laden
 				ErrorCode = m_Jumps->LoadFromStream(input);
 				if (ErrorCode != KMCERR_OK)
@@ -2354,6 +2790,17 @@ int TKMCJobBase::LoadFromStream(istream& input)
 					break;
 				}
 
+				// Abschnitt ueberspringen, falls nur die Ergebnisse benoetigt werden (Codierung ist der aufwendigste Teil)
+				if (i_SummaryOnly == true)
+				{
+					if (skip_section(KMCOUT_TUNIQUEJUMPS_END) == false)
+					{
+						if_failed = true;
+						break;
+					}
+					continue;
+				}
+
 				ErrorCode = m_UniqueJumps->LoadFromStream(input);
 				if (ErrorCode != KMCERR_OK)
 				{
@@ -2374,7 +2821,7 @@ int TKMCJobBase::LoadFromStream(istream& input)
 					break;
 				}
 
-				ErrorCode = m_Settings->LoadFromStream(input);
+				ErrorCode = m_Settings->LoadFromStream(input, i_SummaryOnly);
 				if (ErrorCode != KMCERR_OK)
 				{
 					if_failed = true;
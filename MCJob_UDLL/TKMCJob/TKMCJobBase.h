@@ -23,6 +23,8 @@
 
 // Eigene Includes:
 #include "TKMCJob/IKMCJob.h"
+#include "TProfile.h"
+#include "TSimulation/TSimCallbacks.h"
 
 using namespace std;
 
@@ -49,6 +51,9 @@ protected:
 	int ProjectDateDay;			// Datum der Projekterstellung -> Tag: 1-31
 	string ProjectDescription;	// Projektbeschreibung
 
+	string ModelCachePath;		// Verzeichnis fuer Sprungmodell-Cache (Codierung der UniqueJumps), "" = kein Cache
+	TSimCallbacks SimCallbacks;	// Callbacks der Simulation (Fortschritt, Observablen), leere Funktionen = kein Aufruf
+
 	bool Ready;									// Flag, ob KMCJob erfolgreich initialisiert wurde
 
 public:
@@ -60,6 +65,7 @@ public:
 	TSettings* m_Settings;						// Beschreibung der Simulationseinstellungen
 	TSimulation* m_Simulation;					// Klasse zu Durchfuehrung der Simulation
 	TResults* m_Results;						// Beschreibung der Simulationsergebnisse
+	TProfile m_Profile;							// Zeitprofil der Job-Pipeline (Laufzeit, Aufrufe und Speicheraenderung benannter Bereiche)
 
 	// Member functions
 public:
@@ -74,6 +80,8 @@ public:
 	int SaveToString(string& Output);					// Job in String speichern
 	int LoadFromFile(string Filename);					// Job aus Datei laden
 	int LoadFromString(string Input);					// Job aus String laden
+	int LoadSummaryFromFile(string Filename, bool& IfCompleted);	// Nur die fuer GetResultSummary noetigen Abschnitte laden (ohne Jumps und UniqueJumps), IfCompleted = Ergebnisse vollstaendig
+	int SetModelCachePath(string CachePath);			// Verzeichnis fuer Sprungmodell-Cache setzen ("" = kein Cache), vor LoadFromFile/MakeUniqueCodes aufrufen
 
 	// -> Elemente
 	int ClearElements();																		// Eingegebene Elemente loeschen
@@ -111,6 +119,8 @@ public:
 
 	// -> Einstellungen
 	int ClearSettings();																	// Einstellungen lschen
+	int SaveSettingsToString(string& Output);												// Nur die Einstellungen in String speichern (z.B. zur Wiederherstellung nach Energieaenderungen)
+	int LoadSettingsFromString(string Input);												// Nur die Einstellungen aus String laden (bisherige Einstellungen werden ersetzt)
 	int SetTemperature(double Temperature);												// Temperatur einstellen
 	int SetAttemptFrequency(double Frequency);												// Sprungfrequenz einstellen
 	int SetCheckpointFlags(bool WriteCheckpoint, bool LoadCheckpoint);						// Checkpoint-Flags setzen
@@ -121,6 +131,9 @@ public:
 	int SetPrerunOptions(bool DoPrerun, long long PreMCSP, int PreRecordAnz);											// KMC-Vorlaufparameter einstellen
 	int SetDynNormParameters(bool DoDynNorm, long long DynNormAttemptAnz, int DynNormRecordAnz, int DynNormNum);		// Parameter fr dyn. Normierungssimulation setzen
 	int SetMainKMCOptions(long long MCSP, int MainRecordAnz);															// KMC-Hauptsimulationsparameter eingeben
+	int SetConvergenceOptions(double ConvTargetError, long long ConvMinMCSP);											// Konvergenzkriterium der Hauptsimulation eingeben
+	int SetAdaptiveNormalization(bool DoAdaptNorm, double AdaptNormBudget);												// Adaptive Normierung eingeben
+	int SetObservablesOptions(long long ObsInterval, long long TrjInterval);											// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie eingeben
 	int MakeSettings();																	// Einstellungen abschlieen, d.h. Parameter validieren, Ready = true setzen
 
 	// -> Simulation
@@ -128,16 +141,22 @@ public:
 	int InitializeSimulation();						// Simulationsdaten initialisieren
 	int SetCheckPointPath(string CheckPointPath);		// CheckPoint-Dateipfad setzen
 	int LoadCheckPoint();								// Daten aus CheckPoint-Datei laden
+	int CreateSharedStartLattice(shared_ptr<const vector<int>>& Lattice);	// Zufaelliges Startgitter erzeugen und zur Verwendung in weiteren Jobs ausgeben (nach InitializeSimulation)
+	int SetSharedStartLattice(shared_ptr<const vector<int>> Lattice);		// Gemeinsames Startgitter anstelle eines zufaelligen Startgitters verwenden (nach InitializeSimulation)
 	int MakeSimulation();								// Simulation durchfuehren
 
 	// NON-PUBLISHED
 	TKMCJobBase();		// Constructor -> Initialisierung, falls erfolgreich, Ready = true setzen
+	string GetModelCachePath();		// Rueckgabe von ModelCachePath
+	void SetSimCallbacks(const TSimCallbacks& Callbacks);	// Callbacks der Simulation setzen (bleiben bei Aenderungen der Einstellungen erhalten)
+	const TSimCallbacks& GetSimCallbacks() const;			// Rueckgabe von SimCallbacks
 
 protected:
 	~TKMCJobBase();	// Destructor -> Destructor der Member-Variablen aufrufen
 
 	int SaveToStream(ostream& output, int offset);		// Projekt in einen Stream schreiben
-	int LoadFromStream(istream& input);				// Projekt aus einem Stream laden
+	int ReadJobFile(string Filename, string& o_Content);			// Job-Datei vollstaendig in o_Content lesen und \r entfernen
+	int LoadFromStream(istream& input, bool i_SummaryOnly = false);		// Projekt aus einem Stream laden (i_SummaryOnly = Jumps- und UniqueJumps-Abschnitt ueberspringen)
 
 	int RCElements();							// Deletes and Recreates TElements Member Class
 	int RCStructure();							// Deletes and Recreates TStructure Member Class
@@ -17,6 +17,7 @@
 #include "TKMCJob/TKMCJobOut.h"
 
 // Includes:
+#include <sstream>
 
 // Eigene Includes:
 #include "ErrorCodes.h"
@@ -245,9 +246,12 @@ int TKMCJobOut::WriteToConsole()
 			return KMCERR_READY_NOT_TRUE;
 		}
 
-		// Funktion aufrufen
-		cout.precision(KMCOUT_TKMCJOB_COUT_PRECISION);
-		return SaveToStream(cout, 0);
+		// Funktion aufrufen (Ausgabe ueber lokalen Stream, damit die Genauigkeit von cout unveraendert bleibt)
+		stringstream t_stream;
+		t_stream.precision(KMCOUT_TKMCJOB_COUT_PRECISION);
+		int ErrorCode = SaveToStream(t_stream, 0);
+		cout << t_stream.str();
+		return ErrorCode;
 	}
 	catch (exception& e)
 	{
@@ -501,8 +505,11 @@ int TKMCJobOut::WriteElementsToConsole()
 		}
 
 		// Funktion aufrufen
-		cout.precision(KMCOUT_TELEMENTS_COUT_PRECISION);
-		return m_Elements->SaveToStream(cout, 0);
+		stringstream t_stream;
+		t_stream.precision(KMCOUT_TELEMENTS_COUT_PRECISION);
+		int ErrorCode = m_Elements->SaveToStream(t_stream, 0);
+		cout << t_stream.str();
+		return ErrorCode;
 	}
 	catch (exception& e)
 	{
@@ -783,8 +790,11 @@ int TKMCJobOut::WriteStructureToConsole()
 		}
 
 		// Funktion aufrufen
-		cout.precision(KMCOUT_TSTRUCTURE_COUT_PRECISION);
-		return m_Structure->SaveToStream(cout, 0);
+		stringstream t_stream;
+		t_stream.precision(KMCOUT_TSTRUCTURE_COUT_PRECISION);
+		int ErrorCode = m_Structure->SaveToStream(t_stream, 0);
+		cout << t_stream.str();
+		return ErrorCode;
 	}
 	catch (exception& e)
 	{
@@ -1066,8 +1076,11 @@ int TKMCJobOut::WriteJumpsToConsole()
 		}
 
 		// Funktion aufrufen
-		cout.precision(KMCOUT_TJUMPS_COUT_PRECISION);
-		return m_Jumps->SaveToStream(cout, 0);
+		stringstream t_stream;
+		t_stream.precision(KMCOUT_TJUMPS_COUT_PRECISION);
+		int ErrorCode = m_Jumps->SaveToStream(t_stream, 0);
+		cout << t_stream.str();
+		return ErrorCode;
 	}
 	catch (exception& e)
 	{
@@ -1828,8 +1841,11 @@ int TKMCJobOut::WriteUniqueJumpsToConsole()
 		}
 
 		// Funktion aufrufen
-		cout.precision(KMCOUT_TUNIQUEJUMPS_COUT_PRECISION);
-		return m_UniqueJumps->SaveToStream(cout, 0);
+		stringstream t_stream;
+		t_stream.precision(KMCOUT_TUNIQUEJUMPS_COUT_PRECISION);
+		int ErrorCode = m_UniqueJumps->SaveToStream(t_stream, 0);
+		cout << t_stream.str();
+		return ErrorCode;
 	}
 	catch (exception& e)
 	{
@@ -2295,6 +2311,96 @@ int TKMCJobOut::GetMainKMCOptions(long long& MCSP, int& MainRecordAnz)
 	}
 }
 
+// Konvergenzkriterium der Hauptsimulation ausgeben
+int TKMCJobOut::GetConvergenceOptions(double& ConvTargetError, long long& ConvMinMCSP)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobOut::GetConvergenceOptions)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		if (m_Settings == NULL)
+		{
+			cout << "Critical Error: Invalid member pointer (in TKMCJobOut::GetConvergenceOptions)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+
+		// Funktion aufrufen
+		return m_Settings->GetConvergenceOptions(ConvTargetError, ConvMinMCSP);
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
+// Adaptive Normierung ausgeben
+int TKMCJobOut::GetAdaptiveNormalization(bool& DoAdaptNorm, double& AdaptNormBudget)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobOut::GetAdaptiveNormalization)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		if (m_Settings == NULL)
+		{
+			cout << "Critical Error: Invalid member pointer (in TKMCJobOut::GetAdaptiveNormalization)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+
+		// Funktion aufrufen
+		return m_Settings->GetAdaptiveNormalization(DoAdaptNorm, AdaptNormBudget);
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
+// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie ausgeben
+int TKMCJobOut::GetObservablesOptions(long long& ObsInterval, long long& TrjInterval)
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobOut::GetObservablesOptions)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		if (m_Settings == NULL)
+		{
+			cout << "Critical Error: Invalid member pointer (in TKMCJobOut::GetObservablesOptions)" << endl << endl;
+			return KMCERR_INVALID_POINTER;
+		}
+
+		// Funktion aufrufen
+		return m_Settings->GetObservablesOptions(ObsInterval, TrjInterval);
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
 // Beschreibung der Einstellungen in Konsole schreiben
 int TKMCJobOut::WriteSettingsToConsole()
 {
@@ -2320,8 +2426,11 @@ int TKMCJobOut::WriteSettingsToConsole()
 		}
 
 		// Funktion aufrufen
-		cout.precision(KMCOUT_TSETTINGS_COUT_PRECISION);
-		return m_Settings->SaveToStream(cout, 0);
+		stringstream t_stream;
+		t_stream.precision(KMCOUT_TSETTINGS_COUT_PRECISION);
+		int ErrorCode = m_Settings->SaveToStream(t_stream, 0);
+		cout << t_stream.str();
+		return ErrorCode;
 	}
 	catch (exception& e)
 	{
@@ -2397,6 +2506,35 @@ int TKMCJobOut::GetResultSummary(string ValDelimiter, string& Summary)
 	}
 }
 
+// ******************************************** //
+// -> Zeitprofil
+// ******************************************** //
+
+// Zeitprofil der Job-Pipeline (Laufzeit, Aufrufe und Speicheraenderung je Bereich) in Konsole schreiben
+int TKMCJobOut::WriteProfileToConsole()
+{
+	try
+	{
+		if (Ready != true)
+		{
+			cout << "Critical Error: TKMCJob not ready (in TKMCJobOut::WriteProfileToConsole)" << endl << endl;
+			return KMCERR_READY_NOT_TRUE;
+		}
+
+		// Funktion aufrufen
+		m_Profile.WriteToStream(cout, "");
+		return KMCERR_OK;
+	}
+	catch (exception& e)
+	{
+		return StdExceptionHandler(e);
+	}
+	catch (...)
+	{
+		return ExceptionHandler();
+	}
+}
+
 // ***************************** PUBLIC *********************************** //
 
 
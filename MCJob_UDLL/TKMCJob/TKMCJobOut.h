@@ -115,12 +115,18 @@ public:
 	int GetPrerunOptions(bool& DoPrerun, long long& PreMCSP, int& PreRecordAnz);											// KMC-Vorlaufparameter ausgeben
 	int GetDynNormParameters(bool& DoDynNorm, long long& DynNormAttemptAnz, int& DynNormRecordAnz, int& DynNormNum);		// Parameter fr dyn. Normierungssimulation ausgeben
 	int GetMainKMCOptions(long long& MCSP, int& MainRecordAnz);															// KMC-Hauptsimulationsparameter ausgeben
+	int GetConvergenceOptions(double& ConvTargetError, long long& ConvMinMCSP);										// Konvergenzkriterium der Hauptsimulation ausgeben
+	int GetAdaptiveNormalization(bool& DoAdaptNorm, double& AdaptNormBudget);											// Adaptive Normierung ausgeben
+	int GetObservablesOptions(long long& ObsInterval, long long& TrjInterval);										// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie ausgeben
 	int WriteSettingsToConsole();											// Beschreibung der Einstellungen in Konsole schreiben
 
 	// -> Ergebnisse
 	int GetResultSummaryDesc(string ValDelimiter, string& SummaryDesc);		// Beschreibung der GetResultSummary-Ausgabe ausgeben
 	int GetResultSummary(string ValDelimiter, string& Summary);				// Wichtigste Einstellungen und Ergebnisse mit ValDelimiter getrennt ausgeben
 
+	// -> Zeitprofil
+	int WriteProfileToConsole();											// Zeitprofil der Job-Pipeline (Laufzeit, Aufrufe und Speicheraenderung je Bereich) in Konsole schreiben
+
 	// NON-PUBLISHED
 	TKMCJobOut();		// Constructor
 
@@ -0,0 +1,124 @@
+// **************************************************************** //
+//																	//
+//	Class: TLineTokenizer											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Splitting of a single input line into whitespace-separated	//
+//    tokens and numbers (without stream and locale overhead)		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TLineTokenizer.h"
+
+// Includes:
+#include <charconv>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Trennzeichen zwischen den Woertern (\r fuer Zeilenenden aus Windows-Dateien)
+static bool IsTokenSeparator(char c)
+{
+	return ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n') || (c == '\v') || (c == '\f'));
+}
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor, Zeile setzen
+TLineTokenizer::TLineTokenizer(string_view i_Line)
+{
+	Line = i_Line;
+	Pos = 0;
+}
+
+// ***************************** PUBLIC *********************************** //
+
+// Neue Zeile setzen und Leseposition zuruecksetzen
+void TLineTokenizer::SetLine(string_view i_Line)
+{
+	Line = i_Line;
+	Pos = 0;
+}
+
+// Naechstes Wort lesen (entspricht linestream >> string)
+bool TLineTokenizer::Next(string_view& o_Token)
+{
+	while ((Pos < Line.size()) && (IsTokenSeparator(Line[Pos]) == true)) Pos++;
+	if (Pos >= Line.size()) return false;
+	size_t start = Pos;
+	while ((Pos < Line.size()) && (IsTokenSeparator(Line[Pos]) == false)) Pos++;
+	o_Token = Line.substr(start, Pos - start);
+	return true;
+}
+
+// Naechstes Wort lesen (entspricht linestream >> string)
+bool TLineTokenizer::Next(string& o_Token)
+{
+	string_view token;
+	if (Next(token) == false) return false;
+	o_Token.assign(token.data(), token.size());
+	return true;
+}
+
+// Naechstes Wort als int lesen (ganzes Wort muss Zahl sein)
+bool TLineTokenizer::Next(int& o_Val)
+{
+	return NextNumber(o_Val);
+}
+
+// Naechstes Wort als long long lesen (ganzes Wort muss Zahl sein)
+bool TLineTokenizer::Next(long long& o_Val)
+{
+	return NextNumber(o_Val);
+}
+
+// Naechstes Wort als unsigned long long lesen (ganzes Wort muss Zahl sein)
+bool TLineTokenizer::Next(unsigned long long& o_Val)
+{
+	return NextNumber(o_Val);
+}
+
+// Naechstes Wort als double lesen (ganzes Wort muss Zahl sein)
+bool TLineTokenizer::Next(double& o_Val)
+{
+	return NextNumber(o_Val);
+}
+
+// Rest der Zeile lesen (entspricht getline(linestream, string), false falls nichts uebrig)
+bool TLineTokenizer::Rest(string_view& o_Rest)
+{
+	if (Pos >= Line.size()) return false;
+	o_Rest = Line.substr(Pos);
+	Pos = Line.size();
+	return true;
+}
+
+// Rest der Zeile lesen (entspricht getline(linestream, string), false falls nichts uebrig)
+bool TLineTokenizer::Rest(string& o_Rest)
+{
+	string_view rest;
+	if (Rest(rest) == false) return false;
+	o_Rest.assign(rest.data(), rest.size());
+	return true;
+}
+
+// ***************************** PROTECTED ******************************** //
+
+// Naechstes Wort per from_chars in Zahl umwandeln (fuehrendes '+' wie bei Stream-Eingabe erlaubt)
+template<typename T> bool TLineTokenizer::NextNumber(T& o_Val)
+{
+	string_view token;
+	if (Next(token) == false) return false;
+	if ((token.size() > 1) && (token[0] == '+') && (token[1] != '-')) token.remove_prefix(1);
+	T val = T();
+	from_chars_result res = from_chars(token.data(), token.data() + token.size(), val);
+	if ((res.ec != errc()) || (res.ptr != token.data() + token.size())) return false;
+	o_Val = val;
+	return true;
+}
@@ -0,0 +1,52 @@
+// **************************************************************** //
+//																	//
+//	Class: TLineTokenizer											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Splitting of a single input line into whitespace-separated	//
+//    tokens and numbers (without stream and locale overhead)		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TLineTokenizer_H
+#define TLineTokenizer_H
+
+// Includes:
+#include <string>
+#include <string_view>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TLineTokenizer
+{
+	// Member variables
+protected:
+	string_view Line;		// Aktuelle Zeile (nicht kopiert, muss waehrend der Verwendung bestehen bleiben)
+	size_t Pos;				// Aktuelle Leseposition in Line
+
+	// Member functions
+public:
+	TLineTokenizer(string_view i_Line = "");		// Constructor, Zeile setzen
+
+	void SetLine(string_view i_Line);				// Neue Zeile setzen und Leseposition zuruecksetzen
+	bool Next(string_view& o_Token);				// Naechstes Wort lesen (entspricht linestream >> string)
+	bool Next(string& o_Token);						// Naechstes Wort lesen (entspricht linestream >> string)
+	bool Next(int& o_Val);							// Naechstes Wort als int lesen (ganzes Wort muss Zahl sein)
+	bool Next(long long& o_Val);					// Naechstes Wort als long long lesen (ganzes Wort muss Zahl sein)
+	bool Next(unsigned long long& o_Val);			// Naechstes Wort als unsigned long long lesen (ganzes Wort muss Zahl sein)
+	bool Next(double& o_Val);						// Naechstes Wort als double lesen (ganzes Wort muss Zahl sein)
+	bool Rest(string_view& o_Rest);				// Rest der Zeile lesen (entspricht getline(linestream, string), false falls nichts uebrig)
+	bool Rest(string& o_Rest);						// Rest der Zeile lesen (entspricht getline(linestream, string), false falls nichts uebrig)
+
+protected:
+	template<typename T> bool NextNumber(T& o_Val);		// Naechstes Wort per from_chars in Zahl umwandeln
+};
+
+#endif
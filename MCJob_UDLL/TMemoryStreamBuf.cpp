@@ -0,0 +1,52 @@
+// **************************************************************** //
+//																	//
+//	Class: TMemoryStreamBuf											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Read-only stream buffer on an existing character buffer		//
+//    (istream input without copying the buffer)					//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TMemoryStreamBuf.h"
+
+// Includes:
+
+// Eigene Includes:
+
+using namespace std;
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor, i_Buffer muss waehrend der Verwendung unveraendert bestehen bleiben
+TMemoryStreamBuf::TMemoryStreamBuf(const string& i_Buffer)
+{
+	// streambuf erwartet nicht-konstante Zeiger, es wird aber nur gelesen
+	char* begin = const_cast<char*>(i_Buffer.data());
+	setg(begin, begin, begin + i_Buffer.size());
+}
+
+// ***************************** PROTECTED ******************************** //
+
+// Position relativ setzen (fuer tellg/seekg)
+streampos TMemoryStreamBuf::seekoff(streamoff off, ios_base::seekdir dir, ios_base::openmode which)
+{
+	if ((which & ios_base::in) == 0) return streampos(streamoff(-1));
+	streamoff pos = off;
+	if (dir == ios_base::cur) pos += gptr() - eback();
+	if (dir == ios_base::end) pos += egptr() - eback();
+	if ((pos < 0) || (pos > egptr() - eback())) return streampos(streamoff(-1));
+	setg(eback(), eback() + pos, egptr());
+	return streampos(pos);
+}
+
+// Position absolut setzen (fuer seekg)
+streampos TMemoryStreamBuf::seekpos(streampos pos, ios_base::openmode which)
+{
+	return seekoff(streamoff(pos), ios_base::beg, which);
+}
@@ -0,0 +1,39 @@
+// **************************************************************** //
+//																	//
+//	Class: TMemoryStreamBuf											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Read-only stream buffer on an existing character buffer		//
+//    (istream input without copying the buffer)					//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TMemoryStreamBuf_H
+#define TMemoryStreamBuf_H
+
+// Includes:
+#include <streambuf>
+#include <string>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TMemoryStreamBuf : public streambuf
+{
+
+public:
+	// Member functions
+	TMemoryStreamBuf(const string& i_Buffer);		// Constructor, i_Buffer muss waehrend der Verwendung unveraendert bestehen bleiben
+
+protected:
+	streampos seekoff(streamoff off, ios_base::seekdir dir, ios_base::openmode which = ios_base::in) override;		// Position relativ setzen (fuer tellg/seekg)
+	streampos seekpos(streampos pos, ios_base::openmode which = ios_base::in) override;								// Position absolut setzen (fuer seekg)
+};
+
+#endif
@@ -0,0 +1,167 @@
+// **************************************************************** //
+//																	//
+//	Class: TModelCache												//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Keys and binary entry files of the jump model cache			//
+//    (lattice jumps and unique jumps of a structure), entries		//
+//    are written via temporary file + rename						//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TModelCache.h"
+
+// Includes:
+#include <sstream>
+#include <iomanip>
+#include <fstream>
+#include <filesystem>
+#include <random>
+#include <cstring>
+
+// Eigene Includes:
+#include "GlobalDefinitions.h"
+#include "T3DVector.h"
+
+using namespace std;
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor, Schluessel mit Dateikennung, Programmversion und Vergleichsschwellen beginnen
+TModelCache::TModelCache(string_view i_Magic)
+{
+	Key = 14695981039346656037ULL;
+	AddBytes(i_Magic.data(), i_Magic.size());
+	AddBytes(KMC_VERSION.data(), KMC_VERSION.size());
+	AddDouble(T3DVector::eq_threshold);
+	AddDouble(T3DVector::zero_threshold);
+}
+
+// ***************************** PUBLIC *********************************** //
+
+// Bytes in den Schluessel aufnehmen
+void TModelCache::AddBytes(const void* i_Data, size_t i_Size)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(i_Data);
+	for (size_t i = 0; i < i_Size; i++)
+	{
+		Key ^= bytes[i];
+		Key *= 1099511628211ULL;
+	}
+}
+
+// Ganzzahl in den Schluessel aufnehmen
+void TModelCache::AddInt(long long i_Val)
+{
+	AddBytes(&i_Val, sizeof(i_Val));
+}
+
+// Gleitkommazahl in den Schluessel aufnehmen
+void TModelCache::AddDouble(double i_Val)
+{
+	AddBytes(&i_Val, sizeof(i_Val));
+}
+
+// Text (mit Laenge) in den Schluessel aufnehmen
+void TModelCache::AddString(const string& i_Val)
+{
+	AddInt((long long)i_Val.size());
+	AddBytes(i_Val.data(), i_Val.size());
+}
+
+// Rueckgabe des Schluessels
+unsigned long long TModelCache::GetKey()
+{
+	return Key;
+}
+
+// Eintrag laden (false = nicht vorhanden oder ungueltig)
+// Dateiformat (binaer): Kennung (8 Byte), Schluessel (8 Byte), Anzahl ints (4 Byte), Anzahl doubles (4 Byte), ints (je 4 Byte), doubles (je 8 Byte)
+bool TModelCache::Load(const string& i_CachePath, string_view i_Ext, string_view i_Magic, unsigned long long i_Key, vector<int>& o_Ints, vector<double>& o_Doubles)
+{
+	if (i_CachePath == "") return false;
+
+	stringstream key_str;
+	key_str << hex << setw(16) << setfill('0') << i_Key;
+	filesystem::path cache_file = filesystem::path(i_CachePath) / (key_str.str() + std::string(i_Ext));
+
+	ifstream infile(cache_file, ios::binary);
+	if (infile.is_open() == false) return false;
+
+	// Kopf pruefen (Schluesselkollisionen und fremde Dateien ausschliessen)
+	char magic[8] = {};
+	unsigned long long key = 0;
+	int int_count = 0;
+	int double_count = 0;
+	infile.read(magic, sizeof(magic));
+	infile.read(reinterpret_cast<char*>(&key), sizeof(key));
+	infile.read(reinterpret_cast<char*>(&int_count), sizeof(int_count));
+	infile.read(reinterpret_cast<char*>(&double_count), sizeof(double_count));
+	if ((infile.good() == false) ||
+		(i_Magic.size() != sizeof(magic)) ||
+		(memcmp(magic, i_Magic.data(), sizeof(magic)) != 0) ||
+		(key != i_Key) || (int_count < 0) || (double_count < 0)) return false;
+
+	// Groesse gegen die Datei pruefen, bevor Speicher angefordert wird
+	error_code ec;
+	uintmax_t file_size = filesystem::file_size(cache_file, ec);
+	if ((ec) || (file_size != sizeof(magic) + sizeof(key) + sizeof(int_count) + sizeof(double_count) +
+		sizeof(int) * (uintmax_t)int_count + sizeof(double) * (uintmax_t)double_count)) return false;
+
+	vector<int> t_Ints(int_count, 0);
+	vector<double> t_Doubles(double_count, 0.0);
+	infile.read(reinterpret_cast<char*>(t_Ints.data()), sizeof(int) * int_count);
+	if (infile.gcount() != (streamsize)(sizeof(int) * int_count)) return false;
+	infile.read(reinterpret_cast<char*>(t_Doubles.data()), sizeof(double) * double_count);
+	if (infile.gcount() != (streamsize)(sizeof(double) * double_count)) return false;
+
+	o_Ints = t_Ints;
+	o_Doubles = t_Doubles;
+	return true;
+}
+
+// Eintrag schreiben (Fehler werden ignoriert, da der Cache nur die Rechenzeit betrifft)
+// (Schreiben in temporaere Datei und anschliessendes Umbenennen, damit parallel laufende Jobs keine unvollstaendigen Dateien lesen)
+void TModelCache::Save(const string& i_CachePath, string_view i_Ext, string_view i_Magic, unsigned long long i_Key, const vector<int>& i_Ints, const vector<double>& i_Doubles)
+{
+	if (i_CachePath == "") return;
+	if (i_Magic.size() != 8) return;
+
+	error_code ec;
+	filesystem::create_directories(filesystem::path(i_CachePath), ec);
+	if (filesystem::is_directory(filesystem::path(i_CachePath), ec) == false) return;
+
+	stringstream key_str;
+	key_str << hex << setw(16) << setfill('0') << i_Key;
+	filesystem::path cache_file = filesystem::path(i_CachePath) / (key_str.str() + std::string(i_Ext));
+	if (filesystem::exists(cache_file, ec) == true) return;
+	stringstream tmp_str;
+	tmp_str << key_str.str() << "." << hex << random_device()() << ".tmp";
+	filesystem::path tmp_file = filesystem::path(i_CachePath) / tmp_str.str();
+
+	int int_count = (int)i_Ints.size();
+	int double_count = (int)i_Doubles.size();
+	{
+		ofstream outfile(tmp_file, ios::binary | ios::trunc);
+		if (outfile.is_open() == false) return;
+		outfile.write(i_Magic.data(), i_Magic.size());
+		outfile.write(reinterpret_cast<const char*>(&i_Key), sizeof(i_Key));
+		outfile.write(reinterpret_cast<const char*>(&int_count), sizeof(int_count));
+		outfile.write(reinterpret_cast<const char*>(&double_count), sizeof(double_count));
+		outfile.write(reinterpret_cast<const char*>(i_Ints.data()), sizeof(int) * int_count);
+		outfile.write(reinterpret_cast<const char*>(i_Doubles.data()), sizeof(double) * double_count);
+		outfile.close();
+		if (outfile.fail() == true)
+		{
+			filesystem::remove(tmp_file, ec);
+			return;
+		}
+	}
+	filesystem::rename(tmp_file, cache_file, ec);
+	if (ec) filesystem::remove(tmp_file, ec);
+}
@@ -0,0 +1,51 @@
+// **************************************************************** //
+//																	//
+//	Class: TModelCache												//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Keys and binary entry files of the jump model cache			//
+//    (lattice jumps and unique jumps of a structure), entries		//
+//    are written via temporary file + rename						//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TModelCache_H
+#define TModelCache_H
+
+// Includes:
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TModelCache
+{
+	// Member variables
+protected:
+	unsigned long long Key;			// Laufender Schluessel (FNV-1a)
+
+	// Member functions
+public:
+	TModelCache(string_view i_Magic);		// Constructor, Schluessel mit Dateikennung, Programmversion und Vergleichsschwellen beginnen
+
+	void AddBytes(const void* i_Data, size_t i_Size);		// Bytes in den Schluessel aufnehmen
+	void AddInt(long long i_Val);							// Ganzzahl in den Schluessel aufnehmen
+	void AddDouble(double i_Val);							// Gleitkommazahl in den Schluessel aufnehmen
+	void AddString(const string& i_Val);					// Text (mit Laenge) in den Schluessel aufnehmen
+	unsigned long long GetKey();							// Rueckgabe des Schluessels
+
+	// Eintrag (Kennung, Schluessel, Anzahl ints, Anzahl doubles, ints, doubles) laden (false = nicht vorhanden oder ungueltig)
+	static bool Load(const string& i_CachePath, string_view i_Ext, string_view i_Magic, unsigned long long i_Key, vector<int>& o_Ints, vector<double>& o_Doubles);
+	// Eintrag schreiben (Fehler werden ignoriert, da der Cache nur die Rechenzeit betrifft)
+	static void Save(const string& i_CachePath, string_view i_Ext, string_view i_Magic, unsigned long long i_Key, const vector<int>& i_Ints, const vector<double>& i_Doubles);
+};
+
+#endif
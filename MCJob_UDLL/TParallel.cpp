@@ -0,0 +1,138 @@
+// **************************************************************** //
+//																	//
+//	Class: TParallel												//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Class for distributing independent tasks on worker threads	//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TParallel.h"
+
+// Includes:
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <exception>
+
+// Eigene Includes:
+#include "ErrorCodes.h"
+#include "GlobalDefinitions.h"
+#include "TThreadLogBuf.h"
+
+using namespace std;
+
+// Obergrenze fuer GetThreadCount (0 = keine)
+atomic<int> TParallel::MaxThreadCount(0);
+
+// ***************************** PUBLIC *********************************** //
+
+// Anzahl der verfuegbaren Hardware-Threads ausgeben (mind. 1, hoechstens SetMaxThreadCount)
+int TParallel::GetThreadCount()
+{
+	int count = (int)thread::hardware_concurrency();
+	int max_count = MaxThreadCount.load();
+	if ((max_count > 0) && (count > max_count)) count = max_count;
+	if (count < 1) count = 1;
+	return count;
+}
+
+// Obergrenze fuer GetThreadCount setzen (0 = keine), z.B. wenn mehrere Jobs gleichzeitig laufen
+void TParallel::SetMaxThreadCount(int i_MaxThreadCount)
+{
+	if (i_MaxThreadCount < 0) i_MaxThreadCount = 0;
+	MaxThreadCount = i_MaxThreadCount;
+}
+
+// i_Task(0 .. i_TaskCount-1) auf i_ThreadCount Threads (0 = alle) ausfuehren, Rueckgabe = Fehlercode der Aufgabe mit kleinstem Index
+// (die Aufgaben werden dynamisch verteilt, nach einem Fehler werden keine Aufgaben mit groesserem Index mehr gestartet,
+// Exceptions einer Aufgabe werden wie in den Exception-Handlern der Klassen als KMCERR_EXCEPTION_OCCURED zurueckgegeben)
+int TParallel::For(int i_TaskCount, const function<int(int)>& i_Task, int i_ThreadCount)
+{
+	if (i_TaskCount <= 0) return KMCERR_OK;
+	if (i_ThreadCount <= 0) i_ThreadCount = GetThreadCount();
+	if (i_ThreadCount > i_TaskCount) i_ThreadCount = i_TaskCount;
+
+	// Aufgabe ausfuehren (Exceptions duerfen keinen Worker-Thread verlassen, sonst std::terminate)
+	auto run_task = [&i_Task](int i) -> int
+	{
+		try
+		{
+			return i_Task(i);
+		}
+		catch (exception& e)
+		{
+			cout << KMCERRSTR_STDERR << " " << e.what() << endl;
+			return KMCERR_EXCEPTION_OCCURED;
+		}
+		catch (...)
+		{
+			cout << KMCERRSTR_UNKNOWNERR << endl;
+			return KMCERR_EXCEPTION_OCCURED;
+		}
+	};
+
+	// Seriell, falls nur ein Thread
+	int ErrorCode = KMCERR_OK;
+	if (i_ThreadCount == 1)
+	{
+		for (int i = 0; i < i_TaskCount; i++)
+		{
+			ErrorCode = run_task(i);
+			if (ErrorCode != KMCERR_OK) return ErrorCode;
+		}
+		return KMCERR_OK;
+	}
+
+	// Parallel: naechste Aufgabe ueber atomaren Zaehler holen
+	// (Ausgaben der Worker-Threads gehen an das Ausgabeziel des aufrufenden Threads, siehe TThreadLogBuf)
+	streambuf* log_target = TThreadLogBuf::GetThreadTarget();
+	atomic<int> next_task(0);
+	atomic<int> first_error(i_TaskCount);		// kleinster Index einer fehlgeschlagenen Aufgabe
+	vector<int> task_errors(i_TaskCount, KMCERR_OK);
+	auto worker = [&]()
+	{
+		int i = 0;
+		int old_error = 0;
+		while (true)
+		{
+			i = next_task.fetch_add(1);
+			if ((i >= i_TaskCount) || (i > first_error.load())) break;
+			task_errors[i] = run_task(i);
+			if (task_errors[i] != KMCERR_OK)
+			{
+				old_error = first_error.load();
+				while ((i < old_error) && (first_error.compare_exchange_weak(old_error, i) == false));
+			}
+		}
+	};
+	vector<thread> threads;
+	threads.reserve(i_ThreadCount - 1);
+	for (int t = 0; t < i_ThreadCount - 1; t++)
+	{
+		// Falls kein weiterer Thread gestartet werden kann (std::system_error), mit den bereits gestarteten weiterarbeiten
+		try
+		{
+			threads.push_back(thread([&]()
+				{
+					TThreadLogBuf::SetThreadTarget(log_target);
+					worker();
+				}));
+		}
+		catch (...)
+		{
+			break;
+		}
+	}
+	worker();
+	for (int t = 0; t < (int)threads.size(); t++) threads[t].join();
+
+	if (first_error.load() < i_TaskCount) return task_errors[first_error.load()];
+	return KMCERR_OK;
+}
@@ -0,0 +1,41 @@
+// **************************************************************** //
+//																	//
+//	Class: TParallel												//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Class for distributing independent tasks on worker threads	//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TParallel_H
+#define TParallel_H
+
+// Includes:
+#include <functional>
+#include <atomic>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TParallel
+{
+	// Member variables
+protected:
+	static atomic<int> MaxThreadCount;			// Obergrenze fuer GetThreadCount (0 = keine)
+
+	// Member functions
+public:
+
+	// Static member functions
+	static int GetThreadCount();												// Anzahl der verfuegbaren Hardware-Threads ausgeben (mind. 1, hoechstens SetMaxThreadCount)
+	static void SetMaxThreadCount(int i_MaxThreadCount);						// Obergrenze fuer GetThreadCount setzen (0 = keine), z.B. wenn mehrere Jobs gleichzeitig laufen
+	static int For(int i_TaskCount, const function<int(int)>& i_Task, int i_ThreadCount = 0);	// i_Task(0 .. i_TaskCount-1) auf i_ThreadCount Threads (0 = alle) ausfuehren, Rueckgabe = Fehlercode der Aufgabe mit kleinstem Index
+};
+
+#endif
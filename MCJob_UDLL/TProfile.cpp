@@ -0,0 +1,175 @@
+// **************************************************************** //
+//																	//
+//	Class: TProfile, TProfileScope									//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Time profile of a job: aggregates wall time, call count and	//
+//    memory change of named regions, which are measured by			//
+//    TProfileScope objects (RAII)									//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TProfile.h"
+
+// Includes:
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+// Eigene Includes:
+#include "GlobalDefinitions.h"
+
+using namespace std;
+
+// Aktuelle Verschachtelungstiefe des aktuellen Threads
+thread_local int TProfile::ThreadDepth = 0;
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor
+TProfile::TProfile()
+{
+	CreationTime = chrono::steady_clock::now();
+	FirstStepSeconds = -1.0;
+}
+
+// ***************************** PUBLIC *********************************** //
+
+// Alle Bereiche loeschen und Startzeitpunkt neu setzen
+void TProfile::Clear()
+{
+	lock_guard<mutex> lock(RegionMutex);
+	Regions.clear();
+	CreationTime = chrono::steady_clock::now();
+	FirstStepSeconds = -1.0;
+}
+
+// Bereich beim Eintritt suchen bzw. anlegen, Rueckgabe = Index des Bereichs
+size_t TProfile::EnterRegion(const char* i_Name, int i_Depth)
+{
+	lock_guard<mutex> lock(RegionMutex);
+
+	// Bestehenden Bereich suchen (wenige Bereiche -> lineare Suche)
+	for (size_t i = 0; i < Regions.size(); i++)
+	{
+		if (Regions[i].Name == i_Name) return i;
+	}
+
+	// Neuen Bereich anhaengen (Reihenfolge = erster Eintritt, d.h. uebergeordnete Bereiche vor ihren Unterbereichen)
+	Regions.push_back(TRegion{ i_Name, i_Depth, 0LL, 0.0, 0LL });
+	return Regions.size() - 1;
+}
+
+// Messung eines Bereichs hinzufuegen
+void TProfile::AddRegion(size_t i_Index, double i_Seconds, long long i_MemDelta)
+{
+	lock_guard<mutex> lock(RegionMutex);
+
+	// Index kann nach Clear() ungueltig sein
+	if (i_Index >= Regions.size()) return;
+	Regions[i_Index].Calls++;
+	Regions[i_Index].Seconds += i_Seconds;
+	Regions[i_Index].MemDelta += i_MemDelta;
+}
+
+// Beginn des ersten KMC-Schritts markieren (weitere Aufrufe werden ignoriert)
+void TProfile::MarkFirstStep()
+{
+	lock_guard<mutex> lock(RegionMutex);
+	if (FirstStepSeconds >= 0.0) return;
+	FirstStepSeconds = chrono::duration<double>(chrono::steady_clock::now() - CreationTime).count();
+}
+
+// Profiltabelle in Stream schreiben
+void TProfile::WriteToStream(ostream& output, string i_space) const
+{
+	lock_guard<mutex> lock(RegionMutex);
+
+	double t_total = chrono::duration<double>(chrono::steady_clock::now() - CreationTime).count();
+
+	// Spaltenbreite der Namen (incl. Einrueckung)
+	size_t t_namewidth = 6;
+	for (const TRegion& region : Regions)
+	{
+		t_namewidth = max(t_namewidth, region.Name.size() + 2 * size_t(region.Depth));
+	}
+
+	output << i_space << "Time profile:" << endl;
+	output << i_space << "  " << left << setw(t_namewidth) << "Region" << right;
+	output << setw(10) << "Calls" << setw(14) << "Time [s]" << setw(10) << "Share";
+	output << setw(16) << "Mem. [MB]" << endl;
+
+	ostringstream t_line;
+	t_line << fixed;
+	for (const TRegion& region : Regions)
+	{
+		t_line.str("");
+		t_line << i_space << "  " << left << setw(t_namewidth) << (string(2 * size_t(region.Depth), ' ') + region.Name) << right;
+		t_line << setw(10) << region.Calls;
+		t_line << setw(14) << setprecision(4) << region.Seconds;
+		t_line << setw(9) << setprecision(1) << ((t_total > 0.0) ? 100.0 * region.Seconds / t_total : 0.0) << "%";
+		t_line << setw(16) << showpos << setprecision(2) << double(region.MemDelta) / 1048576.0 << noshowpos;
+		output << t_line.str() << endl;
+	}
+
+	t_line.str("");
+	t_line << setprecision(4);
+	if (FirstStepSeconds >= 0.0)
+	{
+		t_line << i_space << "  Startup time (until first KMC step): " << FirstStepSeconds << " s" << endl;
+	}
+	t_line << i_space << "  Total time (since job creation): " << t_total << " s" << endl;
+	output << t_line.str();
+}
+
+// Constructor, startet die Messung des Bereichs i_Name
+TProfileScope::TProfileScope(TProfile* i_Profile, const char* i_Name)
+{
+	Profile = i_Profile;
+	Index = 0;
+	StartMem = -1LL;
+	int t_depth = TProfile::ThreadDepth++;
+	if (Profile != NULL)
+	{
+		// Keine Ausnahmen aus dem Constructor weitergeben (Messung entfaellt dann)
+		try
+		{
+			Index = Profile->EnterRegion(i_Name, t_depth);
+			StartMem = GetCurrentMemoryUsage();
+		}
+		catch (...)
+		{
+			Profile = NULL;
+		}
+	}
+	StartTime = chrono::steady_clock::now();
+}
+
+// Destructor, beendet die Messung und uebergibt sie an das Profil
+TProfileScope::~TProfileScope()
+{
+	TProfile::ThreadDepth--;
+	if (Profile == NULL) return;
+
+	double t_seconds = chrono::duration<double>(chrono::steady_clock::now() - StartTime).count();
+	long long t_mem_delta = 0LL;
+	if (StartMem >= 0LL)
+	{
+		long long t_end_mem = GetCurrentMemoryUsage();
+		if (t_end_mem >= 0LL) t_mem_delta = t_end_mem - StartMem;
+	}
+
+	// Keine Ausnahmen aus dem Destructor weitergeben
+	try
+	{
+		Profile->AddRegion(Index, t_seconds, t_mem_delta);
+	}
+	catch (...)
+	{
+	}
+}
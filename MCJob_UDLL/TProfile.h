@@ -0,0 +1,83 @@
+// **************************************************************** //
+//																	//
+//	Class: TProfile, TProfileScope									//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Time profile of a job: aggregates wall time, call count and	//
+//    memory change of named regions, which are measured by			//
+//    TProfileScope objects (RAII)									//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TProfile_H
+#define TProfile_H
+
+// Includes:
+#include <string>
+#include <vector>
+#include <ostream>
+#include <mutex>
+#include <chrono>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TProfile
+{
+	// Member variables
+protected:
+	// Daten eines Bereichs
+	struct TRegion
+	{
+		string Name;						// Name des Bereichs
+		int Depth;							// Verschachtelungstiefe beim ersten Aufruf
+		long long Calls;					// Anzahl der Aufrufe
+		double Seconds;						// Summierte Laufzeit [s]
+		long long MemDelta;					// Summierte Aenderung des Arbeitsspeicherverbrauchs [Bytes]
+	};
+	vector<TRegion> Regions;				// Bereiche in der Reihenfolge ihres ersten Eintritts
+	chrono::steady_clock::time_point CreationTime;	// Zeitpunkt der Erzeugung (= Beginn der Job-Pipeline)
+	double FirstStepSeconds;				// Zeit von der Erzeugung bis zum ersten KMC-Schritt [s] (< 0 = noch kein KMC-Schritt)
+	mutable mutex RegionMutex;				// Serialisierung der Zugriffe auf Regions
+
+	static thread_local int ThreadDepth;	// Aktuelle Verschachtelungstiefe der Bereiche des aktuellen Threads
+
+	// Member functions
+public:
+	TProfile();																	// Constructor
+
+	void Clear();																// Alle Bereiche loeschen und Startzeitpunkt neu setzen
+	size_t EnterRegion(const char* i_Name, int i_Depth);										// Bereich beim Eintritt suchen bzw. anlegen, Rueckgabe = Index des Bereichs
+	void AddRegion(size_t i_Index, double i_Seconds, long long i_MemDelta);						// Messung eines Bereichs hinzufuegen
+	void MarkFirstStep();														// Beginn des ersten KMC-Schritts markieren (weitere Aufrufe werden ignoriert)
+	void WriteToStream(ostream& output, string i_space) const;					// Profiltabelle in Stream schreiben
+
+	friend class TProfileScope;
+};
+
+// Klassendeklaration:
+class TProfileScope
+{
+	// Member variables
+protected:
+	TProfile* Profile;						// Ziel der Messung (NULL = keine Messung)
+	size_t Index;							// Index des Bereichs im Profil
+	chrono::steady_clock::time_point StartTime;	// Startzeitpunkt
+	long long StartMem;						// Arbeitsspeicherverbrauch zu Beginn [Bytes] (-1 = nicht verfuegbar)
+
+	// Member functions
+public:
+	TProfileScope(TProfile* i_Profile, const char* i_Name);		// Constructor, startet die Messung des Bereichs i_Name
+	~TProfileScope();											// Destructor, beendet die Messung und uebergibt sie an das Profil
+
+	TProfileScope(const TProfileScope&) = delete;
+	TProfileScope& operator=(const TProfileScope&) = delete;
+};
+
+#endif
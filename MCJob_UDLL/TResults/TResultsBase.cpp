@@ -25,8 +25,10 @@
 #include "ErrorCodes.h"
 #include "GlobalDefinitions.h"
 #include "TKMCJob/TKMCJob.h"
+#include "TSettings/TSettings.h"
 #include "TSimulation/TSimulation.h"
 #include "TSimulation/TSimPhaseInfo.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -59,6 +61,12 @@ TResultsBase::TResultsBase(TKMCJob* pJob)
 	VacDispPerpendicular = 0.0;
 	VacMeanDisp = 0.0;
 	VacMeanSquaredDisp = 0.0;
+
+	Converged = false;
+	CondRelError = -1.0;
+	MSDRelError = -1.0;
+	ConvBlockCount = 0;
+	ConvBlockMCSP = 0ULL;
 }
 
 // Destructor
@@ -79,11 +87,14 @@ bool TResultsBase::IfReady()
 	return Ready;
 }
 
-// Rueckgabe von Ready und genuegend MCSP
+// Rueckgabe von Ready und genuegend MCSP (oder Konvergenzkriterium erfuellt)
 bool TResultsBase::IfCompleted(long long required_MCSP)
 {
 	if (Ready == false) return false;
 
+	// Vorzeitiges Ende durch das Konvergenzkriterium (Flag der Simulation, im Results-Abschnitt gespeichert)
+	if (Converged == true) return true;
+
 	return (MCSP >= static_cast<unsigned long long>(required_MCSP));
 }
 
@@ -176,6 +187,12 @@ int TResultsBase::MakeResults()
 	VacMeanSquaredDisp = t_results[14];
 	VacComDispVec.Set(t_results[15], t_results[16], t_results[17]);
 
+	// Konvergenzdaten einlesen (Abbruch durch das Konvergenzkriterium wird von der Simulation gemeldet)
+	ConvBlockCount = (int)t_mainphase.CurrentConvergence.BlockTime.size();
+	ConvBlockMCSP = t_mainphase.CurrentConvergence.BlockMCSP;
+	t_mainphase.CurrentConvergence.GetRelErrors(CondRelError, MSDRelError);
+	Converged = m_Job->m_Simulation->IfConverged();
+
 	Ready = true;
 	return KMCERR_OK;
 }
@@ -243,6 +260,25 @@ int TResultsBase::SaveToStream(ostream& output, int offset)
 	output << s_offset << sub_offset << KMCOUT_TRESULTS_VAC_MEANSQUAREDDISP << " " << VacMeanSquaredDisp << endl;
 	output << s_offset << sub_offset << KMCOUT_TRESULTS_VAC_COMDISPVEC << " ( " << VacComDispVec.x << " " << VacComDispVec.y << " " << VacComDispVec.z << " )" << endl;
 
+	// Ausgabe der Konvergenzdaten (nur bei Blockmittelung)
+	if (ConvBlockCount > 0)
+	{
+		output << endl;
+		output << s_offset << sub_offset << KMCOUT_TRESULTS_CONVERGED << " ";
+		if (Converged == true)
+		{
+			output << KMCOUT_TSETTINGS_DO_TRUE << endl;
+		}
+		else
+		{
+			output << KMCOUT_TSETTINGS_DO_FALSE << endl;
+		}
+		output << s_offset << sub_offset << KMCOUT_TRESULTS_COND_RELERROR << " " << CondRelError << endl;
+		output << s_offset << sub_offset << KMCOUT_TRESULTS_MSD_RELERROR << " " << MSDRelError << endl;
+		output << s_offset << sub_offset << KMCOUT_TRESULTS_CONVBLOCKCOUNT << " " << ConvBlockCount << endl;
+		output << s_offset << sub_offset << KMCOUT_TRESULTS_CONVBLOCKMCSP << " " << ConvBlockMCSP << endl;
+	}
+
 	output << s_offset << KMCOUT_TRESULTS_END << endl;
 
 	if (output.fail() == true)
@@ -294,7 +330,14 @@ int TResultsBase::LoadFromStream(istream& input)
 	double i_VacMeanSquaredDisp = VacMeanSquaredDisp;
 	T3DVector i_VacComDispVec = VacComDispVec;
 
+	bool i_Converged = false;
+	double i_CondRelError = -1.0;
+	double i_MSDRelError = -1.0;
+	int i_ConvBlockCount = 0;
+	unsigned long long i_ConvBlockMCSP = 0ULL;
+
 	string line = "";
+	TLineTokenizer linestream;
 	bool if_failed = false;
 	string s_temp = "";
 	while (input.good() == true)
@@ -306,12 +349,12 @@ int TResultsBase::LoadFromStream(istream& input)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TRESULTS_COND)
 		{
-			if ((linestream >> i_Conductivity).fail() == true)
+			if (linestream.Next(i_Conductivity) == false)
 			{
 				if_failed = true;
 				break;
@@ -319,7 +362,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_SIMTIME)
 		{
-			if ((linestream >> i_SimulatedTime).fail() == true)
+			if (linestream.Next(i_SimulatedTime) == false)
 			{
 				if_failed = true;
 				break;
@@ -332,7 +375,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_MCSP)
 		{
-			if ((linestream >> i_MCSP).fail() == true)
+			if (linestream.Next(i_MCSP) == false)
 			{
 				if_failed = true;
 				break;
@@ -340,7 +383,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_JUMPATTEMPTS)
 		{
-			if ((linestream >> i_JumpAttempts).fail() == true)
+			if (linestream.Next(i_JumpAttempts) == false)
 			{
 				if_failed = true;
 				break;
@@ -348,7 +391,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_SITEBLOCKING)
 		{
-			if ((linestream >> i_SiteBlockingCounter).fail() == true)
+			if (linestream.Next(i_SiteBlockingCounter) == false)
 			{
 				if_failed = true;
 				break;
@@ -356,7 +399,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_NONSENSEATTEMPTS)
 		{
-			if ((linestream >> i_NonsenseJumpAttempts).fail() == true)
+			if (linestream.Next(i_NonsenseJumpAttempts) == false)
 			{
 				if_failed = true;
 				break;
@@ -364,7 +407,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_OVERKILLATTEMPTS)
 		{
-			if ((linestream >> i_OverkillJumpAttempts).fail() == true)
+			if (linestream.Next(i_OverkillJumpAttempts) == false)
 			{
 				if_failed = true;
 				break;
@@ -372,7 +415,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_NORMALIZATION)
 		{
-			if ((linestream >> i_Normalization).fail() == true)
+			if (linestream.Next(i_Normalization) == false)
 			{
 				if_failed = true;
 				break;
@@ -385,47 +428,47 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_RUNTIME)
 		{
-			if ((linestream >> i_Runtime.year).fail() == true)
+			if (linestream.Next(i_Runtime.year) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "y,"
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Runtime.day).fail() == true)
+			if (linestream.Next(i_Runtime.day) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "d,"
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Runtime.hour).fail() == true)
+			if (linestream.Next(i_Runtime.hour) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "h,"
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Runtime.min).fail() == true)
+			if (linestream.Next(i_Runtime.min) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "m,"
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Runtime.sec).fail() == true)
+			if (linestream.Next(i_Runtime.sec) == false)
 			{
 				if_failed = true;
 				break;
@@ -439,7 +482,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_MOV_MEANJUMPCOUNT)
 		{
-			if ((linestream >> i_MovMeanJumpCount).fail() == true)
+			if (linestream.Next(i_MovMeanJumpCount) == false)
 			{
 				if_failed = true;
 				break;
@@ -452,23 +495,23 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_MOV_MEANDISPVEC)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
 			i_MovMeanDispVec.Set(0.0, 0.0, 0.0);
-			if ((linestream >> i_MovMeanDispVec.x).fail() == true)
+			if (linestream.Next(i_MovMeanDispVec.x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_MovMeanDispVec.y).fail() == true)
+			if (linestream.Next(i_MovMeanDispVec.y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_MovMeanDispVec.z).fail() == true)
+			if (linestream.Next(i_MovMeanDispVec.z) == false)
 			{
 				if_failed = true;
 				break;
@@ -476,7 +519,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_MOV_DISPPARALLEL)
 		{
-			if ((linestream >> i_MovDispParallel).fail() == true)
+			if (linestream.Next(i_MovDispParallel) == false)
 			{
 				if_failed = true;
 				break;
@@ -484,7 +527,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_MOV_DISPPERPENDICULAR)
 		{
-			if ((linestream >> i_MovDispPerpendicular).fail() == true)
+			if (linestream.Next(i_MovDispPerpendicular) == false)
 			{
 				if_failed = true;
 				break;
@@ -492,7 +535,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_MOV_MEANDISP)
 		{
-			if ((linestream >> i_MovMeanDisp).fail() == true)
+			if (linestream.Next(i_MovMeanDisp) == false)
 			{
 				if_failed = true;
 				break;
@@ -505,7 +548,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_MOV_MEANSQUAREDDISP)
 		{
-			if ((linestream >> i_MovMeanSquaredDisp).fail() == true)
+			if (linestream.Next(i_MovMeanSquaredDisp) == false)
 			{
 				if_failed = true;
 				break;
@@ -518,23 +561,23 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_MOV_COMDISPVEC)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
 			i_MovComDispVec.Set(0.0, 0.0, 0.0);
-			if ((linestream >> i_MovComDispVec.x).fail() == true)
+			if (linestream.Next(i_MovComDispVec.x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_MovComDispVec.y).fail() == true)
+			if (linestream.Next(i_MovComDispVec.y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_MovComDispVec.z).fail() == true)
+			if (linestream.Next(i_MovComDispVec.z) == false)
 			{
 				if_failed = true;
 				break;
@@ -542,7 +585,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_VAC_MEANJUMPCOUNT)
 		{
-			if ((linestream >> i_VacMeanJumpCount).fail() == true)
+			if (linestream.Next(i_VacMeanJumpCount) == false)
 			{
 				if_failed = true;
 				break;
@@ -555,23 +598,23 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_VAC_MEANDISPVEC)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
 			i_VacMeanDispVec.Set(0.0, 0.0, 0.0);
-			if ((linestream >> i_VacMeanDispVec.x).fail() == true)
+			if (linestream.Next(i_VacMeanDispVec.x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_VacMeanDispVec.y).fail() == true)
+			if (linestream.Next(i_VacMeanDispVec.y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_VacMeanDispVec.z).fail() == true)
+			if (linestream.Next(i_VacMeanDispVec.z) == false)
 			{
 				if_failed = true;
 				break;
@@ -579,7 +622,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_VAC_DISPPARALLEL)
 		{
-			if ((linestream >> i_VacDispParallel).fail() == true)
+			if (linestream.Next(i_VacDispParallel) == false)
 			{
 				if_failed = true;
 				break;
@@ -587,7 +630,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_VAC_DISPPERPENDICULAR)
 		{
-			if ((linestream >> i_VacDispPerpendicular).fail() == true)
+			if (linestream.Next(i_VacDispPerpendicular) == false)
 			{
 				if_failed = true;
 				break;
@@ -595,7 +638,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_VAC_MEANDISP)
 		{
-			if ((linestream >> i_VacMeanDisp).fail() == true)
+			if (linestream.Next(i_VacMeanDisp) == false)
 			{
 				if_failed = true;
 				break;
@@ -608,7 +651,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_VAC_MEANSQUAREDDISP)
 		{
-			if ((linestream >> i_VacMeanSquaredDisp).fail() == true)
+			if (linestream.Next(i_VacMeanSquaredDisp) == false)
 			{
 				if_failed = true;
 				break;
@@ -621,23 +664,76 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_VAC_COMDISPVEC)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
 			i_VacComDispVec.Set(0.0, 0.0, 0.0);
-			if ((linestream >> i_VacComDispVec.x).fail() == true)
+			if (linestream.Next(i_VacComDispVec.x) == false)
+			{
+				if_failed = true;
+				break;
+			}
+			if (linestream.Next(i_VacComDispVec.y) == false)
+			{
+				if_failed = true;
+				break;
+			}
+			if (linestream.Next(i_VacComDispVec.z) == false)
+			{
+				if_failed = true;
+				break;
+			}
+		}
+		else if (s_temp == KMCOUT_TRESULTS_CONVERGED)
+		{
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_VacComDispVec.y).fail() == true)
+			if (s_temp == KMCOUT_TSETTINGS_DO_TRUE)
+			{
+				i_Converged = true;
+			}
+			else
+			{
+				i_Converged = false;
+			}
+		}
+		else if (s_temp == KMCOUT_TRESULTS_COND_RELERROR)
+		{
+			if (linestream.Next(i_CondRelError) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_VacComDispVec.z).fail() == true)
+		}
+		else if (s_temp == KMCOUT_TRESULTS_MSD_RELERROR)
+		{
+			if (linestream.Next(i_MSDRelError) == false)
+			{
+				if_failed = true;
+				break;
+			}
+		}
+		else if (s_temp == KMCOUT_TRESULTS_CONVBLOCKCOUNT)
+		{
+			if (linestream.Next(i_ConvBlockCount) == false)
+			{
+				if_failed = true;
+				break;
+			}
+			if (i_ConvBlockCount < 0)
+			{
+				if_failed = true;
+				break;
+			}
+		}
+		else if (s_temp == KMCOUT_TRESULTS_CONVBLOCKMCSP)
+		{
+			if (linestream.Next(i_ConvBlockMCSP) == false)
 			{
 				if_failed = true;
 				break;
@@ -645,6 +741,7 @@ int TResultsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TRESULTS_END) break;
 	}
+	if ((i_Converged == true) && (i_ConvBlockCount <= 0)) if_failed = true;
 	if (if_failed == true)
 	{
 		cout << "Error: Invalid file format" << endl << endl;
@@ -678,6 +775,12 @@ int TResultsBase::LoadFromStream(istream& input)
 	VacMeanSquaredDisp = i_VacMeanSquaredDisp;
 	VacComDispVec = i_VacComDispVec;
 
+	Converged = i_Converged;
+	CondRelError = i_CondRelError;
+	MSDRelError = i_MSDRelError;
+	ConvBlockCount = i_ConvBlockCount;
+	ConvBlockMCSP = i_ConvBlockMCSP;
+
 	Ready = true;
 	return KMCERR_OK;
 }
@@ -67,6 +67,13 @@ protected:
 	double VacMeanSquaredDisp;		// <x*x + y*y + z*z> = mittlere quadratische Verschiebung in cm^2
 	T3DVector VacComDispVec;		// sum(x), sum(y), sum(z) = Schwerpunktverschiebungsvektor in cm
 
+	// Main-Results: Konvergenz (Blockmittelung, nur bei aktivem Konvergenzkriterium)
+	bool Converged;						// Flag: true = Hauptsimulation wurde durch das Konvergenzkriterium vorzeitig beendet
+	double CondRelError;				// relativer Standardfehler der Leitfaehigkeit (-1 = nicht bestimmbar)
+	double MSDRelError;					// relativer Standardfehler der MSD-Rate (-1 = nicht bestimmbar)
+	int ConvBlockCount;					// Anzahl der abgeschlossenen Bloecke (0 = keine Blockmittelung)
+	unsigned long long ConvBlockMCSP;	// MCSP je Block
+
 	bool Ready;						// Flag, ob TResults in einem korrekten Zustand, d.h. korrekt erzeugt oder geladen
 
 	// Member functions
@@ -78,7 +85,7 @@ public:
 
 	TResultsBase(TKMCJob* pJob);				// Constructor, Ready = false setzen
 	bool IfReady();							// Rueckgabe von Ready
-	bool IfCompleted(long long required_MCSP);	// Rueckgabe von Ready und genuegend MCSP
+	bool IfCompleted(long long required_MCSP);	// Rueckgabe von Ready und genuegend MCSP (oder Konvergenzkriterium erfuellt)
 	int SaveToStream(ostream& output, int offset);		// Ergebnisse in einen Stream schreiben, nur bei Ready == true moeglich (offset = zusaetzliche Leerstellen vor jeder Zeile)
 	int LoadFromStream(istream& input);				// Ergebnisse aus einem Stream laden
 
@@ -215,6 +215,45 @@ int TResultsOut::GetSummary(string i_ValDelimiter, string& o_Summary)
 
 // ***************************** PUBLIC *********************************** //
 
+// Ergebnisse als Werte ausgeben
+int TResultsOut::GetData(TResultsData& o_Data) const
+{
+	if (Ready != true) return KMCERR_NO_RESULTS;
+
+	o_Data.MCSP = MCSP;
+	o_Data.JumpAttempts = JumpAttempts;
+	o_Data.NonsenseJumpAttempts = NonsenseJumpAttempts;
+	o_Data.OverkillJumpAttempts = OverkillJumpAttempts;
+	o_Data.SiteBlockingCounter = SiteBlockingCounter;
+	o_Data.Normalization = Normalization;
+	o_Data.RuntimeSeconds = (((double(Runtime.year) * 365.0 + double(Runtime.day)) * 24.0 + double(Runtime.hour)) * 60.0 + double(Runtime.min)) * 60.0 + double(Runtime.sec);
+	o_Data.SimulatedTime = SimulatedTime;
+	o_Data.Conductivity = Conductivity;
+
+	o_Data.MovMeanJumpCount = MovMeanJumpCount;
+	o_Data.MovMeanDispVec = MovMeanDispVec;
+	o_Data.MovDispParallel = MovDispParallel;
+	o_Data.MovDispPerpendicular = MovDispPerpendicular;
+	o_Data.MovMeanDisp = MovMeanDisp;
+	o_Data.MovMeanSquaredDisp = MovMeanSquaredDisp;
+	o_Data.MovComDispVec = MovComDispVec;
+
+	o_Data.VacMeanJumpCount = VacMeanJumpCount;
+	o_Data.VacMeanDispVec = VacMeanDispVec;
+	o_Data.VacDispParallel = VacDispParallel;
+	o_Data.VacDispPerpendicular = VacDispPerpendicular;
+	o_Data.VacMeanDisp = VacMeanDisp;
+	o_Data.VacMeanSquaredDisp = VacMeanSquaredDisp;
+	o_Data.VacComDispVec = VacComDispVec;
+
+	o_Data.Converged = Converged;
+	o_Data.CondRelError = CondRelError;
+	o_Data.MSDRelError = MSDRelError;
+	o_Data.ConvBlockCount = ConvBlockCount;
+	o_Data.ConvBlockMCSP = ConvBlockMCSP;
+
+	return KMCERR_OK;
+}
 
 
 // ***************************** PRIVATE ********************************** //
\ No newline at end of file
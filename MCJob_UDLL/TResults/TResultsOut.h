@@ -21,9 +21,46 @@
 
 // Eigene Includes:
 #include "TResults/TResultsFunc.h"
+#include "T3DVector.h"
 
 using namespace std;
 
+// Ergebnisse der Hauptsimulation als Werte (z.B. fuer Programme, die die Simulation einbetten)
+struct TResultsData
+{
+	unsigned long long MCSP;					// Monte-Carlo-Steps per Particle
+	unsigned long long JumpAttempts;			// Sprungversuchsanzahl
+	unsigned long long NonsenseJumpAttempts;	// Sprungversuche mit Ruecksprungwahrscheinlichkeit >= 1
+	unsigned long long OverkillJumpAttempts;	// Sprungversuche mit Hinsprungwahrscheinlichkeit >= 1
+	unsigned long long SiteBlockingCounter;		// Sprungversuche auf besetzte Zielplaetze
+	double Normalization;						// Normierungsfaktor der Wahrscheinlichkeiten
+	double RuntimeSeconds;						// Laufzeit der Simulation in s
+	double SimulatedTime;						// Simulierte Zeitspanne in s
+	double Conductivity;						// Ionische Leitfaehigkeit in E-Feldvektorrichtung in S/cm
+
+	double MovMeanJumpCount;					// Mov: mittlere Sprunganzahl
+	T3DVector MovMeanDispVec;					// Mov: mittlerer Verschiebungsvektor in cm
+	double MovDispParallel;						// Mov: Verschiebung parallel zum E-Feld in cm
+	double MovDispPerpendicular;				// Mov: Verschiebung senkrecht zum E-Feld in cm
+	double MovMeanDisp;							// Mov: mittlere Verschiebung in cm
+	double MovMeanSquaredDisp;					// Mov: mittlere quadratische Verschiebung in cm^2
+	T3DVector MovComDispVec;					// Mov: Schwerpunktverschiebungsvektor in cm
+
+	double VacMeanJumpCount;					// Vac: mittlere Sprunganzahl
+	T3DVector VacMeanDispVec;					// Vac: mittlerer Verschiebungsvektor in cm
+	double VacDispParallel;						// Vac: Verschiebung parallel zum E-Feld in cm
+	double VacDispPerpendicular;				// Vac: Verschiebung senkrecht zum E-Feld in cm
+	double VacMeanDisp;							// Vac: mittlere Verschiebung in cm
+	double VacMeanSquaredDisp;					// Vac: mittlere quadratische Verschiebung in cm^2
+	T3DVector VacComDispVec;					// Vac: Schwerpunktverschiebungsvektor in cm
+
+	bool Converged;								// true = Hauptsimulation durch das Konvergenzkriterium vorzeitig beendet
+	double CondRelError;						// relativer Standardfehler der Leitfaehigkeit (-1 = nicht bestimmbar)
+	double MSDRelError;							// relativer Standardfehler der MSD-Rate (-1 = nicht bestimmbar)
+	int ConvBlockCount;							// Anzahl der abgeschlossenen Bloecke (0 = keine Blockmittelung)
+	unsigned long long ConvBlockMCSP;			// MCSP je Block
+};
+
 // Forward-Deklarationen:
 class TKMCJob;
 
@@ -37,6 +74,7 @@ public:
 	int GetSummary(string i_ValDelimiter, string& o_Summary);			// Wichtigste Einstellungen und Ergebnisse mit ValDelimiter getrennt ausgeben
 
 	// NON-PUBLISHED
+	int GetData(TResultsData& o_Data) const;							// Ergebnisse als Werte ausgeben
 	TResultsOut(TKMCJob* pJob);		// Constructor
 
 protected:
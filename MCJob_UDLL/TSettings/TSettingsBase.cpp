@@ -28,6 +28,7 @@
 #include "TElements/TElements.h"
 #include "TStructure/TStructure.h"
 #include "TJumps/TJumps.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -70,6 +71,12 @@ TSettingsBase::TSettingsBase(TKMCJob* pJob)
 
 	MCSP = KMCVAR_MCSP_INIT;
 	MainRecordAnz = 0;
+	ConvTargetError = KMCVAR_CONVTARGET_INIT;
+	ConvMinMCSP = KMCVAR_CONVMINMCSP_INIT;
+	DoAdaptNorm = KMCVAR_DOADAPTNORM_INIT;
+	AdaptNormBudget = KMCVAR_ADAPTNORMBUDGET_INIT;
+	ObsInterval = KMCVAR_OBSINTERVAL_INIT;
+	TrjInterval = KMCVAR_TRJINTERVAL_INIT;
 
 	Ready = false;
 }
@@ -346,31 +353,92 @@ int TSettingsBase::SetMainKMCOptions(long long i_MCSP, int i_MainRecordAnz)
 	return KMCERR_OK;
 }
 
-// Einstellungen abschlieen, d.h. Parameter validieren, Ready = true setzen
-int TSettingsBase::MakeSettings()
+// Konvergenzkriterium der Hauptsimulation eingeben
+int TSettingsBase::SetConvergenceOptions(double i_ConvTargetError, long long i_ConvMinMCSP)
 {
+	// Input prfen
+	if ((i_ConvTargetError < 0.0) || (i_ConvTargetError >= KMCVAL_TSETTINGS_MAX_CONVTARGET))
+	{
+		cout << "Error: Invalid convergence target: " << i_ConvTargetError << endl;
+		cout << "       The relative standard error has to be a number in the interval [0 , " << KMCVAL_TSETTINGS_MAX_CONVTARGET << ")" << endl << endl;
+		Ready = false;
+		return KMCERR_INVALID_INPUT;
+	}
+	if ((i_ConvMinMCSP < 1LL) || (i_ConvMinMCSP > KMCVAL_TSETTINGS_MAX_MCSP))
+	{
+		cout << "Error: Invalid minimum monte carlo steps per particle for convergence: " << i_ConvMinMCSP << endl;
+		cout << "       Convergence-MinMCSP has to be a number in the interval [1 , " << KMCVAL_TSETTINGS_MAX_MCSP << "]" << endl << endl;
+		Ready = false;
+		return KMCERR_INVALID_INPUT;
+	}
 
-	Ready = false;
-
-	// E-Feld berechnen
-	int ErrorCode = CalculateEField();
-	if (ErrorCode != KMCERR_OK) return ErrorCode;
+	// Input bertragen
+	if ((i_ConvTargetError != ConvTargetError) || (i_ConvMinMCSP != ConvMinMCSP))
+	{
+		ConvTargetError = i_ConvTargetError;
+		ConvMinMCSP = i_ConvMinMCSP;
+		Ready = false;
+	}
+	return KMCERR_OK;
+}
 
-	// Dopanden- und Leerstellenanzahlen berechnen
-	ErrorCode = CalculateDopands();
-	if (ErrorCode != KMCERR_OK) return ErrorCode;
+// Adaptive Normierung eingeben
+int TSettingsBase::SetAdaptiveNormalization(bool i_DoAdaptNorm, double i_AdaptNormBudget)
+{
+	// Input prfen
+	if ((i_AdaptNormBudget <= 0.0) || (i_AdaptNormBudget > KMCVAL_TSETTINGS_MAX_ADAPTNORMBUDGET))
+	{
+		cout << "Error: Invalid overkill budget for adaptive normalization: " << i_AdaptNormBudget << endl;
+		cout << "       The overkill fraction has to be a number in the interval (0 , " << KMCVAL_TSETTINGS_MAX_ADAPTNORMBUDGET << "]" << endl << endl;
+		Ready = false;
+		return KMCERR_INVALID_INPUT;
+	}
 
-	// Prerun-Validierung
-	if (PreMCSP == 0LL) DoPrerun = false;
+	// Input bertragen
+	if ((i_DoAdaptNorm != DoAdaptNorm) || (i_AdaptNormBudget != AdaptNormBudget))
+	{
+		DoAdaptNorm = i_DoAdaptNorm;
+		AdaptNormBudget = i_AdaptNormBudget;
+		Ready = false;
+	}
+	return KMCERR_OK;
+}
 
-	// DynNorm-Validierung
-	if (DynAttemptAnz == 0LL) DoDynNorm = false;
-	if (DynRecordAnz == 0) DoDynNorm = false;
+// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie eingeben
+int TSettingsBase::SetObservablesOptions(long long i_ObsInterval, long long i_TrjInterval)
+{
+	// Input prfen
+	if ((i_ObsInterval < 0LL) || (i_ObsInterval > KMCVAL_TSETTINGS_MAX_OBSINTERVAL))
+	{
+		cout << "Error: Invalid observables interval: " << i_ObsInterval << endl;
+		cout << "       Interval has to be an integer number in the interval [0 , " << KMCVAL_TSETTINGS_MAX_OBSINTERVAL << "] (0 = no recording)" << endl << endl;
+		Ready = false;
+		return KMCERR_INVALID_INPUT;
+	}
+	if ((i_TrjInterval < 0LL) || (i_TrjInterval > KMCVAL_TSETTINGS_MAX_TRJINTERVAL))
+	{
+		cout << "Error: Invalid trajectory interval: " << i_TrjInterval << endl;
+		cout << "       Interval has to be an integer number in the interval [0 , " << KMCVAL_TSETTINGS_MAX_TRJINTERVAL << "] (0 = no recording)" << endl << endl;
+		Ready = false;
+		return KMCERR_INVALID_INPUT;
+	}
 
-	Ready = true;
+	// Input bertragen
+	if ((i_ObsInterval != ObsInterval) || (i_TrjInterval != TrjInterval))
+	{
+		ObsInterval = i_ObsInterval;
+		TrjInterval = i_TrjInterval;
+		Ready = false;
+	}
 	return KMCERR_OK;
 }
 
+// Einstellungen abschlieen, d.h. Parameter validieren, Ready = true setzen
+int TSettingsBase::MakeSettings()
+{
+	return CompleteSettings(NULL);
+}
+
 // ***************************** PUBLIC *********************************** //
 
 // Rueckgabe von Ready
@@ -511,6 +579,24 @@ int TSettingsBase::SaveToStream(ostream& output, int offset)
 
 	output << s_offset << sub_offset << KMCOUT_TSETTINGS_MAINMCSP << " " << MCSP << endl;
 	output << s_offset << sub_offset << KMCOUT_TSETTINGS_MAINRECORDANZ << " " << MainRecordAnz << endl;
+	if (ConvTargetError > 0.0)
+	{
+		output << s_offset << sub_offset << KMCOUT_TSETTINGS_CONVTARGET << " " << ConvTargetError << endl;
+		output << s_offset << sub_offset << KMCOUT_TSETTINGS_CONVMINMCSP << " " << ConvMinMCSP << endl;
+	}
+	if (DoAdaptNorm == true)
+	{
+		output << s_offset << sub_offset << KMCOUT_TSETTINGS_DOADAPTNORM << " " << KMCOUT_TSETTINGS_DO_TRUE << endl;
+		output << s_offset << sub_offset << KMCOUT_TSETTINGS_ADAPTNORMBUDGET << " " << AdaptNormBudget << endl;
+	}
+	if (ObsInterval > 0LL)
+	{
+		output << s_offset << sub_offset << KMCOUT_TSETTINGS_OBSINTERVAL << " " << ObsInterval << endl;
+	}
+	if (TrjInterval > 0LL)
+	{
+		output << s_offset << sub_offset << KMCOUT_TSETTINGS_TRJINTERVAL << " " << TrjInterval << endl;
+	}
 
 	output << s_offset << KMCOUT_TSETTINGS_END << endl;
 
@@ -522,8 +608,8 @@ int TSettingsBase::SaveToStream(ostream& output, int offset)
 	return KMCERR_OK;
 }
 
-// Settings aus einem Stream laden
-int TSettingsBase::LoadFromStream(istream& input)
+// Settings aus einem Stream laden (i_SummaryOnly = gespeicherten E-Feld-Vektor uebernehmen, TJumps wird nicht benoetigt)
+int TSettingsBase::LoadFromStream(istream& input, bool i_SummaryOnly)
 {
 
 	// Input pruefen
@@ -555,7 +641,14 @@ int TSettingsBase::LoadFromStream(istream& input)
 	int i_DynNormNum = DynNormNum;
 	long long i_MCSP = MCSP;
 	int i_MainRecordAnz = MainRecordAnz;
+	double i_ConvTargetError = ConvTargetError;
+	long long i_ConvMinMCSP = ConvMinMCSP;
+	bool i_DoAdaptNorm = DoAdaptNorm;
+	double i_AdaptNormBudget = AdaptNormBudget;
+	long long i_ObsInterval = ObsInterval;
+	long long i_TrjInterval = TrjInterval;
 	string line = "";
+	TLineTokenizer linestream;
 	bool if_failed = false;
 	string s_temp = "";
 	int i_temp = 0;
@@ -570,12 +663,12 @@ int TSettingsBase::LoadFromStream(istream& input)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TSETTINGS_TEMPERATURE)
 		{
-			if ((linestream >> d_temp).fail() == true)
+			if (linestream.Next(d_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -584,7 +677,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_LATTICESIZE)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -593,7 +686,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_ATTEMPTFREQUENCY)
 		{
-			if ((linestream >> d_temp).fail() == true)
+			if (linestream.Next(d_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -602,7 +695,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_ADDVACANZ)
 		{
-			if ((linestream >> ll_temp).fail() == true)
+			if (linestream.Next(ll_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -611,7 +704,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_EFIELDSTRENGTH)
 		{
-			if ((linestream >> d_temp).fail() == true)
+			if (linestream.Next(d_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -620,23 +713,23 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_EFIELD)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
 			i_EField.Set(0.0, 0.0, 0.0);
-			if ((linestream >> i_EField.x).fail() == true)
+			if (linestream.Next(i_EField.x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_EField.y).fail() == true)
+			if (linestream.Next(i_EField.y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_EField.z).fail() == true)
+			if (linestream.Next(i_EField.z) == false)
 			{
 				if_failed = true;
 				break;
@@ -644,7 +737,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_CONCENTRATION)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -654,7 +747,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> d_temp).fail() == true)
+			if (linestream.Next(d_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -663,7 +756,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_WRITECHK)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -679,7 +772,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_LOADCHK)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -695,7 +788,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_DOPRERUN)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -711,7 +804,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_PREMCSP)
 		{
-			if ((linestream >> ll_temp).fail() == true)
+			if (linestream.Next(ll_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -720,7 +813,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_PRERECORDANZ)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -729,7 +822,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_DODYNNORM)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -745,7 +838,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_DYNATTEMPTANZ)
 		{
-			if ((linestream >> ll_temp).fail() == true)
+			if (linestream.Next(ll_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -754,7 +847,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_DYNRECORDANZ)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -763,7 +856,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_DYNNORMNUM)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -772,7 +865,7 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_MAINMCSP)
 		{
-			if ((linestream >> ll_temp).fail() == true)
+			if (linestream.Next(ll_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -781,13 +874,74 @@ int TSettingsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSETTINGS_MAINRECORDANZ)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
 			}
 			i_MainRecordAnz = i_temp;
 		}
+		else if (s_temp == KMCOUT_TSETTINGS_CONVTARGET)
+		{
+			if (linestream.Next(d_temp) == false)
+			{
+				if_failed = true;
+				break;
+			}
+			i_ConvTargetError = d_temp;
+		}
+		else if (s_temp == KMCOUT_TSETTINGS_CONVMINMCSP)
+		{
+			if (linestream.Next(ll_temp) == false)
+			{
+				if_failed = true;
+				break;
+			}
+			i_ConvMinMCSP = ll_temp;
+		}
+		else if (s_temp == KMCOUT_TSETTINGS_DOADAPTNORM)
+		{
+			if (linestream.Next(s_temp) == false)
+			{
+				if_failed = true;
+				break;
+			}
+			if (s_temp == KMCOUT_TSETTINGS_DO_TRUE)
+			{
+				i_DoAdaptNorm = true;
+			}
+			else
+			{
+				i_DoAdaptNorm = false;
+			}
+		}
+		else if (s_temp == KMCOUT_TSETTINGS_ADAPTNORMBUDGET)
+		{
+			if (linestream.Next(d_temp) == false)
+			{
+				if_failed = true;
+				break;
+			}
+			i_AdaptNormBudget = d_temp;
+		}
+		else if (s_temp == KMCOUT_TSETTINGS_OBSINTERVAL)
+		{
+			if (linestream.Next(ll_temp) == false)
+			{
+				if_failed = true;
+				break;
+			}
+			i_ObsInterval = ll_temp;
+		}
+		else if (s_temp == KMCOUT_TSETTINGS_TRJINTERVAL)
+		{
+			if (linestream.Next(ll_temp) == false)
+			{
+				if_failed = true;
+				break;
+			}
+			i_TrjInterval = ll_temp;
+		}
 		else if (s_temp == KMCOUT_TSETTINGS_END) break;
 	}
 	if (if_failed == true)
@@ -843,6 +997,18 @@ int TSettingsBase::LoadFromStream(istream& input)
 	MCSP = 10000;
 	int t_MainRecordAnz = MainRecordAnz;
 	MainRecordAnz = 0;
+	double t_ConvTargetError = ConvTargetError;
+	ConvTargetError = KMCVAR_CONVTARGET_INIT;
+	long long t_ConvMinMCSP = ConvMinMCSP;
+	ConvMinMCSP = KMCVAR_CONVMINMCSP_INIT;
+	bool t_DoAdaptNorm = DoAdaptNorm;
+	DoAdaptNorm = KMCVAR_DOADAPTNORM_INIT;
+	double t_AdaptNormBudget = AdaptNormBudget;
+	AdaptNormBudget = KMCVAR_ADAPTNORMBUDGET_INIT;
+	long long t_ObsInterval = ObsInterval;
+	ObsInterval = KMCVAR_OBSINTERVAL_INIT;
+	long long t_TrjInterval = TrjInterval;
+	TrjInterval = KMCVAR_TRJINTERVAL_INIT;
 	bool t_Ready = Ready;
 	Ready = false;
 
@@ -908,7 +1074,22 @@ int TSettingsBase::LoadFromStream(istream& input)
 	}
 	if (if_failed == false)
 	{
-		ErrorCode = MakeSettings();
+		ErrorCode = SetConvergenceOptions(i_ConvTargetError, i_ConvMinMCSP);
+		if (ErrorCode != KMCERR_OK) if_failed = true;
+	}
+	if (if_failed == false)
+	{
+		ErrorCode = SetAdaptiveNormalization(i_DoAdaptNorm, i_AdaptNormBudget);
+		if (ErrorCode != KMCERR_OK) if_failed = true;
+	}
+	if (if_failed == false)
+	{
+		ErrorCode = SetObservablesOptions(i_ObsInterval, i_TrjInterval);
+		if (ErrorCode != KMCERR_OK) if_failed = true;
+	}
+	if (if_failed == false)
+	{
+		ErrorCode = CompleteSettings((i_SummaryOnly == true) ? &i_EField : NULL);		// ohne Sprungmodell den gespeicherten E-Feld-Vektor verwenden
 		if (ErrorCode != KMCERR_OK) if_failed = true;
 	}
 
@@ -938,6 +1119,12 @@ int TSettingsBase::LoadFromStream(istream& input)
 		DynNormNum = t_DynNormNum;
 		MCSP = t_MCSP;
 		MainRecordAnz = t_MainRecordAnz;
+		ConvTargetError = t_ConvTargetError;
+		ConvMinMCSP = t_ConvMinMCSP;
+		DoAdaptNorm = t_DoAdaptNorm;
+		AdaptNormBudget = t_AdaptNormBudget;
+		ObsInterval = t_ObsInterval;
+		TrjInterval = t_TrjInterval;
 		Ready = t_Ready;
 		return ErrorCode;
 	}
@@ -997,6 +1184,39 @@ int TSettingsBase::SyncDopandVectors()
 
 // ***************************** PRIVATE ********************************** //
 
+// Einstellungen abschliessen (i_EField != NULL: E-Feld-Vektor uebernehmen statt aus TJumps berechnen, z.B. fuer die Ergebnisausgabe ohne Sprungmodell)
+int TSettingsBase::CompleteSettings(T3DVector* i_EField)
+{
+
+	Ready = false;
+
+	// E-Feld berechnen
+	int ErrorCode = KMCERR_OK;
+	if (i_EField == NULL)
+	{
+		ErrorCode = CalculateEField();
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+	}
+	else
+	{
+		EField = *i_EField;
+	}
+
+	// Dopanden- und Leerstellenanzahlen berechnen
+	ErrorCode = CalculateDopands();
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+	// Prerun-Validierung
+	if (PreMCSP == 0LL) DoPrerun = false;
+
+	// DynNorm-Validierung
+	if (DynAttemptAnz == 0LL) DoDynNorm = false;
+	if (DynRecordAnz == 0) DoDynNorm = false;
+
+	Ready = true;
+	return KMCERR_OK;
+}
+
 // E-Feld berechnen
 int TSettingsBase::CalculateEField()
 {
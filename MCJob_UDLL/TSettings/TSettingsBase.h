@@ -69,6 +69,12 @@ protected:
 	// KMC-Simulationseinstellungen
 	long long MCSP;				// Ziel-MCSP der Hauptsimulation: Monte-Carlo-Steps per Particle (d.h. per Mov-Elem im Gitter)
 	int MainRecordAnz;			// Anzahl an aufzuzeichnenden, hoechsten Boltzmann-Wahrscheinlichkeiten bei Hauptsimulation
+	double ConvTargetError;		// Zielfehler (relativer Standardfehler) fuer den vorzeitigen Abbruch der Hauptsimulation (0 = kein vorzeitiger Abbruch)
+	long long ConvMinMCSP;		// Mindest-MCSP der Hauptsimulation vor einem vorzeitigen Abbruch
+	bool DoAdaptNorm;			// Flag: true = Normierung waehrend Vorlauf und beginnender Hauptsimulation adaptiv anheben (statt DynNorm-Phase)
+	double AdaptNormBudget;		// erlaubter Anteil an Sprungversuchen mit normierter Wahrscheinlichkeit >= 1 (adaptive Normierung)
+	long long ObsInterval;		// Intervall [MCSP] fuer die Aufzeichnung der Observablen-Zeitreihe der Hauptsimulation (0 = keine Aufzeichnung)
+	long long TrjInterval;		// Intervall [MCSP] fuer die Aufzeichnung der Gittertrajektorie der Hauptsimulation (0 = keine Aufzeichnung)
 
 	bool Ready;					// Flag, ob alle Einstellungen gesetzt wurden
 
@@ -87,6 +93,9 @@ public:
 	int SetPrerunOptions(bool i_DoPrerun, long long i_PreMCSP, int i_PreRecordAnz);											// KMC-Vorlaufparameter einstellen
 	int SetDynNormParameters(bool i_DoDynNorm, long long i_DynNormAttemptAnz, int i_DynNormRecordAnz, int i_DynNormNum);		// Parameter fr dyn. Normierungssimulation setzen
 	int SetMainKMCOptions(long long i_MCSP, int i_MainRecordAnz);																// KMC-Hauptsimulationsparameter eingeben
+	int SetConvergenceOptions(double i_ConvTargetError, long long i_ConvMinMCSP);												// Konvergenzkriterium der Hauptsimulation eingeben
+	int SetAdaptiveNormalization(bool i_DoAdaptNorm, double i_AdaptNormBudget);												// Adaptive Normierung eingeben
+	int SetObservablesOptions(long long i_ObsInterval, long long i_TrjInterval);											// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie eingeben
 
 	int MakeSettings();																		// Einstellungen abschlieen, d.h. Parameter validieren, Ready = true setzen
 
@@ -94,7 +103,7 @@ public:
 	TSettingsBase(TKMCJob* pJob);						// Constructor, Ready = false setzen
 	bool IfReady();									// Rueckgabe von Ready
 	int SaveToStream(ostream& output, int offset);		// Einstellungen in einen Stream schreiben, nur bei Ready == true moeglich (offset = zusaetzliche Leerstellen vor jeder Zeile)
-	int LoadFromStream(istream& input);				// Einstellungen aus einem Stream laden, nur bei Ready == false moeglich
+	int LoadFromStream(istream& input, bool i_SummaryOnly = false);		// Einstellungen aus einem Stream laden, nur bei Ready == false moeglich (i_SummaryOnly = gespeicherten E-Feld-Vektor uebernehmen, TJumps wird nicht benoetigt)
 
 protected:
 	// PROTECTED
@@ -103,6 +112,7 @@ protected:
 
 private:
 	// PRIVATE
+	int CompleteSettings(T3DVector* i_EField);	// Einstellungen abschliessen (i_EField != NULL: E-Feld-Vektor uebernehmen statt aus TJumps berechnen)
 	int CalculateEField();					// E-Feld berechnen
 	int CalculateDopands();					// Dopandenkonzentrationen validieren und ihre Anzahlen berechnen
 };
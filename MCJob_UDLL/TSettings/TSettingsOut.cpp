@@ -220,6 +220,36 @@ int TSettingsOut::GetMainKMCOptions(long long& o_MCSP, int& o_MainRecordAnz)
 	return KMCERR_OK;
 }
 
+// Konvergenzkriterium der Hauptsimulation ausgeben
+int TSettingsOut::GetConvergenceOptions(double& o_ConvTargetError, long long& o_ConvMinMCSP)
+{
+
+	o_ConvTargetError = ConvTargetError;
+	o_ConvMinMCSP = ConvMinMCSP;
+
+	return KMCERR_OK;
+}
+
+// Adaptive Normierung ausgeben
+int TSettingsOut::GetAdaptiveNormalization(bool& o_DoAdaptNorm, double& o_AdaptNormBudget)
+{
+
+	o_DoAdaptNorm = DoAdaptNorm;
+	o_AdaptNormBudget = AdaptNormBudget;
+
+	return KMCERR_OK;
+}
+
+// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie ausgeben
+int TSettingsOut::GetObservablesOptions(long long& o_ObsInterval, long long& o_TrjInterval)
+{
+
+	o_ObsInterval = ObsInterval;
+	o_TrjInterval = TrjInterval;
+
+	return KMCERR_OK;
+}
+
 // ***************************** PUBLIC *********************************** //
 
 
@@ -50,6 +50,9 @@ public:
 	int GetPrerunOptions(bool& o_DoPrerun, long long& o_PreMCSP, int& o_PreRecordAnz);												// KMC-Vorlaufparameter ausgeben
 	int GetDynNormParameters(bool& o_DoDynNorm, long long& o_DynNormAttemptAnz, int& o_DynNormRecordAnz, int& o_DynNormNum);		// Parameter fr dyn. Normierungssimulation ausgeben
 	int GetMainKMCOptions(long long& o_MCSP, int& o_MainRecordAnz);																// KMC-Hauptsimulationsparameter ausgeben
+	int GetConvergenceOptions(double& o_ConvTargetError, long long& o_ConvMinMCSP);												// Konvergenzkriterium der Hauptsimulation ausgeben
+	int GetAdaptiveNormalization(bool& o_DoAdaptNorm, double& o_AdaptNormBudget);												// Adaptive Normierung ausgeben
+	int GetObservablesOptions(long long& o_ObsInterval, long long& o_TrjInterval);											// Aufzeichnung der Observablen-Zeitreihe und der Gittertrajektorie ausgeben
 
 	// NON-PUBLISHED
 	TSettingsOut(TKMCJob* pJob);		// Constructor
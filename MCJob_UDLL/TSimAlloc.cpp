@@ -0,0 +1,344 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimAlloc												//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Memory for the large simulation arrays (lattices, vacancy		//
+//    lists, code energies): fresh page-aligned mappings with		//
+//    (explicit or transparent) huge pages, first touched by the	//
+//    thread that fills them (= simulating thread, NUMA-local)		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TSimAlloc.h"
+
+// Includes:
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+
+// Windows-Includes
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+
+#include <Windows.h>
+
+#endif
+
+// Linux-Includes
+#if (defined(__linux__) || defined(__linux))
+
+#include <unistd.h>
+#include <sys/mman.h>
+
+#endif
+
+// Eigene Includes:
+
+using namespace std;
+
+// Verwaltungsdaten vor jedem Speicherblock (64 Bytes, damit die Daten ausgerichtet bleiben)
+namespace
+{
+	constexpr size_t SIMALLOC_HEADER_SIZE = 64;
+
+	enum class TSimAllocKind : size_t
+	{
+		Heap = 0,			// normaler Heap (kleine Arrays)
+		Mapped = 1,			// eigener Speicherbereich mit normalen Seiten bzw. transparenten Huge Pages
+		HugeTLB = 2			// eigener Speicherbereich mit expliziten Huge Pages (Linux: hugetlbfs, Windows: Large Pages)
+	};
+
+	struct TSimAllocHeader
+	{
+		size_t MapBytes;			// Groesse des gesamten Speicherbereichs (incl. Verwaltungsdaten)
+		TSimAllocKind Kind;			// Art des Speicherbereichs
+	};
+
+	// Groesse auf Vielfaches von i_Align aufrunden
+	size_t RoundUp(size_t i_Bytes, size_t i_Align)
+	{
+		return ((i_Bytes + i_Align - 1) / i_Align) * i_Align;
+	}
+
+	// Verwaltungsdaten eines Speicherblocks
+	TSimAllocHeader* GetHeader(const void* i_Ptr)
+	{
+		return reinterpret_cast<TSimAllocHeader*>(const_cast<char*>(static_cast<const char*>(i_Ptr)) - SIMALLOC_HEADER_SIZE);
+	}
+
+	// Speicherblock hinter den Verwaltungsdaten
+	void* SetHeader(void* i_Base, size_t i_MapBytes, TSimAllocKind i_Kind)
+	{
+		TSimAllocHeader* t_Header = static_cast<TSimAllocHeader*>(i_Base);
+		t_Header->MapBytes = i_MapBytes;
+		t_Header->Kind = i_Kind;
+		return static_cast<char*>(i_Base) + SIMALLOC_HEADER_SIZE;
+	}
+
+	// Normale Seitengroesse des Systems
+	size_t GetBasePageSize()
+	{
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+		SYSTEM_INFO t_info;
+		GetSystemInfo(&t_info);
+		return (size_t)t_info.dwPageSize;
+#elif (defined(__linux__) || defined(__linux))
+		long t_pagesize = sysconf(_SC_PAGESIZE);
+		return (t_pagesize > 0) ? (size_t)t_pagesize : 4096;
+#else
+		return 4096;
+#endif
+	}
+
+#if (defined(__linux__) || defined(__linux))
+
+	// Zahlenwert aus einer Datei lesen (0 = nicht verfuegbar)
+	size_t ReadSizeFromFile(const char* i_Path)
+	{
+		ifstream t_file(i_Path);
+		size_t t_value = 0;
+		if ((t_file >> t_value).fail() == true) return 0;
+		return t_value;
+	}
+
+	// Groesse der expliziten Huge Pages (hugetlbfs) in Bytes (0 = nicht verfuegbar)
+	size_t GetHugeTLBPageSize()
+	{
+		static const size_t HugeTLBPageSize = []()
+		{
+			ifstream t_meminfo("/proc/meminfo");
+			string t_line;
+			while (getline(t_meminfo, t_line))
+			{
+				if (t_line.compare(0, 13, "Hugepagesize:") != 0) continue;
+				istringstream t_stream(t_line.substr(13));
+				size_t t_kb = 0;
+				if ((t_stream >> t_kb).fail() == true) return size_t(0);
+				return t_kb * 1024;
+			}
+			return size_t(0);
+		}();
+		return HugeTLBPageSize;
+	}
+
+#endif
+}
+
+// ***************************** PUBLIC *********************************** //
+
+// Speicher anfordern (NULL = Fehler), ab einer Huge Page als eigener Speicherbereich mit Huge Pages:
+// -> frische Seiten werden erst beim ersten Schreiben physisch angelegt, d.h. auf dem NUMA-Knoten des Threads,
+//    der das Array fuellt (Heap-Speicher kann dagegen schon von anderen Threads beruehrt worden sein)
+// -> Reihenfolge: explizite Huge Pages (falls vom Administrator reserviert), transparente Huge Pages, normale Seiten
+void* TSimAlloc::Allocate(size_t i_Bytes)
+{
+	if (i_Bytes > size_t(-1) / 2) return NULL;
+	size_t t_Bytes = i_Bytes + SIMALLOC_HEADER_SIZE;
+
+	// Kleine Arrays auf dem Heap
+	size_t t_HugePageSize = GetHugePageSize();
+	if ((t_HugePageSize == 0) || (t_Bytes < t_HugePageSize))
+	{
+		void* t_Base = ::operator new(t_Bytes, nothrow);
+		if (t_Base == NULL) return NULL;
+		return SetHeader(t_Base, t_Bytes, TSimAllocKind::Heap);
+	}
+
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+
+	// Large Pages (nur mit SeLockMemoryPrivilege)
+	size_t t_LargePageSize = (size_t)GetLargePageMinimum();
+	if (t_LargePageSize != 0)
+	{
+		size_t t_MapBytes = RoundUp(t_Bytes, t_LargePageSize);
+		void* t_Base = VirtualAlloc(NULL, t_MapBytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+		if (t_Base != NULL) return SetHeader(t_Base, t_MapBytes, TSimAllocKind::HugeTLB);
+	}
+
+	// Normale Seiten
+	size_t t_MapBytes = RoundUp(t_Bytes, GetBasePageSize());
+	void* t_Base = VirtualAlloc(NULL, t_MapBytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	if (t_Base == NULL) return NULL;
+	return SetHeader(t_Base, t_MapBytes, TSimAllocKind::Mapped);
+
+#elif (defined(__linux__) || defined(__linux))
+
+	// Explizite Huge Pages (hugetlbfs, scheitert sofort ohne reservierte Seiten)
+	size_t t_HugeTLBPageSize = GetHugeTLBPageSize();
+	if (t_HugeTLBPageSize != 0)
+	{
+		size_t t_MapBytes = RoundUp(t_Bytes, t_HugeTLBPageSize);
+		void* t_Base = mmap(NULL, t_MapBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (t_Base != MAP_FAILED) return SetHeader(t_Base, t_MapBytes, TSimAllocKind::HugeTLB);
+	}
+
+	// Transparente Huge Pages: Bereich auf Huge-Page-Grenze ausrichten, ueberstehende Teile freigeben
+	size_t t_MapBytes = RoundUp(t_Bytes, t_HugePageSize);
+	void* t_Raw = mmap(NULL, t_MapBytes + t_HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (t_Raw == MAP_FAILED) return NULL;
+	char* t_Base = reinterpret_cast<char*>(RoundUp(reinterpret_cast<uintptr_t>(t_Raw), t_HugePageSize));
+	size_t t_Head = (size_t)(t_Base - static_cast<char*>(t_Raw));
+	if (t_Head != 0) munmap(t_Raw, t_Head);
+	if (t_HugePageSize - t_Head != 0) munmap(t_Base + t_MapBytes, t_HugePageSize - t_Head);
+#ifdef MADV_HUGEPAGE
+	madvise(t_Base, t_MapBytes, MADV_HUGEPAGE);			// ohne Erfolg (THP deaktiviert) normale Seiten
+#endif
+	return SetHeader(t_Base, t_MapBytes, TSimAllocKind::Mapped);
+
+#else
+
+	void* t_Base = ::operator new(t_Bytes, nothrow);
+	if (t_Base == NULL) return NULL;
+	return SetHeader(t_Base, t_Bytes, TSimAllocKind::Heap);
+
+#endif
+}
+
+// Mit Allocate angeforderten Speicher freigeben (NULL erlaubt)
+void TSimAlloc::Free(void* i_Ptr)
+{
+	if (i_Ptr == NULL) return;
+	TSimAllocHeader* t_Header = GetHeader(i_Ptr);
+
+	if (t_Header->Kind == TSimAllocKind::Heap)
+	{
+		::operator delete(static_cast<void*>(t_Header));
+		return;
+	}
+
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+	VirtualFree(static_cast<void*>(t_Header), 0, MEM_RELEASE);
+#elif (defined(__linux__) || defined(__linux))
+	munmap(static_cast<void*>(t_Header), t_Header->MapBytes);
+#endif
+}
+
+// Groesse des Speicherbereichs in Bytes (0 = NULL)
+size_t TSimAlloc::GetBlockSize(const void* i_Ptr)
+{
+	if (i_Ptr == NULL) return 0;
+	return GetHeader(i_Ptr)->MapBytes;
+}
+
+// Groesse einer Huge Page in Bytes
+size_t TSimAlloc::GetHugePageSize()
+{
+	static const size_t HugePageSize = []()
+	{
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+		size_t t_size = (size_t)GetLargePageMinimum();
+		return (t_size != 0) ? t_size : size_t(2097152);
+#elif (defined(__linux__) || defined(__linux))
+		size_t t_size = ReadSizeFromFile("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+		return (t_size != 0) ? t_size : size_t(2097152);
+#else
+		return size_t(2097152);
+#endif
+	}();
+	return HugePageSize;
+}
+
+// Tatsaechlich erhaltene Seitengroesse in Bytes (0 = unbekannt), o_HugeShare = Anteil in Huge Pages
+// (transparente Huge Pages: Auswertung von /proc/self/smaps, d.h. Stand der bisher beruehrten Seiten)
+size_t TSimAlloc::GetPageSize(const void* i_Ptr, double* o_HugeShare)
+{
+	if (o_HugeShare != NULL) *o_HugeShare = 0.0;
+	if (i_Ptr == NULL) return 0;
+	TSimAllocHeader* t_Header = GetHeader(i_Ptr);
+
+	if (t_Header->Kind == TSimAllocKind::Heap) return GetBasePageSize();
+	if (t_Header->Kind == TSimAllocKind::HugeTLB)
+	{
+		if (o_HugeShare != NULL) *o_HugeShare = 1.0;
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+		return (size_t)GetLargePageMinimum();
+#elif (defined(__linux__) || defined(__linux))
+		return GetHugeTLBPageSize();
+#else
+		return 0;
+#endif
+	}
+
+#if (defined(__linux__) || defined(__linux))
+
+	// Speicherbereich in /proc/self/smaps suchen
+	uintptr_t t_Addr = reinterpret_cast<uintptr_t>(t_Header);
+	ifstream t_smaps("/proc/self/smaps");
+	string t_line;
+	bool t_found = false;
+	size_t t_rss = 0;
+	size_t t_anonhuge = 0;
+	size_t t_kernelpage = 0;
+	while (getline(t_smaps, t_line))
+	{
+		// Kopfzeile eines Speicherbereichs: "start-end perms ..."
+		size_t t_dash = t_line.find('-');
+		size_t t_space = t_line.find(' ');
+		if ((t_dash != string::npos) && (t_space != string::npos) && (t_dash < t_space) && (t_line.find(':') > t_space))
+		{
+			if (t_found == true) break;
+			uintptr_t t_start = (uintptr_t)strtoull(t_line.substr(0, t_dash).c_str(), NULL, 16);
+			uintptr_t t_end = (uintptr_t)strtoull(t_line.substr(t_dash + 1, t_space - t_dash - 1).c_str(), NULL, 16);
+			t_found = ((t_Addr >= t_start) && (t_Addr < t_end));
+			continue;
+		}
+		if (t_found == false) continue;
+
+		istringstream t_stream(t_line);
+		string t_key;
+		size_t t_kb = 0;
+		if ((t_stream >> t_key >> t_kb).fail() == true) continue;
+		if (t_key == "Rss:") t_rss = t_kb;
+		if (t_key == "AnonHugePages:") t_anonhuge = t_kb;
+		if (t_key == "KernelPageSize:") t_kernelpage = t_kb * 1024;
+	}
+	if (t_found == false) return 0;
+	if (t_kernelpage == 0) t_kernelpage = GetBasePageSize();
+	if ((t_anonhuge == 0) || (t_rss == 0)) return t_kernelpage;
+	if (o_HugeShare != NULL) *o_HugeShare = (t_anonhuge >= t_rss) ? 1.0 : double(t_anonhuge) / double(t_rss);
+	return GetHugePageSize();
+
+#else
+
+	return GetBasePageSize();
+
+#endif
+}
+
+// Erhaltene Seitengroesse als Text (z.B. "2 MB (98 % huge pages)")
+string TSimAlloc::GetPageInfo(const void* i_Ptr)
+{
+	double t_HugeShare = 0.0;
+	size_t t_PageSize = GetPageSize(i_Ptr, &t_HugeShare);
+	if (t_PageSize == 0) return "unknown";
+
+	ostringstream t_info;
+	if (t_PageSize >= 1073741824)
+	{
+		t_info << (t_PageSize / 1073741824) << " GB";
+	}
+	else if (t_PageSize >= 1048576)
+	{
+		t_info << (t_PageSize / 1048576) << " MB";
+	}
+	else
+	{
+		t_info << (t_PageSize / 1024) << " kB";
+	}
+	if (t_HugeShare > 0.0)
+	{
+		t_info << " (" << fixed << setprecision(0) << 100.0 * t_HugeShare << " % huge pages)";
+	}
+	else if (GetHeader(i_Ptr)->Kind == TSimAllocKind::Heap)
+	{
+		t_info << " (heap)";
+	}
+	return t_info.str();
+}
@@ -0,0 +1,103 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimAlloc												//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Memory for the large simulation arrays (lattices, vacancy		//
+//    lists, code energies): fresh page-aligned mappings with		//
+//    (explicit or transparent) huge pages, first touched by the	//
+//    thread that fills them (= simulating thread, NUMA-local)		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TSimAlloc_H
+#define TSimAlloc_H
+
+// Includes:
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TSimAlloc
+{
+	// Member functions
+public:
+
+	// Static member functions
+	static void* Allocate(size_t i_Bytes);												// Speicher anfordern (NULL = Fehler), ab einer Huge Page als eigener Speicherbereich mit Huge Pages
+	static void Free(void* i_Ptr);														// Mit Allocate angeforderten Speicher freigeben (NULL erlaubt)
+	static size_t GetBlockSize(const void* i_Ptr);										// Groesse des Speicherbereichs in Bytes (0 = NULL)
+	static size_t GetHugePageSize();													// Groesse einer Huge Page in Bytes
+	static size_t GetPageSize(const void* i_Ptr, double* o_HugeShare = NULL);			// Tatsaechlich erhaltene Seitengroesse in Bytes (0 = unbekannt), o_HugeShare = Anteil in Huge Pages
+	static string GetPageInfo(const void* i_Ptr);										// Erhaltene Seitengroesse als Text (z.B. "2 MB (98 % huge pages)")
+
+	template <typename T>
+	static T* New(size_t i_Count)
+	{																					// Array anlegen und mit T() initialisieren (NULL = Fehler)
+		static_assert(is_trivially_destructible<T>::value == true, "TSimAlloc::New requires trivially destructible types");
+		if (i_Count == 0) return NULL;
+		if (i_Count > size_t(-1) / sizeof(T)) return NULL;
+		T* o_Array = static_cast<T*>(Allocate(i_Count * sizeof(T)));
+		if (o_Array == NULL) return NULL;
+		for (size_t i = 0; i < i_Count; i++)
+		{
+			new (o_Array + i) T();
+		}
+		return o_Array;
+	}
+
+	template <typename T>
+	static void Delete(T* i_Array)
+	{																					// Mit New angelegtes Array freigeben (NULL erlaubt)
+		Free(static_cast<void*>(i_Array));
+	}
+};
+
+// Allokator fuer Standardcontainer (z.B. vector<T, TSimAllocator<T>>)
+template <typename T>
+class TSimAllocator
+{
+public:
+	typedef T value_type;
+
+	TSimAllocator() noexcept
+	{
+	}
+	template <typename U>
+	TSimAllocator(const TSimAllocator<U>&) noexcept
+	{
+	}
+	T* allocate(size_t i_Count)
+	{									// Speicher fuer i_Count Elemente anfordern
+		if (i_Count > size_t(-1) / sizeof(T)) throw bad_alloc();
+		void* t_Ptr = TSimAlloc::Allocate(i_Count * sizeof(T));
+		if (t_Ptr == NULL) throw bad_alloc();
+		return static_cast<T*>(t_Ptr);
+	}
+	void deallocate(T* i_Ptr, size_t) noexcept
+	{									// Speicher freigeben
+		TSimAlloc::Free(static_cast<void*>(i_Ptr));
+	}
+	template <typename U>
+	bool operator == (const TSimAllocator<U>&) const noexcept
+	{									// zustandslos, alle Instanzen gleich
+		return true;
+	}
+	template <typename U>
+	bool operator != (const TSimAllocator<U>&) const noexcept
+	{
+		return false;
+	}
+};
+
+#endif
@@ -0,0 +1,34 @@
+// **************************************************************** //
+//																	//
+//	Struct: TSimCallbacks											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Optional callbacks of a running simulation (progress and		//
+//    observables), e.g. for programs embedding the simulation		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TSimCallbacks_H
+#define TSimCallbacks_H
+
+// Includes:
+#include <functional>
+
+// Eigene Includes:
+#include "TSimulation/TSimTelemetry.h"
+#include "TSimulation/TSimObservables.h"
+
+using namespace std;
+
+// Strukturdeklaration (leere Funktionen = kein Aufruf, Aufruf erfolgt im simulierenden Thread):
+struct TSimCallbacks
+{
+	function<void(const TSimTelemetryCounters&)> Progress;		// einmal pro MCSP (bzw. Schleifendurchlauf) und am Ende jeder Phase
+	function<void(const TSimObsSample&)> Observables;			// je Messpunkt der Observablen-Zeitreihe (Hauptsimulation, ObservablesInterval > 0)
+};
+
+#endif
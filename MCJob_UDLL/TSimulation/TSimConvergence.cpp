@@ -0,0 +1,180 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimConvergence											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Data class for the block averaging of the main simulation,	//
+//	  used for the online convergence check						//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TSimConvergence.h"
+
+// Includes:
+#include <cmath>
+#include <utility>
+
+// Eigene Includes:
+#include "GlobalDefinitions.h"
+
+using namespace std;
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor
+TSimConvergence::TSimConvergence()
+{
+
+	Clear();
+}
+
+// Destructor
+TSimConvergence::~TSimConvergence()
+{
+
+}
+
+// ************************* MEMBER FUNCTIONS****************************** //
+
+// Alle Daten auf Standardwerte setzen
+void TSimConvergence::Clear()
+{
+
+	BlockMCSP = 1ULL;
+	BlockDisp.clear();
+	BlockSqDisp.clear();
+	BlockTime.clear();
+	OpenMCSP = 0ULL;
+	OpenDisp = 0.0;
+	OpenSqDisp = 0.0;
+	OpenTime = 0.0;
+
+}
+
+// Alle Daten mit io_conv tauschen
+void TSimConvergence::Swap(TSimConvergence& io_conv)
+{
+
+	std::swap(BlockMCSP, io_conv.BlockMCSP);
+	BlockDisp.swap(io_conv.BlockDisp);
+	BlockSqDisp.swap(io_conv.BlockSqDisp);
+	BlockTime.swap(io_conv.BlockTime);
+	std::swap(OpenMCSP, io_conv.OpenMCSP);
+	std::swap(OpenDisp, io_conv.OpenDisp);
+	std::swap(OpenSqDisp, io_conv.OpenSqDisp);
+	std::swap(OpenTime, io_conv.OpenTime);
+}
+
+// true = noch kein MCSP aufgezeichnet
+bool TSimConvergence::IsEmpty() const
+{
+
+	return ((BlockTime.size() == 0) && (OpenMCSP == 0ULL));
+}
+
+// Alle Zeitbeitraege mit i_factor skalieren (bei Aenderung der Normierung waehrend der Simulation)
+void TSimConvergence::ScaleTime(double i_factor)
+{
+
+	for (size_t i = 0; i < BlockTime.size(); i++)
+	{
+		BlockTime[i] *= i_factor;
+	}
+	OpenTime *= i_factor;
+}
+
+// Beitraege eines MCSP hinzufuegen (true = Block abgeschlossen)
+bool TSimConvergence::AddMCSP(double i_disp, double i_sqdisp, double i_time)
+{
+
+	OpenDisp += i_disp;
+	OpenSqDisp += i_sqdisp;
+	OpenTime += i_time;
+	++OpenMCSP;
+	if (OpenMCSP < BlockMCSP) return false;
+
+	// Block abschliessen
+	BlockDisp.push_back(OpenDisp);
+	BlockSqDisp.push_back(OpenSqDisp);
+	BlockTime.push_back(OpenTime);
+	OpenMCSP = 0ULL;
+	OpenDisp = 0.0;
+	OpenSqDisp = 0.0;
+	OpenTime = 0.0;
+
+	// Bei Erreichen der maximalen Blockanzahl je zwei Bloecke zusammenfassen (-> Speicherbedarf unabhaengig von der Simulationsdauer)
+	if ((int)BlockTime.size() >= KMCVAR_CONV_MAXBLOCKS)
+	{
+		size_t t_half = BlockTime.size() / 2;
+		for (size_t i = 0; i < t_half; i++)
+		{
+			BlockDisp[i] = BlockDisp[2 * i] + BlockDisp[2 * i + 1];
+			BlockSqDisp[i] = BlockSqDisp[2 * i] + BlockSqDisp[2 * i + 1];
+			BlockTime[i] = BlockTime[2 * i] + BlockTime[2 * i + 1];
+		}
+		BlockDisp.resize(t_half);
+		BlockSqDisp.resize(t_half);
+		BlockTime.resize(t_half);
+		BlockMCSP *= 2ULL;
+	}
+
+	return true;
+}
+
+// Relative Standardfehler von Leitfaehigkeit und MSD-Rate (false = zu wenige Bloecke, -1 = nicht bestimmbar)
+// Die Blockraten Verschiebung/Zeit bzw. Verschiebungsquadrat/Zeit werden als unabhaengige Stichproben behandelt,
+// relativer Standardfehler = sqrt(Varianz / Blockanzahl) / |Mittelwert|
+bool TSimConvergence::GetRelErrors(double& o_cond_relerr, double& o_msd_relerr) const
+{
+
+	o_cond_relerr = -1.0;
+	o_msd_relerr = -1.0;
+	int t_count = (int)BlockTime.size();
+	if (t_count < KMCVAR_CONV_MINBLOCKS) return false;
+
+	double t_cond_mean = 0.0;
+	double t_msd_mean = 0.0;
+	for (int i = 0; i < t_count; i++)
+	{
+		if (BlockTime[i] <= 0.0) return false;
+		t_cond_mean += BlockDisp[i] / BlockTime[i];
+		t_msd_mean += BlockSqDisp[i] / BlockTime[i];
+	}
+	t_cond_mean /= double(t_count);
+	t_msd_mean /= double(t_count);
+
+	double t_cond_var = 0.0;
+	double t_msd_var = 0.0;
+	for (int i = 0; i < t_count; i++)
+	{
+		double t_cond_dev = BlockDisp[i] / BlockTime[i] - t_cond_mean;
+		double t_msd_dev = BlockSqDisp[i] / BlockTime[i] - t_msd_mean;
+		t_cond_var += t_cond_dev * t_cond_dev;
+		t_msd_var += t_msd_dev * t_msd_dev;
+	}
+	t_cond_var /= double(t_count - 1);
+	t_msd_var /= double(t_count - 1);
+
+	if (fabs(t_cond_mean) > 0.0) o_cond_relerr = sqrt(t_cond_var / double(t_count)) / fabs(t_cond_mean);
+	if (fabs(t_msd_mean) > 0.0) o_msd_relerr = sqrt(t_msd_var / double(t_count)) / fabs(t_msd_mean);
+
+	return true;
+}
+
+// true = relativer Standardfehler <= i_target (Leitfaehigkeit oder MSD-Rate)
+bool TSimConvergence::IfConverged(double i_target, bool i_use_cond) const
+{
+
+	if (i_target <= 0.0) return false;
+	double t_cond_relerr = -1.0;
+	double t_msd_relerr = -1.0;
+	if (GetRelErrors(t_cond_relerr, t_msd_relerr) == false) return false;
+	double t_relerr = (i_use_cond == true) ? t_cond_relerr : t_msd_relerr;
+
+	return ((t_relerr >= 0.0) && (t_relerr <= i_target));
+}
@@ -0,0 +1,54 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimConvergence											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Data class for the block averaging of the main simulation,	//
+//	  used for the online convergence check						//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TSimConvergence_H
+#define TSimConvergence_H
+
+// Includes:
+#include <vector>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TSimConvergence
+{
+public:
+
+	// Variablen:
+	unsigned long long BlockMCSP;			// MCSP je Block (verdoppelt sich bei jeder Blockzusammenfassung)
+	vector<double> BlockDisp;				// Summe der Verschiebungen parallel zum E-Feld je abgeschlossenem Block (bewegliche Spezies)
+	vector<double> BlockSqDisp;				// Zuwachs der Summe der Verschiebungsquadrate je abgeschlossenem Block (bewegliche Spezies)
+	vector<double> BlockTime;				// Zuwachs von AttemptPathRatioSum je abgeschlossenem Block
+	unsigned long long OpenMCSP;			// MCSP im offenen Block
+	double OpenDisp;						// Summe der Verschiebungen parallel zum E-Feld im offenen Block
+	double OpenSqDisp;						// Zuwachs der Summe der Verschiebungsquadrate im offenen Block
+	double OpenTime;						// Zuwachs von AttemptPathRatioSum im offenen Block
+
+	// Member functions:
+	void Clear();															// Alle Daten auf Standardwerte setzen
+	void Swap(TSimConvergence& io_conv);									// Alle Daten mit io_conv tauschen
+	bool IsEmpty() const;													// true = noch kein MCSP aufgezeichnet
+	void ScaleTime(double i_factor);										// Alle Zeitbeitraege mit i_factor skalieren (bei Aenderung der Normierung)
+	bool AddMCSP(double i_disp, double i_sqdisp, double i_time);			// Beitraege eines MCSP hinzufuegen (true = Block abgeschlossen)
+	bool GetRelErrors(double& o_cond_relerr, double& o_msd_relerr) const;	// Relative Standardfehler von Leitfaehigkeit und MSD-Rate (false = zu wenige Bloecke, -1 = nicht bestimmbar)
+	bool IfConverged(double i_target, bool i_use_cond) const;				// true = relativer Standardfehler <= i_target (Leitfaehigkeit oder MSD-Rate)
+
+	TSimConvergence();				// Constructor
+	~TSimConvergence();				// Destructor
+
+};
+
+#endif
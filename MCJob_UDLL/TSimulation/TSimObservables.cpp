@@ -0,0 +1,161 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimObservables											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Recorder for the observables time series of the main			//
+//	  simulation: lock-free single-producer ring buffer and a		//
+//	  background thread that appends the samples to a CSV file		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TSimObservables.h"
+
+// Includes:
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+
+// Eigene Includes:
+#include "ErrorCodes.h"
+#include "GlobalDefinitions.h"
+
+using namespace std;
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor
+TSimObservables::TSimObservables() : Head(0), Tail(0), StopRequested(false), WriteFailed(false)
+{
+
+}
+
+// Destructor, beendet eine laufende Aufzeichnung
+TSimObservables::~TSimObservables()
+{
+
+	Close();
+}
+
+// ************************* MEMBER FUNCTIONS****************************** //
+
+// Datei oeffnen (Eintraege nach i_start_mcsp werden verworfen), Schreib-Thread starten
+int TSimObservables::Open(const string& i_path, unsigned long long i_start_mcsp)
+{
+	if (IsOpen() == true)
+	{
+		cout << "Critical Error: Observables recording already running (TSimObservables::Open)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+
+	// Vorhandene Zeitreihe einer fortgesetzten Simulation auf den Stand des Checkpoints kuerzen
+	// (Eintraege nach dem Checkpoint werden bei der Fortsetzung erneut aufgezeichnet)
+	vector<string> t_kept;
+	if (i_start_mcsp > 0ULL)
+	{
+		ifstream t_infile(i_path, ios::in);
+		string t_line;
+		while (getline(t_infile, t_line))
+		{
+			unsigned long long t_mcsp = 0ULL;
+			istringstream t_linestream(t_line);
+			if ((t_linestream >> t_mcsp).fail() == true) continue;
+			if (t_mcsp <= i_start_mcsp) t_kept.push_back(t_line);
+		}
+	}
+
+	// Datei neu schreiben
+	File.open(i_path, ios::out | ios::trunc);
+	if (File.is_open() == false)
+	{
+		cout << "Error: Cannot open observables file: " << i_path << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+	File << "MCSP,Time[s],MSD[cm^2],COM_x[cm],COM_y[cm],COM_z[cm],CollectiveMSD[cm^2],HavenRatio,Conductivity[S/cm]" << '\n';
+	for (const string& t_line : t_kept) File << t_line << '\n';
+	File.flush();
+	File << setprecision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
+	Path = i_path;
+
+	// Ringpuffer und Schreib-Thread starten
+	Ring.assign(KMCVAR_OBS_RINGSIZE, TSimObsSample());
+	Head.store(0);
+	Tail.store(0);
+	StopRequested.store(false);
+	WriteFailed.store(false);
+	Writer = thread(&TSimObservables::WriterLoop, this);
+
+	return KMCERR_OK;
+}
+
+// Messpunkt in den Ringpuffer schreiben (wartet, falls der Puffer voll ist)
+void TSimObservables::Push(const TSimObsSample& i_sample)
+{
+	size_t t_head = Head.load(memory_order_relaxed);
+	size_t t_next = (t_head + 1) % Ring.size();
+	while (t_next == Tail.load(memory_order_acquire)) this_thread::yield();
+	Ring[t_head] = i_sample;
+	Head.store(t_next, memory_order_release);
+}
+
+// Puffer leeren, Schreib-Thread beenden, Datei schliessen
+int TSimObservables::Close()
+{
+	if (IsOpen() == false) return KMCERR_OK;
+
+	StopRequested.store(true);
+	Writer.join();
+	File.close();
+	Ring.clear();
+
+	if (WriteFailed.load() == true)
+	{
+		cout << "Error: Writing to observables file failed: " << Path << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+	return KMCERR_OK;
+}
+
+// true = Aufzeichnung laeuft
+bool TSimObservables::IsOpen() const
+{
+
+	return Writer.joinable();
+}
+
+// Schreib-Thread: Puffer periodisch leeren
+void TSimObservables::WriterLoop()
+{
+	while (StopRequested.load() == false)
+	{
+		this_thread::sleep_for(chrono::milliseconds(KMCVAR_OBS_WRITEINTERVAL));
+		Drain();
+	}
+	Drain();
+}
+
+// Alle Messpunkte im Puffer in die Datei schreiben
+void TSimObservables::Drain()
+{
+	size_t t_tail = Tail.load(memory_order_relaxed);
+	size_t t_head = Head.load(memory_order_acquire);
+	if (t_tail == t_head) return;
+
+	while (t_tail != t_head)
+	{
+		const TSimObsSample& t_sample = Ring[t_tail];
+		File << t_sample.MCSP << ',' << t_sample.Time << ',' << t_sample.MSD << ',' <<
+			t_sample.COMx << ',' << t_sample.COMy << ',' << t_sample.COMz << ',' <<
+			t_sample.CollMSD << ',' << t_sample.HavenRatio << ',' << t_sample.Conductivity << '\n';
+		t_tail = (t_tail + 1) % Ring.size();
+		Tail.store(t_tail, memory_order_release);
+	}
+	File.flush();
+	if (File.fail() == true) WriteFailed.store(true);
+}
@@ -0,0 +1,75 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimObservables											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Recorder for the observables time series of the main			//
+//	  simulation: lock-free single-producer ring buffer and a		//
+//	  background thread that appends the samples to a CSV file		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TSimObservables_H
+#define TSimObservables_H
+
+// Includes:
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <fstream>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Messpunkt der Observablen-Zeitreihe
+struct TSimObsSample
+{
+	unsigned long long MCSP;		// MCSP-Zaehler
+	double Time;					// simulierte Zeit in s
+	double MSD;						// mittlere quadratische Verschiebung der beweglichen Spezies in cm^2
+	double COMx;					// mittlerer Verschiebungsvektor (= Schwerpunktverschiebung je Atom) in cm
+	double COMy;
+	double COMz;
+	double CollMSD;					// kollektive quadratische Verschiebung |sum(r)|^2 / N in cm^2
+	double HavenRatio;				// Haven-Verhaeltnis MSD / CollMSD (0 = nicht bestimmbar)
+	double Conductivity;			// Leitfaehigkeit in S/cm (0 = nicht bestimmbar)
+};
+
+// Klassendeklaration:
+class TSimObservables
+{
+	// Member variables
+protected:
+	vector<TSimObsSample> Ring;		// Ringpuffer (ein Schreiber = Simulation, ein Leser = Schreib-Thread)
+	atomic<size_t> Head;			// naechste Schreibposition (nur Simulation schreibt)
+	atomic<size_t> Tail;			// naechste Leseposition (nur Schreib-Thread schreibt)
+	atomic<bool> StopRequested;		// Signal an den Schreib-Thread, den Puffer zu leeren und sich zu beenden
+	atomic<bool> WriteFailed;		// Flag: true = Schreiben in die Datei ist fehlgeschlagen
+	thread Writer;					// Schreib-Thread
+	ofstream File;					// Zieldatei
+	string Path;					// Pfad der Zieldatei
+
+	// Member functions
+public:
+	int Open(const string& i_path, unsigned long long i_start_mcsp);	// Datei oeffnen (Eintraege nach i_start_mcsp werden verworfen), Schreib-Thread starten
+	void Push(const TSimObsSample& i_sample);							// Messpunkt in den Ringpuffer schreiben (wartet, falls der Puffer voll ist)
+	int Close();														// Puffer leeren, Schreib-Thread beenden, Datei schliessen
+	bool IsOpen() const;												// true = Aufzeichnung laeuft
+
+	TSimObservables();				// Constructor
+	~TSimObservables();				// Destructor, beendet eine laufende Aufzeichnung
+
+	// Member functions
+private:
+	void WriterLoop();				// Schreib-Thread: Puffer periodisch leeren
+	void Drain();					// Alle Messpunkte im Puffer in die Datei schreiben
+
+};
+
+#endif
@@ -53,14 +53,35 @@ void TSimPhaseInfo::Clear()
 	CurrentNonsenseJumpAttempts = 0ULL;
 	CurrentOverkillJumpAttempts = 0ULL;
 	CurrentSiteBlockingCounter = 0ULL;
-	CurrentLattice.clear();
-	CurrentMovLattice.clear();
+	CurrentLattice.Clear();
+	CurrentMovLattice.Clear();
 	CurrentAttemptProbList.clear();
 	CurrentAcceptedProbList.clear();
+	CurrentConvergence.Clear();
 	CurrentRunTime = TCustomTime();
 
 }
 
+// Alle Daten mit io_phase tauschen (ohne Kopie der Gitter)
+void TSimPhaseInfo::Swap(TSimPhaseInfo& io_phase)
+{
+
+	std::swap(HasValidData, io_phase.HasValidData);
+	std::swap(UsedNorm, io_phase.UsedNorm);
+	std::swap(CurrentAttemptPathRatioSum, io_phase.CurrentAttemptPathRatioSum);
+	std::swap(CurrentMCSP, io_phase.CurrentMCSP);
+	std::swap(CurrentJumpAttempts, io_phase.CurrentJumpAttempts);
+	std::swap(CurrentNonsenseJumpAttempts, io_phase.CurrentNonsenseJumpAttempts);
+	std::swap(CurrentOverkillJumpAttempts, io_phase.CurrentOverkillJumpAttempts);
+	std::swap(CurrentSiteBlockingCounter, io_phase.CurrentSiteBlockingCounter);
+	CurrentLattice.Swap(io_phase.CurrentLattice);
+	CurrentMovLattice.Swap(io_phase.CurrentMovLattice);
+	CurrentAttemptProbList.swap(io_phase.CurrentAttemptProbList);
+	CurrentAcceptedProbList.swap(io_phase.CurrentAcceptedProbList);
+	CurrentConvergence.Swap(io_phase.CurrentConvergence);
+	std::swap(CurrentRunTime, io_phase.CurrentRunTime);
+}
+
 // Simulationsphase in einen Stream schreiben
 int TSimPhaseInfo::SaveToStream(ostream& output, int offset, string_view start_key, string_view end_key)
 {
@@ -96,41 +117,33 @@ int TSimPhaseInfo::SaveToStream(ostream& output, int offset, string_view start_k
 
 	// Ausgabe des Gitters
 	output << s_offset << sub_offset << KMCOUT_TSIMPHASEINFO_LATTICE_START << endl;
-	for (int x = 0; x < (int)CurrentLattice.size(); x++)
+	size_t t_stack_size = (size_t)CurrentLattice.GetStackSize();
+	for (size_t i = 0; i < CurrentLattice.GetCount(); i += t_stack_size)
 	{
-		for (int y = 0; y < (int)CurrentLattice[x].size(); y++)
+		output << s_offset << sub_offset;
+		for (size_t s = 0; s < t_stack_size; s++)
 		{
-			for (int z = 0; z < (int)CurrentLattice[x][y].size(); z++)
-			{
-				output << s_offset << sub_offset;
-				for (int s = 0; s < (int)CurrentLattice[x][y][z].size(); s++)
-				{
-					output << CurrentLattice[x][y][z][s] << " ";
-				}
-				output << endl;
-			}
+			WriteNumber(output, CurrentLattice[i + s]);
+			output.put(' ');
 		}
+		output.put('\n');
 	}
 	output << s_offset << sub_offset << KMCOUT_TSIMPHASEINFO_LATTICE_END << endl;
 	output << endl;
 
 	// Ausgabe der Bewegungsspeicherung
 	output << s_offset << sub_offset << KMCOUT_TSIMPHASEINFO_MOVLATTICE_START << endl;
-	for (int x = 0; x < (int)CurrentMovLattice.size(); x++)
+	for (size_t i = 0; i < CurrentMovLattice.GetCount(); i++)
 	{
-		for (int y = 0; y < (int)CurrentMovLattice[x].size(); y++)
-		{
-			for (int z = 0; z < (int)CurrentMovLattice[x][y].size(); z++)
-			{
-				for (int s = 0; s < (int)CurrentMovLattice[x][y][z].size(); s++)
-				{
-					output << s_offset << sub_offset << CurrentMovLattice[x][y][z][s].jcount << " ";
-					output << CurrentMovLattice[x][y][z][s].x << " ";
-					output << CurrentMovLattice[x][y][z][s].y << " ";
-					output << CurrentMovLattice[x][y][z][s].z << endl;
-				}
-			}
-		}
+		output << s_offset << sub_offset;
+		WriteNumber(output, CurrentMovLattice[i].jcount);
+		output.put(' ');
+		WriteNumber(output, CurrentMovLattice[i].x);
+		output.put(' ');
+		WriteNumber(output, CurrentMovLattice[i].y);
+		output.put(' ');
+		WriteNumber(output, CurrentMovLattice[i].z);
+		output.put('\n');
 	}
 	output << s_offset << sub_offset << KMCOUT_TSIMPHASEINFO_MOVLATTICE_END << endl;
 
@@ -184,6 +197,20 @@ int TSimPhaseInfo::SaveToStream(ostream& output, int offset, string_view start_k
 		}
 	}
 
+	// Ausgabe der Konvergenzbloecke (erste Zeile: MCSP je Block und offener Block, danach die abgeschlossenen Bloecke)
+	if (CurrentConvergence.IsEmpty() == false)
+	{
+		output << endl;
+		output << s_offset << sub_offset << KMCOUT_TSIMPHASEINFO_CONV_START << endl;
+		output << s_offset << sub_offset << CurrentConvergence.BlockMCSP << " " << CurrentConvergence.OpenMCSP << " " << CurrentConvergence.OpenDisp << " ";
+		output << CurrentConvergence.OpenSqDisp << " " << CurrentConvergence.OpenTime << endl;
+		for (size_t i = 0; i < CurrentConvergence.BlockTime.size(); i++)
+		{
+			output << s_offset << sub_offset << CurrentConvergence.BlockDisp[i] << " " << CurrentConvergence.BlockSqDisp[i] << " " << CurrentConvergence.BlockTime[i] << endl;
+		}
+		output << s_offset << sub_offset << KMCOUT_TSIMPHASEINFO_CONV_END << endl;
+	}
+
 	// Ausgabe der Endzeile
 	output << s_offset << end_key << endl;
 
@@ -214,6 +241,7 @@ int TSimPhaseInfo::LoadFromStream(istream& input, int lattice_size, int stack_si
 	vector<T3DMovVector> t_lin_movlattice;
 	vector<TSimProb> t_attemptprobs;
 	vector<TSimProb> t_acceptedprobs;
+	TSimConvergence t_convergence;
 	TCustomTime t_runtime;
 
 	string line = "";
@@ -521,12 +549,89 @@ int TSimPhaseInfo::LoadFromStream(istream& input, int lattice_size, int stack_si
 			}
 			if (if_failed == true) break;
 		}
+		else if (s_temp == KMCOUT_TSIMPHASEINFO_CONV_START)
+		{
+			if ((input >> t_convergence.BlockMCSP).fail() == true)
+			{
+				if_failed = true;
+				break;
+			}
+			if ((input >> t_convergence.OpenMCSP).fail() == true)
+			{
+				if_failed = true;
+				break;
+			}
+			if ((input >> t_convergence.OpenDisp).fail() == true)
+			{
+				if_failed = true;
+				break;
+			}
+			if ((input >> t_convergence.OpenSqDisp).fail() == true)
+			{
+				if_failed = true;
+				break;
+			}
+			if ((input >> t_convergence.OpenTime).fail() == true)
+			{
+				if_failed = true;
+				break;
+			}
+			if ((t_convergence.BlockMCSP == 0ULL) || (t_convergence.OpenMCSP >= t_convergence.BlockMCSP))
+			{
+				if_failed = true;
+				break;
+			}
+			if ((input >> s_temp).fail() == true)
+			{
+				if_failed = true;
+				break;
+			}
+			while (s_temp != KMCOUT_TSIMPHASEINFO_CONV_END)
+			{
+				t_convergence.BlockDisp.push_back(0.0);
+				t_convergence.BlockSqDisp.push_back(0.0);
+				t_convergence.BlockTime.push_back(0.0);
+				if ((int)t_convergence.BlockTime.size() >= KMCVAR_CONV_MAXBLOCKS)
+				{
+					if_failed = true;
+					break;
+				}
+				if (ConvStrToDouble(s_temp, t_convergence.BlockDisp.back()) == false)
+				{
+					if_failed = true;
+					break;
+				}
+				if ((input >> t_convergence.BlockSqDisp.back()).fail() == true)
+				{
+					if_failed = true;
+					break;
+				}
+				if ((input >> t_convergence.BlockTime.back()).fail() == true)
+				{
+					if_failed = true;
+					break;
+				}
+				if (t_convergence.BlockTime.back() <= 0.0)
+				{
+					if_failed = true;
+					break;
+				}
+				if ((input >> s_temp).fail() == true)
+				{
+					if_failed = true;
+					break;
+				}
+			}
+			if (if_failed == true) break;
+		}
 		else if (s_temp == end_key) break;
 	}
-	if ((size_t)t_lin_lattice.size() != size_t(lattice_size) * size_t(lattice_size) * size_t(lattice_size) * size_t(stack_size)) if_failed = true;
+	if ((t_lin_lattice.size() != 0) &&
+		((size_t)t_lin_lattice.size() != size_t(lattice_size) * size_t(lattice_size) * size_t(lattice_size) * size_t(stack_size))) if_failed = true;
 	if ((size_t)t_lin_movlattice.size() != size_t(lattice_size) * size_t(lattice_size) * size_t(lattice_size) * size_t(movstack_size)) if_failed = true;
 	if (t_norm <= 0.0) if_failed = true;
 	if (t_timesum <= 0.0) if_failed = true;
+	if ((lattice_size <= 0) || (stack_size <= 0) || (movstack_size <= 0)) if_failed = true;
 	if (if_failed == true) return KMCERR_INVALID_FILE_FORMAT;
 
 	// Daten uebertragen (HasValidData = true erst nach Validierung in TSimulationBase)
@@ -538,36 +643,15 @@ int TSimPhaseInfo::LoadFromStream(istream& input, int lattice_size, int stack_si
 	CurrentOverkillJumpAttempts = t_overkillattempts;
 	CurrentSiteBlockingCounter = t_siteblocking;
 	CurrentRunTime = t_runtime;
-	CurrentLattice = vector<vector<vector<vector<int>>>>(lattice_size, vector<vector<vector<int>>>(lattice_size,
-		vector<vector<int>>(lattice_size, vector<int>(stack_size, -1))));
-	for (int x = 0; x < lattice_size; x++)
+	if (t_lin_lattice.size() != 0)
 	{
-		for (int y = 0; y < lattice_size; y++)
-		{
-			for (int z = 0; z < lattice_size; z++)
-			{
-				for (int s = 0; s < stack_size; s++)
-				{
-					CurrentLattice[x][y][z][s] = t_lin_lattice[(((size_t)lattice_size * x + y) * lattice_size + z) * stack_size + s];
-				}
-			}
-		}
+		CurrentLattice.Assign(lattice_size, stack_size, std::move(t_lin_lattice));
 	}
-	CurrentMovLattice = vector<vector<vector<vector<T3DMovVector>>>>(lattice_size, vector<vector<vector<T3DMovVector>>>(lattice_size,
-		vector<vector<T3DMovVector>>(lattice_size, vector<T3DMovVector>(movstack_size, T3DMovVector()))));
-	for (int x = 0; x < lattice_size; x++)
+	else
 	{
-		for (int y = 0; y < lattice_size; y++)
-		{
-			for (int z = 0; z < lattice_size; z++)
-			{
-				for (int s = 0; s < movstack_size; s++)
-				{
-					CurrentMovLattice[x][y][z][s] = t_lin_movlattice[(((size_t)lattice_size * x + y) * lattice_size + z) * movstack_size + s];
-				}
-			}
-		}
+		CurrentLattice.Clear();
 	}
+	CurrentMovLattice.Assign(lattice_size, movstack_size, std::move(t_lin_movlattice));
 	if (t_attemptprobs.size() != 0)
 	{
 		CurrentAttemptProbList = t_attemptprobs;
@@ -584,6 +668,7 @@ int TSimPhaseInfo::LoadFromStream(istream& input, int lattice_size, int stack_si
 	{
 		CurrentAcceptedProbList.clear();
 	}
+	CurrentConvergence.Swap(t_convergence);
 
 	return KMCERR_OK;
 }
\ No newline at end of file
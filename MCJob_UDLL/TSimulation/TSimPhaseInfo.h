@@ -21,7 +21,9 @@
 
 // Eigene Includes:
 #include "T3DMovVector.h"
+#include "T4DLattice.h"
 #include "TSimulation/TSimProb.h"
+#include "TSimulation/TSimConvergence.h"
 #include "TCustomTime.h"
 
 using namespace std;
@@ -40,14 +42,16 @@ public:
 	unsigned long long CurrentNonsenseJumpAttempts;						// aktuelle Anzahl an Sprungversuchen mit Ruecksprungwahrscheinlichkeit >= 1 (sind nicht in CurrentJumpAttempts enthalten)
 	unsigned long long CurrentOverkillJumpAttempts;						// aktuelle Anzahl an Sprungversuchen mit Hinsprungwahrscheinlichkeit >= 1 (sind nicht in CurrentJumpAttempts enthalten)
 	unsigned long long CurrentSiteBlockingCounter;						// aktuelle Anzahl an SiteBlocking, d.h. Zielort schon von Leerstelle besetzt (sind in CurrentJumpAttempts enthalten)
-	vector<vector<vector<vector<int>>>> CurrentLattice;					// aktueller Gitterzustand
-	vector<vector<vector<vector<T3DMovVector>>>> CurrentMovLattice;		// aktuelle Atomverschiebungsvektoren
+	T4DLattice<int> CurrentLattice;										// aktueller Gitterzustand (leer, wenn an die naechste Phase abgegeben)
+	T4DLattice<T3DMovVector> CurrentMovLattice;							// aktuelle Atomverschiebungsvektoren
 	vector<TSimProb> CurrentAttemptProbList;							// aktuelle Liste der Sprungversuchswahrscheinlichkeiten 
 	vector<TSimProb> CurrentAcceptedProbList;							// aktuelle Liste der Wahrscheinlichkeiten der akzeptierten Spruenge
+	TSimConvergence CurrentConvergence;									// aktuelle Blockmittelung fuer das Konvergenzkriterium (nur Hauptsimulation)
 	TCustomTime CurrentRunTime;											// aktuelle Laufzeit
 
 	// Member functions:
 	void Clear();																			// Alle Daten auf Standardwerte setzen
+	void Swap(TSimPhaseInfo& io_phase);														// Alle Daten mit io_phase tauschen (ohne Kopie der Gitter)
 	int SaveToStream(ostream& output, int offset, string_view start_key, string_view end_key);						// Simulationsphase in einen Stream schreiben
 	int LoadFromStream(istream& input, int lattice_size, int stack_size, int movstack_size, string_view end_key);	// Simulationsphase aus einem Stream laden
 
@@ -0,0 +1,359 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimTelemetry											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Process-wide telemetry sink: running simulations publish		//
+//	  their counters atomically, a background thread writes them	//
+//	  periodically as JSON lines to a file or named pipe			//
+//	  (non-blocking, telemetry is disabled if the sink fails)		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TSimTelemetry.h"
+
+// Includes:
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+// POSIX-Includes
+#if !(defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+
+#endif
+
+// Eigene Includes:
+#include "ErrorCodes.h"
+#include "GlobalDefinitions.h"
+
+using namespace std;
+
+// Statische Daten
+mutex TSimTelemetry::StateMutex;
+condition_variable TSimTelemetry::StopCondition;
+bool TSimTelemetry::StopRequested = false;
+thread TSimTelemetry::Writer;
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+ofstream TSimTelemetry::File;
+#else
+int TSimTelemetry::FileDesc = -1;
+#endif
+bool TSimTelemetry::SinkFailed = false;
+int TSimTelemetry::Interval = KMCVAR_TELEMETRY_INTERVAL;
+vector<TSimTelemetryCounters*> TSimTelemetry::Counters;
+
+namespace
+{
+	// Bezeichnung einer Simulationsphase
+	const char* GetPhaseName(int i_phase)
+	{
+		switch (i_phase)
+		{
+		case TSimTelemetryCounters::Prerun: return "prerun";
+		case TSimTelemetryCounters::DynNorm: return "dynnorm";
+		case TSimTelemetryCounters::Main: return "main";
+		default: return "none";
+		}
+	}
+
+	// String fuer JSON maskieren
+	string JsonEscape(const string& i_text)
+	{
+		string t_out;
+		t_out.reserve(i_text.size());
+		for (char c : i_text)
+		{
+			if ((c == '"') || (c == '\\'))
+			{
+				t_out.push_back('\\');
+				t_out.push_back(c);
+			}
+			else if ((unsigned char)c < 0x20)
+			{
+				t_out.push_back(' ');
+			}
+			else
+			{
+				t_out.push_back(c);
+			}
+		}
+		return t_out;
+	}
+}
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor
+TSimTelemetryCounters::TSimTelemetryCounters() : JobName(""), Phase(None), MCSP(0ULL), TargetMCSP(0ULL), JumpAttempts(0ULL),
+	TargetJumpAttempts(0ULL), AcceptedJumps(0ULL), NonsenseAttempts(0ULL), OverkillAttempts(0ULL), SiteBlocking(0ULL),
+	Normalization(1.0), CheckpointCount(0ULL), CheckpointDuration(-1.0), PrevAttempts(0ULL), PrevMCSP(0ULL)
+{
+
+}
+
+// Constructor, meldet i_counters an (falls Telemetrie aktiv)
+TSimTelemetryScope::TSimTelemetryScope(TSimTelemetryCounters* i_counters)
+{
+
+	Counters = (TSimTelemetry::Register(i_counters) == true) ? i_counters : NULL;
+}
+
+// Destructor, meldet i_counters ab
+TSimTelemetryScope::~TSimTelemetryScope()
+{
+
+	if (Counters != NULL) TSimTelemetry::Unregister(Counters);
+}
+
+// true = Zaehler sind angemeldet
+bool TSimTelemetryScope::IsActive() const
+{
+
+	return (Counters != NULL);
+}
+
+// ***************************** PUBLIC *********************************** //
+
+// Senke oeffnen und Telemetrie-Thread starten (i_interval in ms)
+int TSimTelemetry::Start(const string& i_path, int i_interval)
+{
+	lock_guard<mutex> lock(StateMutex);
+	if (Writer.joinable() == true)
+	{
+		cout << "Critical Error: Telemetry already running (TSimTelemetry::Start)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+	if (i_interval <= 0)
+	{
+		cout << "Error: Invalid telemetry interval: " << i_interval << " ms" << endl << endl;
+		return KMCERR_INVALID_INPUT;
+	}
+
+	// Anhaengen, damit auch Named Pipes und von mehreren Laeufen geteilte Dateien funktionieren
+	if (OpenSink(i_path) == false)
+	{
+		cout << "Error: Cannot open telemetry output: " << i_path << endl;
+		cout << "       (a named pipe has to be opened by its reader first)" << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+
+	Interval = i_interval;
+	StopRequested = false;
+	SinkFailed = false;
+	Writer = thread(&TSimTelemetry::WriterLoop);
+
+	return KMCERR_OK;
+}
+
+// Telemetrie-Thread beenden und Senke schliessen
+void TSimTelemetry::Stop()
+{
+	{
+		lock_guard<mutex> lock(StateMutex);
+		if (Writer.joinable() == false) return;
+		StopRequested = true;
+	}
+	StopCondition.notify_all();
+	Writer.join();
+
+	lock_guard<mutex> lock(StateMutex);
+	CloseSink();
+	Counters.clear();
+}
+
+// true = Telemetrie aktiv
+bool TSimTelemetry::IsRunning()
+{
+	lock_guard<mutex> lock(StateMutex);
+
+	return ((Writer.joinable() == true) && (StopRequested == false) && (SinkFailed == false));
+}
+
+// Zaehler anmelden und "start"-Zeile schreiben (false = Telemetrie nicht aktiv)
+bool TSimTelemetry::Register(TSimTelemetryCounters* i_counters)
+{
+	lock_guard<mutex> lock(StateMutex);
+	if ((i_counters == NULL) || (Writer.joinable() == false) || (StopRequested == true) || (SinkFailed == true)) return false;
+
+	i_counters->PrevTime = chrono::steady_clock::now();
+	i_counters->PrevAttempts = i_counters->JumpAttempts.load(memory_order_relaxed);
+	i_counters->PrevMCSP = i_counters->MCSP.load(memory_order_relaxed);
+	Counters.push_back(i_counters);
+	WriteLine(*i_counters, "start");
+
+	return true;
+}
+
+// "end"-Zeile schreiben und Zaehler abmelden
+void TSimTelemetry::Unregister(TSimTelemetryCounters* i_counters)
+{
+	lock_guard<mutex> lock(StateMutex);
+	auto t_it = find(Counters.begin(), Counters.end(), i_counters);
+	if (t_it == Counters.end()) return;
+
+	WriteLine(*i_counters, "end");
+	Counters.erase(t_it);
+}
+
+// ***************************** PRIVATE ********************************** //
+
+// Telemetrie-Thread: je Intervall eine Zeile pro angemeldetem Zaehler
+void TSimTelemetry::WriterLoop()
+{
+	unique_lock<mutex> lock(StateMutex);
+	while (true)
+	{
+		if (StopCondition.wait_for(lock, chrono::milliseconds(Interval), []() { return StopRequested; }) == true) break;
+
+		for (TSimTelemetryCounters* t_counters : Counters) WriteLine(*t_counters, "progress");
+		if (SinkFailed == true) break;
+	}
+}
+
+// JSON-Zeile schreiben (StateMutex muss gesperrt sein)
+void TSimTelemetry::WriteLine(TSimTelemetryCounters& io_counters, const char* i_event)
+{
+	// Zaehler lesen
+	int t_phase = io_counters.Phase.load(memory_order_relaxed);
+	unsigned long long t_mcsp = io_counters.MCSP.load(memory_order_relaxed);
+	unsigned long long t_target_mcsp = io_counters.TargetMCSP.load(memory_order_relaxed);
+	unsigned long long t_attempts = io_counters.JumpAttempts.load(memory_order_relaxed);
+	unsigned long long t_target_attempts = io_counters.TargetJumpAttempts.load(memory_order_relaxed);
+	unsigned long long t_accepted = io_counters.AcceptedJumps.load(memory_order_relaxed);
+	unsigned long long t_nonsense = io_counters.NonsenseAttempts.load(memory_order_relaxed);
+	unsigned long long t_overkill = io_counters.OverkillAttempts.load(memory_order_relaxed);
+	unsigned long long t_blocking = io_counters.SiteBlocking.load(memory_order_relaxed);
+	double t_norm = io_counters.Normalization.load(memory_order_relaxed);
+	unsigned long long t_chk_count = io_counters.CheckpointCount.load(memory_order_relaxed);
+	double t_chk_duration = io_counters.CheckpointDuration.load(memory_order_relaxed);
+
+	// Raten seit der letzten Zeile
+	chrono::steady_clock::time_point t_now = chrono::steady_clock::now();
+	double t_seconds = chrono::duration<double>(t_now - io_counters.PrevTime).count();
+	double t_attempt_rate = 0.0;
+	double t_mcsp_rate = 0.0;
+	if (t_seconds > 0.0)
+	{
+		if (t_attempts >= io_counters.PrevAttempts) t_attempt_rate = double(t_attempts - io_counters.PrevAttempts) / t_seconds;
+		if (t_mcsp >= io_counters.PrevMCSP) t_mcsp_rate = double(t_mcsp - io_counters.PrevMCSP) / t_seconds;
+	}
+	io_counters.PrevTime = t_now;
+	io_counters.PrevAttempts = t_attempts;
+	io_counters.PrevMCSP = t_mcsp;
+
+	// Restlaufzeit der Phase (< 0 = nicht bestimmbar)
+	double t_eta = -1.0;
+	if ((t_target_mcsp > 0ULL) && (t_mcsp_rate > 0.0))
+	{
+		t_eta = double(t_target_mcsp - min(t_mcsp, t_target_mcsp)) / t_mcsp_rate;
+	}
+	else if ((t_target_attempts > 0ULL) && (t_attempt_rate > 0.0))
+	{
+		t_eta = double(t_target_attempts - min(t_attempts, t_target_attempts)) / t_attempt_rate;
+	}
+
+	// Zeile zusammensetzen (getrennt formatieren, damit jede Zeile in einem Stueck geschrieben wird)
+	ostringstream t_line;
+	t_line << setprecision(6);
+	t_line << "{\"time\":" << fixed << setprecision(3) << chrono::duration<double>(chrono::system_clock::now().time_since_epoch()).count() << defaultfloat << setprecision(6);
+	t_line << ",\"event\":\"" << i_event << "\"";
+	t_line << ",\"job\":\"" << JsonEscape(io_counters.JobName) << "\"";
+	t_line << ",\"phase\":\"" << GetPhaseName(t_phase) << "\"";
+	t_line << ",\"mcsp\":" << t_mcsp << ",\"target_mcsp\":" << t_target_mcsp;
+	t_line << ",\"attempts\":" << t_attempts << ",\"target_attempts\":" << t_target_attempts;
+	t_line << ",\"attempts_per_s\":" << t_attempt_rate << ",\"mcsp_per_s\":" << t_mcsp_rate;
+	t_line << ",\"accepted\":" << t_accepted << ",\"acceptance_ratio\":" << ((t_attempts > 0ULL) ? double(t_accepted) / double(t_attempts) : 0.0);
+	t_line << ",\"nonsense\":" << t_nonsense << ",\"overkill\":" << t_overkill << ",\"site_blocking\":" << t_blocking;
+	t_line << ",\"normalization\":" << t_norm;
+	t_line << ",\"eta_s\":";
+	if (t_eta >= 0.0) t_line << t_eta; else t_line << "null";
+	long long t_rss = GetCurrentMemoryUsage();
+	long long t_peak = GetPeakMemoryUsage();
+	t_line << ",\"rss_mb\":";
+	if (t_rss >= 0LL) t_line << double(t_rss) / 1048576.0; else t_line << "null";
+	t_line << ",\"peak_rss_mb\":";
+	if (t_peak >= 0LL) t_line << double(t_peak) / 1048576.0; else t_line << "null";
+	t_line << ",\"checkpoints\":" << t_chk_count << ",\"checkpoint_s\":";
+	if (t_chk_duration >= 0.0) t_line << t_chk_duration; else t_line << "null";
+	t_line << "}\n";
+
+	WriteSink(t_line.str());
+}
+
+// Senke zum Anhaengen oeffnen (Named Pipe ohne Leser = Fehler statt Blockieren)
+bool TSimTelemetry::OpenSink(const string& i_path)
+{
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+	File.open(i_path, ios::out | ios::app);
+	return File.is_open();
+#else
+	// SIGPIPE ignorieren, damit ein beendeter Leser der Named Pipe nicht das Programm beendet (write liefert dann EPIPE)
+	signal(SIGPIPE, SIG_IGN);
+
+	// O_NONBLOCK: open blockiert nicht bis ein Leser die Named Pipe oeffnet (ENXIO) und
+	// write blockiert die Simulationen nicht, wenn der Leser nicht nachkommt
+	FileDesc = open(i_path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_NONBLOCK | O_CLOEXEC, 0644);
+	return (FileDesc >= 0);
+#endif
+}
+
+// Senke schliessen
+void TSimTelemetry::CloseSink()
+{
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+	if (File.is_open() == true) File.close();
+#else
+	if (FileDesc >= 0) close(FileDesc);
+	FileDesc = -1;
+#endif
+}
+
+// Text schreiben, bei Fehler Telemetrie abschalten (StateMutex muss gesperrt sein)
+void TSimTelemetry::WriteSink(const string& i_text)
+{
+	if (SinkFailed == true) return;
+
+	bool t_failed = false;
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+	File << i_text;
+	File.flush();
+	t_failed = File.fail();
+#else
+	size_t t_written = 0;
+	while (t_written < i_text.size())
+	{
+		ssize_t t_count = write(FileDesc, i_text.data() + t_written, i_text.size() - t_written);
+		if (t_count > 0)
+		{
+			t_written += (size_t)t_count;
+			continue;
+		}
+		if ((t_count < 0) && (errno == EINTR)) continue;
+
+		// Volle Named Pipe (Leser kommt nicht nach): Zeile verwerfen (Zeilen < PIPE_BUF werden nie geteilt geschrieben)
+		if ((t_count < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)) && (t_written == 0)) break;
+
+		t_failed = true;
+		break;
+	}
+#endif
+
+	// z.B. Leser der Named Pipe beendet oder Datentraeger voll
+	if (t_failed == true)
+	{
+		SinkFailed = true;
+		CloseSink();
+		cout << "Warning: Writing telemetry output failed, telemetry is disabled." << endl;
+	}
+}
@@ -0,0 +1,115 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimTelemetry											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Process-wide telemetry sink: running simulations publish		//
+//	  their counters atomically, a background thread writes them	//
+//	  periodically as JSON lines to a file or named pipe			//
+//	  (non-blocking, telemetry is disabled if the sink fails)		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TSimTelemetry_H
+#define TSimTelemetry_H
+
+// Includes:
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <fstream>
+#include <chrono>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Zaehler einer Simulation (Simulation schreibt einmal pro MCSP, Telemetrie-Thread liest)
+struct TSimTelemetryCounters
+{
+	// Simulationsphasen
+	enum TPhase : int { None = 0, Prerun = 1, DynNorm = 2, Main = 3 };
+
+	string JobName;									// Jobbezeichnung (nur aendern, waehrend nicht angemeldet)
+	atomic<int> Phase;								// aktuelle Simulationsphase
+	atomic<unsigned long long> MCSP;				// MCSP-Zaehler
+	atomic<unsigned long long> TargetMCSP;			// Ziel-MCSP (0 = durch Sprungversuche begrenzt)
+	atomic<unsigned long long> JumpAttempts;		// Sprungversuche
+	atomic<unsigned long long> TargetJumpAttempts;	// Ziel-Sprungversuche (0 = durch MCSP begrenzt)
+	atomic<unsigned long long> AcceptedJumps;		// durchgefuehrte Spruenge (MCSP * Anzahl beweglicher Atome)
+	atomic<unsigned long long> NonsenseAttempts;	// Sprungversuche mit Ruecksprungwahrscheinlichkeit >= 1
+	atomic<unsigned long long> OverkillAttempts;	// Sprungversuche mit Hinsprungwahrscheinlichkeit >= 1
+	atomic<unsigned long long> SiteBlocking;		// Sprungversuche auf besetzte Zielplaetze
+	atomic<double> Normalization;					// aktuelle Normierung
+	atomic<unsigned long long> CheckpointCount;		// Anzahl geschriebener Checkpoints
+	atomic<double> CheckpointDuration;				// Dauer des letzten Checkpoints in s (< 0 = noch keiner)
+
+	// Nur Telemetrie-Thread (Ratenberechnung zwischen zwei Zeilen)
+	chrono::steady_clock::time_point PrevTime;
+	unsigned long long PrevAttempts;
+	unsigned long long PrevMCSP;
+
+	TSimTelemetryCounters();		// Constructor
+};
+
+// Klassendeklaration:
+class TSimTelemetry
+{
+	// Member variables
+protected:
+	static mutex StateMutex;								// Schutz aller statischen Daten
+	static condition_variable StopCondition;				// Signal zum Beenden des Telemetrie-Threads
+	static bool StopRequested;								// Flag: true = Telemetrie-Thread soll sich beenden
+	static thread Writer;									// Telemetrie-Thread
+#if (defined(WIN32) || defined(_WIN32) || defined(__WIN32__))
+	static ofstream File;									// Zieldatei bzw. Named Pipe
+#else
+	static int FileDesc;									// Dateideskriptor der Zieldatei bzw. Named Pipe (-1 = geschlossen)
+#endif
+	static bool SinkFailed;									// Flag: true = Schreiben fehlgeschlagen, Telemetrie abgeschaltet
+	static int Interval;									// Schreibintervall in ms
+	static vector<TSimTelemetryCounters*> Counters;			// angemeldete Zaehler
+
+	// Member functions
+public:
+	static int Start(const string& i_path, int i_interval);	// Senke oeffnen und Telemetrie-Thread starten (i_interval in ms)
+	static void Stop();										// Telemetrie-Thread beenden und Senke schliessen
+	static bool IsRunning();								// true = Telemetrie aktiv
+	static bool Register(TSimTelemetryCounters* i_counters);	// Zaehler anmelden und "start"-Zeile schreiben (false = Telemetrie nicht aktiv)
+	static void Unregister(TSimTelemetryCounters* i_counters);	// "end"-Zeile schreiben und Zaehler abmelden
+
+	// Member functions
+private:
+	static void WriterLoop();												// Telemetrie-Thread: je Intervall eine Zeile pro angemeldetem Zaehler
+	static void WriteLine(TSimTelemetryCounters& io_counters, const char* i_event);	// JSON-Zeile schreiben (StateMutex muss gesperrt sein)
+	static bool OpenSink(const string& i_path);								// Senke zum Anhaengen oeffnen (Named Pipe ohne Leser = Fehler statt Blockieren)
+	static void CloseSink();												// Senke schliessen
+	static void WriteSink(const string& i_text);							// Text schreiben, bei Fehler Telemetrie abschalten (StateMutex muss gesperrt sein)
+
+};
+
+// Anmeldung eines Zaehlerblocks fuer die Dauer eines Gueltigkeitsbereichs (z.B. einer Simulationsphase)
+class TSimTelemetryScope
+{
+	// Member variables
+protected:
+	TSimTelemetryCounters* Counters;		// angemeldete Zaehler (NULL = Telemetrie nicht aktiv)
+
+	// Member functions
+public:
+	TSimTelemetryScope(TSimTelemetryCounters* i_counters);	// Constructor, meldet i_counters an (falls Telemetrie aktiv)
+	~TSimTelemetryScope();									// Destructor, meldet i_counters ab
+	bool IsActive() const;									// true = Zaehler sind angemeldet
+
+	TSimTelemetryScope(const TSimTelemetryScope&) = delete;
+	TSimTelemetryScope& operator=(const TSimTelemetryScope&) = delete;
+};
+
+#endif
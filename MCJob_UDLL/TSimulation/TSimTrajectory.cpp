@@ -0,0 +1,257 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimTrajectory											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Recorder for the lattice trajectory of the main simulation:	//
+//	  keyframes (run-length encoded lattice) and delta frames		//
+//	  (vacancy swaps since the last frame, varint encoded),		//
+//	  encoded and written by a background thread					//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TSimTrajectory.h"
+
+// Includes:
+#include <iostream>
+#include <filesystem>
+
+// Eigene Includes:
+#include "ErrorCodes.h"
+#include "GlobalDefinitions.h"
+#include "TSimulation/TSimTrajectoryReader.h"
+
+using namespace std;
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor
+TSimTrajectory::TSimTrajectory() : SiteCount(0), SwapLimit(0), FrameCounter(0), QueueBytes(0), StopRequested(false), WriteFailed(false)
+{
+
+}
+
+// Destructor, beendet eine laufende Aufzeichnung
+TSimTrajectory::~TSimTrajectory()
+{
+
+	Close();
+}
+
+// ************************* MEMBER FUNCTIONS****************************** //
+
+// Datei oeffnen (Frames ab i_start_mcsp werden verworfen), Keyframe schreiben, Schreib-Thread starten
+int TSimTrajectory::Open(const string& i_path, const int* i_lattice, int i_latticesize, int i_stacksize, unsigned long long i_start_mcsp)
+{
+	if (IsOpen() == true)
+	{
+		cout << "Critical Error: Trajectory recording already running (TSimTrajectory::Open)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+	if ((i_lattice == NULL) || (i_latticesize <= 0) || (i_stacksize <= 0))
+	{
+		cout << "Critical Error: Invalid lattice (TSimTrajectory::Open)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+	SiteCount = (size_t)i_latticesize * (size_t)i_latticesize * (size_t)i_latticesize * (size_t)i_stacksize;
+	if (SiteCount > (size_t)UINT32_MAX)
+	{
+		cout << "Critical Error: Lattice too large for trajectory recording (TSimTrajectory::Open)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+
+	// Vorhandene Trajektorie einer fortgesetzten Simulation auf den Stand des Checkpoints kuerzen
+	// (Frames ab dem Checkpoint werden bei der Fortsetzung erneut aufgezeichnet, beginnend mit einem Keyframe)
+	bool t_append = false;
+	if (i_start_mcsp > 0ULL)
+	{
+		TSimTrajectoryReader t_reader;
+		int t_latticesize = 0;
+		int t_stacksize = 0;
+		if ((t_reader.Open(i_path) == KMCERR_OK) && (t_reader.GetLatticeDims(t_latticesize, t_stacksize) == KMCERR_OK) &&
+			(t_latticesize == i_latticesize) && (t_stacksize == i_stacksize))
+		{
+			streamoff t_end = t_reader.GetFrameStart(i_start_mcsp);
+			t_reader.Close();
+			error_code ec;
+			filesystem::resize_file(i_path, (uintmax_t)t_end, ec);
+			t_append = (!ec);
+		}
+	}
+
+	// Datei oeffnen, ggf. Kopf schreiben
+	File.open(i_path, ios::out | ios::binary | (t_append ? ios::app : ios::trunc));
+	if (File.is_open() == false)
+	{
+		cout << "Error: Cannot open trajectory file: " << i_path << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+	Path = i_path;
+	WriteFailed.store(false);
+	if (t_append == false)
+	{
+		string t_head(KMCPATH_TRJ_MAGIC);
+		TrajectoryFormat::WriteVarint(t_head, (uint64_t)i_latticesize);
+		TrajectoryFormat::WriteVarint(t_head, (uint64_t)i_stacksize);
+		TrajectoryFormat::WriteVarint(t_head, (uint64_t)SiteCount);
+		File.write(t_head.data(), (streamsize)t_head.size());
+	}
+
+	// Startzustand als Keyframe schreiben
+	TFrame t_frame;
+	t_frame.IsKey = true;
+	t_frame.MCSP = i_start_mcsp;
+	t_frame.Lattice.assign(i_lattice, i_lattice + SiteCount);
+	string t_buffer;
+	WriteFrame(t_frame, t_buffer);
+	if (WriteFailed.load() == true)
+	{
+		File.close();
+		cout << "Error: Writing to trajectory file failed: " << Path << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+
+	// Sprungaufzeichnung und Schreib-Thread starten
+	Swaps.clear();
+	SwapLimit = SiteCount;
+	FrameCounter = 0;
+	Queue.clear();
+	QueueBytes = 0;
+	StopRequested = false;
+	Writer = thread(&TSimTrajectory::WriterLoop, this);
+
+	return KMCERR_OK;
+}
+
+// Frame abschliessen und an den Schreib-Thread uebergeben (wartet, falls zu viel Speicher aussteht)
+void TSimTrajectory::AddFrame(const int* i_lattice, unsigned long long i_mcsp)
+{
+	TFrame t_frame;
+	t_frame.MCSP = i_mcsp;
+	++FrameCounter;
+	if ((FrameCounter >= KMCVAR_TRJ_KEYFRAMEINTERVAL) || (Swaps.size() >= SwapLimit))
+	{
+		// Keyframe: vollstaendiges Gitterabbild, Spruenge werden nicht benoetigt
+		// (auch, wenn die Sprungliste voll ist, der Delta-Frame waere dann nicht kleiner)
+		t_frame.IsKey = true;
+		t_frame.Lattice.assign(i_lattice, i_lattice + SiteCount);
+		Swaps.clear();
+		FrameCounter = 0;
+	}
+	else
+	{
+		// Delta-Frame: Sprungliste wird uebergeben, die neue Liste waechst bei Bedarf
+		t_frame.IsKey = false;
+		t_frame.Swaps.swap(Swaps);
+	}
+	EnqueueFrame(move(t_frame));
+}
+
+// Ausstehende Frames schreiben, Schreib-Thread beenden, Datei schliessen
+int TSimTrajectory::Close()
+{
+	if (IsOpen() == false) return KMCERR_OK;
+
+	{
+		lock_guard<mutex> lock(QueueMutex);
+		StopRequested = true;
+	}
+	QueueCondition.notify_all();
+	Writer.join();
+	File.close();
+	Swaps = vector<uint32_t>();
+
+	if (WriteFailed.load() == true)
+	{
+		cout << "Error: Writing to trajectory file failed: " << Path << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+	return KMCERR_OK;
+}
+
+// true = Aufzeichnung laeuft
+bool TSimTrajectory::IsOpen() const
+{
+
+	return Writer.joinable();
+}
+
+// Frame in die Queue stellen (wartet, solange KMCVAR_TRJ_MAXQUEUEBYTES ueberschritten wuerde)
+void TSimTrajectory::EnqueueFrame(TFrame&& i_frame)
+{
+	size_t t_bytes = i_frame.Lattice.capacity() * sizeof(int) + i_frame.Swaps.capacity() * sizeof(uint32_t);
+	unique_lock<mutex> lock(QueueMutex);
+	QueueCondition.wait(lock, [this, t_bytes]() { return ((QueueBytes == 0) || (QueueBytes + t_bytes <= KMCVAR_TRJ_MAXQUEUEBYTES)); });
+	QueueBytes += t_bytes;
+	Queue.push_back(move(i_frame));
+	lock.unlock();
+	QueueCondition.notify_all();
+}
+
+// Schreib-Thread: Frames kodieren und schreiben
+void TSimTrajectory::WriterLoop()
+{
+	string t_buffer;
+	while (true)
+	{
+		unique_lock<mutex> lock(QueueMutex);
+		QueueCondition.wait(lock, [this]() { return ((Queue.empty() == false) || (StopRequested == true)); });
+		if (Queue.empty() == true) break;
+		TFrame t_frame = move(Queue.front());
+		Queue.pop_front();
+		lock.unlock();
+
+		// Speicher erst nach dem Schreiben freigeben
+		size_t t_bytes = t_frame.Lattice.capacity() * sizeof(int) + t_frame.Swaps.capacity() * sizeof(uint32_t);
+		WriteFrame(t_frame, t_buffer);
+		t_frame = TFrame();
+
+		lock.lock();
+		QueueBytes -= t_bytes;
+		lock.unlock();
+		QueueCondition.notify_all();
+	}
+}
+
+// Frame kodieren und in die Datei schreiben
+void TSimTrajectory::WriteFrame(const TFrame& i_frame, string& io_buffer)
+{
+	// Nutzdaten kodieren
+	io_buffer.clear();
+	if (i_frame.IsKey == true)
+	{
+		size_t i = 0;
+		while (i < i_frame.Lattice.size())
+		{
+			size_t t_run = 1;
+			while ((i + t_run < i_frame.Lattice.size()) && (i_frame.Lattice[i + t_run] == i_frame.Lattice[i])) ++t_run;
+			TrajectoryFormat::WriteVarint(io_buffer, TrajectoryFormat::ZigZag(i_frame.Lattice[i]));
+			TrajectoryFormat::WriteVarint(io_buffer, (uint64_t)t_run);
+			i += t_run;
+		}
+	}
+	else
+	{
+		TrajectoryFormat::WriteVarint(io_buffer, (uint64_t)(i_frame.Swaps.size() / 2));
+		for (size_t i = 0; i + 1 < i_frame.Swaps.size(); i += 2)
+		{
+			TrajectoryFormat::WriteVarint(io_buffer, (uint64_t)i_frame.Swaps[i]);
+			TrajectoryFormat::WriteVarint(io_buffer, TrajectoryFormat::ZigZag((int64_t)i_frame.Swaps[i + 1] - (int64_t)i_frame.Swaps[i]));
+		}
+	}
+
+	// Frame-Kopf und Nutzdaten schreiben
+	string t_head;
+	t_head.push_back((char)((i_frame.IsKey == true) ? TrajectoryFormat::KEYFRAME : TrajectoryFormat::DELTAFRAME));
+	TrajectoryFormat::WriteVarint(t_head, (uint64_t)i_frame.MCSP);
+	TrajectoryFormat::WriteVarint(t_head, (uint64_t)io_buffer.size());
+	File.write(t_head.data(), (streamsize)t_head.size());
+	File.write(io_buffer.data(), (streamsize)io_buffer.size());
+	File.flush();
+	if (File.fail() == true) WriteFailed.store(true);
+}
@@ -0,0 +1,132 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimTrajectory											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Recorder for the lattice trajectory of the main simulation:	//
+//	  keyframes (run-length encoded lattice) and delta frames		//
+//	  (vacancy swaps since the last frame, varint encoded),		//
+//	  encoded and written by a background thread					//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TSimTrajectory_H
+#define TSimTrajectory_H
+
+// Includes:
+#include <string>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <fstream>
+#include <cstdint>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Dateiformat (alle Zahlen als Varint, d.h. 7 Bit je Byte, hoechstes Bit = weiteres Byte folgt):
+// Kopf:   KMCPATH_TRJ_MAGIC, LatticeSize, StackSize, Anzahl Gitterplaetze
+// Frame:  Typ (1 Byte: 0 = Keyframe, 1 = Delta-Frame), MCSP, Laenge der Nutzdaten in Byte, Nutzdaten
+//         Keyframe:   Folge von (ZigZag(Wert), Anzahl gleicher Werte) ueber alle Gitterplaetze
+//         Delta-Frame: Anzahl Spruenge, je Sprung Index der Leerstelle (1 -> 0) und ZigZag(Zielindex - Leerstellenindex) (0 -> 1)
+//         (mehr als Anzahl Gitterplaetze / 2 Spruenge seit dem letzten Frame: Keyframe statt Delta-Frame, da dieser nicht groesser ist)
+namespace TrajectoryFormat
+{
+	constexpr uint8_t KEYFRAME = 0;
+	constexpr uint8_t DELTAFRAME = 1;
+
+	inline void WriteVarint(string& o_buffer, uint64_t i_value)
+	{						// Zahl als Varint anhaengen
+		while (i_value >= 0x80)
+		{
+			o_buffer.push_back((char)((i_value & 0x7F) | 0x80));
+			i_value >>= 7;
+		}
+		o_buffer.push_back((char)i_value);
+	}
+
+	inline bool ReadVarint(const char*& io_pos, const char* i_end, uint64_t& o_value)
+	{						// Varint lesen (false = Daten unvollstaendig)
+		o_value = 0;
+		for (int shift = 0; (shift < 64) && (io_pos < i_end); shift += 7)
+		{
+			uint8_t t_byte = (uint8_t)*(io_pos++);
+			o_value |= (uint64_t)(t_byte & 0x7F) << shift;
+			if ((t_byte & 0x80) == 0) return true;
+		}
+		return false;
+	}
+
+	inline uint64_t ZigZag(int64_t i_value)
+	{						// Vorzeichenbehaftete Zahl auf kleine vorzeichenlose Zahl abbilden
+		return ((uint64_t)i_value << 1) ^ (uint64_t)(i_value >> 63);
+	}
+
+	inline int64_t UnZigZag(uint64_t i_value)
+	{						// Umkehrung von ZigZag
+		return (int64_t)(i_value >> 1) ^ -(int64_t)(i_value & 1);
+	}
+}
+
+// Klassendeklaration:
+class TSimTrajectory
+{
+	// Frame, der auf den Schreib-Thread wartet
+	struct TFrame
+	{
+		bool IsKey;						// true = Keyframe (Lattice), false = Delta-Frame (Swaps)
+		unsigned long long MCSP;		// MCSP-Zaehler
+		vector<int> Lattice;			// Gitterabbild (nur Keyframe)
+		vector<uint32_t> Swaps;			// Paare (Leerstellenindex, Zielindex) seit dem letzten Frame (nur Delta-Frame)
+	};
+
+	// Member variables
+protected:
+	vector<uint32_t> Swaps;				// Spruenge seit dem letzten Frame (wird nur von der Simulation geschrieben)
+	size_t SiteCount;					// Anzahl an Gitterplaetzen (< 2^32, siehe Open)
+	size_t SwapLimit;					// Maximale Laenge von Swaps (= SiteCount, d.h. SiteCount / 2 Spruenge), danach wird der naechste Frame ein Keyframe
+	int FrameCounter;					// Frames seit dem letzten Keyframe
+	deque<TFrame> Queue;				// Frames, die auf den Schreib-Thread warten
+	size_t QueueBytes;					// Speicher der Frames in Queue und des gerade geschriebenen Frames
+	mutex QueueMutex;					// Schutz von Queue, QueueBytes und StopRequested
+	condition_variable QueueCondition;	// Signal bei Aenderung von Queue oder StopRequested
+	bool StopRequested;					// Signal an den Schreib-Thread, die Queue abzuarbeiten und sich zu beenden
+	atomic<bool> WriteFailed;			// Flag: true = Schreiben in die Datei ist fehlgeschlagen
+	thread Writer;						// Schreib-Thread
+	ofstream File;						// Zieldatei
+	string Path;						// Pfad der Zieldatei
+
+	// Member functions
+public:
+	int Open(const string& i_path, const int* i_lattice, int i_latticesize, int i_stacksize, unsigned long long i_start_mcsp);		// Datei oeffnen (Frames ab i_start_mcsp werden verworfen), Keyframe schreiben, Schreib-Thread starten
+	void AddFrame(const int* i_lattice, unsigned long long i_mcsp);		// Frame abschliessen und an den Schreib-Thread uebergeben (wartet, falls zu viel Speicher aussteht)
+	int Close();														// Ausstehende Frames schreiben, Schreib-Thread beenden, Datei schliessen
+	bool IsOpen() const;												// true = Aufzeichnung laeuft
+
+	inline void AddSwap(size_t i_vacindex, size_t i_destindex)
+	{						// Sprung aufzeichnen (Leerstelle i_vacindex -> i_destindex), ab SwapLimit verwerfen (naechster Frame wird Keyframe)
+		if (Swaps.size() >= SwapLimit) return;
+		Swaps.push_back((uint32_t)i_vacindex);
+		Swaps.push_back((uint32_t)i_destindex);
+	}
+
+	TSimTrajectory();				// Constructor
+	~TSimTrajectory();				// Destructor, beendet eine laufende Aufzeichnung
+
+	// Member functions
+private:
+	void EnqueueFrame(TFrame&& i_frame);	// Frame in die Queue stellen (wartet, solange KMCVAR_TRJ_MAXQUEUEBYTES ueberschritten wuerde)
+	void WriterLoop();						// Schreib-Thread: Frames kodieren und schreiben
+	void WriteFrame(const TFrame& i_frame, string& io_buffer);		// Frame kodieren und in die Datei schreiben
+
+};
+
+#endif
@@ -0,0 +1,288 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimTrajectoryReader										//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Reader for lattice trajectory files written by				//
+//	  TSimTrajectory: indexes the frames and reconstructs the		//
+//	  lattice of any frame from the preceding keyframe				//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TSimTrajectoryReader.h"
+
+// Includes:
+#include <iostream>
+
+// Eigene Includes:
+#include "ErrorCodes.h"
+#include "GlobalDefinitions.h"
+#include "TSimulation/TSimTrajectory.h"
+
+using namespace std;
+
+// Varint aus Stream lesen (false = Daten unvollstaendig)
+namespace
+{
+	bool ReadStreamVarint(istream& i_stream, uint64_t& o_value)
+	{
+		o_value = 0;
+		for (int shift = 0; shift < 64; shift += 7)
+		{
+			int t_byte = i_stream.get();
+			if (t_byte == char_traits<char>::eof()) return false;
+			o_value |= (uint64_t)(t_byte & 0x7F) << shift;
+			if ((t_byte & 0x80) == 0) return true;
+		}
+		return false;
+	}
+}
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor
+TSimTrajectoryReader::TSimTrajectoryReader() : LatticeSize(0), StackSize(0), SiteCount(0), ValidEnd(0)
+{
+
+}
+
+// Destructor
+TSimTrajectoryReader::~TSimTrajectoryReader()
+{
+
+}
+
+// ************************* MEMBER FUNCTIONS****************************** //
+
+// Datei oeffnen und Frames indexieren (unvollstaendiger letzter Frame wird ignoriert)
+int TSimTrajectoryReader::Open(const string& i_path)
+{
+	Close();
+
+	File.open(i_path, ios::in | ios::binary);
+	if (File.is_open() == false)
+	{
+		cout << "Error: Cannot open trajectory file: " << i_path << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+	File.seekg(0, ios::end);
+	streamoff t_filesize = File.tellg();
+	File.seekg(0, ios::beg);
+
+	// Kopf lesen
+	string t_magic(KMCPATH_TRJ_MAGIC.size(), ' ');
+	uint64_t t_latticesize = 0;
+	uint64_t t_stacksize = 0;
+	uint64_t t_sitecount = 0;
+	if ((File.read(&t_magic[0], (streamsize)t_magic.size()).fail() == true) || (t_magic != KMCPATH_TRJ_MAGIC) ||
+		(ReadStreamVarint(File, t_latticesize) == false) || (ReadStreamVarint(File, t_stacksize) == false) ||
+		(ReadStreamVarint(File, t_sitecount) == false) || (t_latticesize == 0) || (t_stacksize == 0) ||
+		(t_sitecount != t_latticesize * t_latticesize * t_latticesize * t_stacksize))
+	{
+		cout << "Error: Invalid trajectory file header: " << i_path << endl << endl;
+		Close();
+		return KMCERR_INVALID_FILE_FORMAT;
+	}
+	LatticeSize = (int)t_latticesize;
+	StackSize = (int)t_stacksize;
+	SiteCount = (size_t)t_sitecount;
+	ValidEnd = File.tellg();
+
+	// Frames indexieren
+	while (true)
+	{
+		TFrameIndex t_frame;
+		t_frame.FramePos = File.tellg();
+		int t_type = File.get();
+		uint64_t t_mcsp = 0;
+		uint64_t t_size = 0;
+		if ((t_type != TrajectoryFormat::KEYFRAME) && (t_type != TrajectoryFormat::DELTAFRAME)) break;
+		if ((ReadStreamVarint(File, t_mcsp) == false) || (ReadStreamVarint(File, t_size) == false)) break;
+		t_frame.IsKey = (t_type == TrajectoryFormat::KEYFRAME);
+		t_frame.MCSP = t_mcsp;
+		t_frame.DataPos = File.tellg();
+		t_frame.DataSize = (size_t)t_size;
+		if (t_frame.DataPos + (streamoff)t_size > t_filesize) break;
+		Frames.push_back(t_frame);
+		ValidEnd = t_frame.DataPos + (streamoff)t_size;
+		File.seekg(ValidEnd, ios::beg);
+	}
+	File.clear();
+
+	return KMCERR_OK;
+}
+
+// Datei schliessen
+void TSimTrajectoryReader::Close()
+{
+
+	if (File.is_open() == true) File.close();
+	File.clear();
+	LatticeSize = 0;
+	StackSize = 0;
+	SiteCount = 0;
+	Frames.clear();
+	ValidEnd = 0;
+}
+
+// Anzahl an Frames
+size_t TSimTrajectoryReader::GetFrameCount() const
+{
+
+	return Frames.size();
+}
+
+// MCSP und Typ eines Frames ausgeben
+int TSimTrajectoryReader::GetFrameInfo(size_t i_frame, unsigned long long& o_mcsp, bool& o_iskey) const
+{
+	if (i_frame >= Frames.size())
+	{
+		cout << "Error: Invalid trajectory frame: " << i_frame << " (" << Frames.size() << " frames)" << endl << endl;
+		return KMCERR_INVALID_INPUT;
+	}
+
+	o_mcsp = Frames[i_frame].MCSP;
+	o_iskey = Frames[i_frame].IsKey;
+
+	return KMCERR_OK;
+}
+
+// Gitter eines Frames rekonstruieren (Index (((x * LatticeSize + y) * LatticeSize + z) * StackSize + s))
+int TSimTrajectoryReader::GetFrame(size_t i_frame, vector<int>& o_lattice, unsigned long long& o_mcsp)
+{
+	if (i_frame >= Frames.size())
+	{
+		cout << "Error: Invalid trajectory frame: " << i_frame << " (" << Frames.size() << " frames)" << endl << endl;
+		return KMCERR_INVALID_INPUT;
+	}
+
+	// Vorangehenden Keyframe suchen
+	size_t t_key = i_frame;
+	while (Frames[t_key].IsKey == false)
+	{
+		if (t_key == 0)
+		{
+			cout << "Error: No keyframe before trajectory frame: " << i_frame << endl << endl;
+			return KMCERR_INVALID_FILE_CONTENT;
+		}
+		--t_key;
+	}
+
+	// Keyframe dekodieren und Delta-Frames anwenden
+	string t_data;
+	int ErrorCode = ReadData(Frames[t_key], t_data);
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+	ErrorCode = ApplyKeyframe(t_data, o_lattice);
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+	for (size_t i = t_key + 1; i <= i_frame; i++)
+	{
+		ErrorCode = ReadData(Frames[i], t_data);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+		ErrorCode = ApplyDeltaFrame(t_data, o_lattice);
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
+	}
+	o_mcsp = Frames[i_frame].MCSP;
+
+	return KMCERR_OK;
+}
+
+// Gittergroesse und Elementarzellengroesse ausgeben
+int TSimTrajectoryReader::GetLatticeDims(int& o_latticesize, int& o_stacksize) const
+{
+	if (File.is_open() == false) return KMCERR_OBJECT_NOT_READY;
+
+	o_latticesize = LatticeSize;
+	o_stacksize = StackSize;
+
+	return KMCERR_OK;
+}
+
+// Dateiposition des ersten Frames mit MCSP >= i_mcsp (bzw. nach dem letzten vollstaendigen Frame)
+streamoff TSimTrajectoryReader::GetFrameStart(unsigned long long i_mcsp) const
+{
+	for (const TFrameIndex& t_frame : Frames)
+	{
+		if (t_frame.MCSP >= i_mcsp) return t_frame.FramePos;
+	}
+	return ValidEnd;
+}
+
+// Nutzdaten eines Frames lesen
+int TSimTrajectoryReader::ReadData(const TFrameIndex& i_frame, string& o_data)
+{
+	o_data.resize(i_frame.DataSize);
+	File.clear();
+	File.seekg(i_frame.DataPos, ios::beg);
+	if ((i_frame.DataSize > 0) && (File.read(&o_data[0], (streamsize)i_frame.DataSize).fail() == true))
+	{
+		cout << "Error: Cannot read trajectory frame data" << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+	return KMCERR_OK;
+}
+
+// Keyframe dekodieren
+int TSimTrajectoryReader::ApplyKeyframe(const string& i_data, vector<int>& o_lattice) const
+{
+	o_lattice.clear();
+	o_lattice.reserve(SiteCount);
+	const char* t_pos = i_data.data();
+	const char* t_end = t_pos + i_data.size();
+	while (t_pos < t_end)
+	{
+		uint64_t t_value = 0;
+		uint64_t t_run = 0;
+		if ((TrajectoryFormat::ReadVarint(t_pos, t_end, t_value) == false) || (TrajectoryFormat::ReadVarint(t_pos, t_end, t_run) == false) ||
+			(t_run > SiteCount - o_lattice.size()))
+		{
+			cout << "Error: Invalid trajectory keyframe" << endl << endl;
+			return KMCERR_INVALID_FILE_CONTENT;
+		}
+		o_lattice.insert(o_lattice.end(), (size_t)t_run, (int)TrajectoryFormat::UnZigZag(t_value));
+	}
+	if (o_lattice.size() != SiteCount)
+	{
+		cout << "Error: Invalid trajectory keyframe size" << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+	return KMCERR_OK;
+}
+
+// Spruenge eines Delta-Frames anwenden
+int TSimTrajectoryReader::ApplyDeltaFrame(const string& i_data, vector<int>& io_lattice) const
+{
+	const char* t_pos = i_data.data();
+	const char* t_end = t_pos + i_data.size();
+	uint64_t t_count = 0;
+	if (TrajectoryFormat::ReadVarint(t_pos, t_end, t_count) == false)
+	{
+		cout << "Error: Invalid trajectory delta frame" << endl << endl;
+		return KMCERR_INVALID_FILE_CONTENT;
+	}
+	for (uint64_t i = 0; i < t_count; i++)
+	{
+		uint64_t t_vac = 0;
+		uint64_t t_diff = 0;
+		if ((TrajectoryFormat::ReadVarint(t_pos, t_end, t_vac) == false) || (TrajectoryFormat::ReadVarint(t_pos, t_end, t_diff) == false))
+		{
+			cout << "Error: Invalid trajectory delta frame" << endl << endl;
+			return KMCERR_INVALID_FILE_CONTENT;
+		}
+		uint64_t t_dest = (uint64_t)((int64_t)t_vac + TrajectoryFormat::UnZigZag(t_diff));
+
+		// Sprung pruefen: Leerstelle (1) und bewegliches Atom (0) tauschen
+		if ((t_vac >= SiteCount) || (t_dest >= SiteCount) || (io_lattice[(size_t)t_vac] != 1) || (io_lattice[(size_t)t_dest] != 0))
+		{
+			cout << "Error: Inconsistent jump in trajectory delta frame" << endl << endl;
+			return KMCERR_INVALID_FILE_CONTENT;
+		}
+		io_lattice[(size_t)t_vac] = 0;
+		io_lattice[(size_t)t_dest] = 1;
+	}
+	return KMCERR_OK;
+}
@@ -0,0 +1,71 @@
+// **************************************************************** //
+//																	//
+//	Class: TSimTrajectoryReader										//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Reader for lattice trajectory files written by				//
+//	  TSimTrajectory: indexes the frames and reconstructs the		//
+//	  lattice of any frame from the preceding keyframe				//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TSimTrajectoryReader_H
+#define TSimTrajectoryReader_H
+
+// Includes:
+#include <string>
+#include <vector>
+#include <fstream>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TSimTrajectoryReader
+{
+	// Indexeintrag eines Frames
+	struct TFrameIndex
+	{
+		bool IsKey;						// true = Keyframe, false = Delta-Frame
+		unsigned long long MCSP;		// MCSP-Zaehler
+		streamoff FramePos;				// Dateiposition des Frames
+		streamoff DataPos;				// Dateiposition der Nutzdaten
+		size_t DataSize;				// Laenge der Nutzdaten in Byte
+	};
+
+	// Member variables
+protected:
+	ifstream File;						// Trajektorien-Datei
+	int LatticeSize;					// Gittergroesse
+	int StackSize;						// Anzahl an Atomen in der Elementarzelle
+	size_t SiteCount;					// Anzahl an Gitterplaetzen
+	vector<TFrameIndex> Frames;			// Index aller vollstaendigen Frames
+	streamoff ValidEnd;					// Dateiposition nach dem letzten vollstaendigen Frame
+
+	// Member functions
+public:
+	int Open(const string& i_path);											// Datei oeffnen und Frames indexieren (unvollstaendiger letzter Frame wird ignoriert)
+	void Close();															// Datei schliessen
+	size_t GetFrameCount() const;											// Anzahl an Frames
+	int GetFrameInfo(size_t i_frame, unsigned long long& o_mcsp, bool& o_iskey) const;		// MCSP und Typ eines Frames ausgeben
+	int GetFrame(size_t i_frame, vector<int>& o_lattice, unsigned long long& o_mcsp);		// Gitter eines Frames rekonstruieren (Index (((x * LatticeSize + y) * LatticeSize + z) * StackSize + s))
+	int GetLatticeDims(int& o_latticesize, int& o_stacksize) const;		// Gittergroesse und Elementarzellengroesse ausgeben
+	streamoff GetFrameStart(unsigned long long i_mcsp) const;				// Dateiposition des ersten Frames mit MCSP >= i_mcsp (bzw. nach dem letzten vollstaendigen Frame)
+
+	TSimTrajectoryReader();			// Constructor
+	~TSimTrajectoryReader();		// Destructor
+
+	// Member functions
+private:
+	int ReadData(const TFrameIndex& i_frame, string& o_data);				// Nutzdaten eines Frames lesen
+	int ApplyKeyframe(const string& i_data, vector<int>& o_lattice) const;	// Keyframe dekodieren
+	int ApplyDeltaFrame(const string& i_data, vector<int>& io_lattice) const;	// Spruenge eines Delta-Frames anwenden
+
+};
+
+#endif
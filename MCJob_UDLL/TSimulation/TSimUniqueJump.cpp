@@ -17,6 +17,7 @@
 // Includes:
 
 // Eigene Includes:
+#include "TSimAlloc.h"
 
 using namespace std;
 
@@ -76,7 +77,7 @@ void TSimUniqueJump::Clear()
 		hash_map = NULL;
 	}
 
-	delete[] code_energies;
+	TSimAlloc::Delete(code_energies);
 	code_energies = NULL;
 
 	delete[] hash_mult;
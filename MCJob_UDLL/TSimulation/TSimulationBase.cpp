@@ -25,10 +25,19 @@
 #include <limits>
 #include <fstream>
 #include <time.h>
+#include <cstring>
+#include <cstdint>
+#include <chrono>
+#include <filesystem>
 
 // Eigene Includes:
 #include "ErrorCodes.h"
 #include "GlobalDefinitions.h"
+#include "TBlockStreamBuf.h"
+#include "TCompensatedSum.h"
+#include "TMemoryStreamBuf.h"
+#include "TParallel.h"
+#include "TSimAlloc.h"
 #include "TKMCJob/TKMCJob.h"
 #include "TElements/TElements.h"
 #include "TStructure/TStructure.h"
@@ -38,6 +47,32 @@
 
 using namespace std;
 
+// Histogramm der adaptiven Normierung: Bin-Schluessel = Exponent + 2 hoechste Mantissenbits (d.h. Binbreite Faktor 2^(1/4)),
+// Bin 0 enthaelt die Wahrscheinlichkeiten in [2^(-1/4), 1), hoehere Bins kleinere Wahrscheinlichkeiten
+namespace
+{
+	constexpr uint64_t ADAPTNORM_KEYSHIFT = 50;		// 64 - 1 (Vorzeichen) - 11 (Exponent) - 2 (Mantissenbits)
+	constexpr int64_t ADAPTNORM_TOPKEY = 4091;		// Schluessel von 2^(-1/4) (= (1022 << 2) + 3)
+
+	inline int GetAdaptNormBin(double i_prob)
+	{						// Bin einer Wahrscheinlichkeit in [0, 1)
+		uint64_t t_bits = 0;
+		memcpy(&t_bits, &i_prob, sizeof(double));
+		int64_t t_bin = ADAPTNORM_TOPKEY - (int64_t)(t_bits >> ADAPTNORM_KEYSHIFT);
+		if (t_bin < 0) return 0;
+		if (t_bin >= KMCVAR_ADAPTNORM_BINS) return KMCVAR_ADAPTNORM_BINS - 1;
+		return (int)t_bin;
+	}
+
+	inline double GetAdaptNormBinUpper(int i_bin)
+	{						// Obere Grenze (exklusiv) eines Bins
+		uint64_t t_bits = (uint64_t)(ADAPTNORM_TOPKEY + 1 - i_bin) << ADAPTNORM_KEYSHIFT;
+		double t_prob = 0.0;
+		memcpy(&t_prob, &t_bits, sizeof(double));
+		return t_prob;
+	}
+}
+
 // ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
 
 // Constructor, Ready = false setzen
@@ -82,6 +117,17 @@ TSimulationBase::TSimulationBase(TKMCJob* pJob)
 	spProbListSize = 0;
 	spAttemptProbList = NULL;
 	spAcceptedProbList = NULL;
+	spConvTargetError = 0.0;
+	spConvMinMCSP = 0ULL;
+	spConverged = false;
+	spDoAdaptNorm = false;
+	spAdaptNormBudget = 0.0;
+	spAdaptNormUntilMCSP = 0ULL;
+	spAdaptNormHistSum = 0ULL;
+	spObsInterval = 0ULL;
+	spObsPath = "";
+	spTrjInterval = 0ULL;
+	spTrjPath = "";
 }
 
 // Destructor
@@ -234,6 +280,46 @@ int TSimulationBase::LoadCheckPoint()
 	return LoadCheckPoint(CheckPointPath);
 }
 
+// Zufaelliges Startgitter erzeugen und zur Verwendung in weiteren Jobs ausgeben
+// (die Dopandenverteilung haengt nur von Gittergroesse und Dotierung ab, d.h. z.B. alle Temperaturen einer Reihe koennen dasselbe Gitter verwenden)
+int TSimulationBase::CreateSharedStartLattice(shared_ptr<const vector<int>>& o_Lattice)
+{
+	if (Ready != true)
+	{
+		cout << "Critical Error: Object is not ready (TSimulationBase::CreateSharedStartLattice)" << endl << endl;
+		return KMCERR_READY_NOT_TRUE;
+	}
+
+	T4DLattice<int> t_lattice;
+	int ErrorCode = CreateRandomLattice(&t_lattice);
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+	SharedStartLattice = make_shared<const vector<int>>(t_lattice.GetData(), t_lattice.GetData() + t_lattice.GetCount());
+	o_Lattice = SharedStartLattice;
+
+	return KMCERR_OK;
+}
+
+// Gemeinsames Startgitter anstelle eines zufaelligen Startgitters verwenden (wird in SPStartPreparations validiert und kopiert,
+// ein aus dem Checkpoint geladenes Startgitter hat Vorrang)
+int TSimulationBase::SetSharedStartLattice(shared_ptr<const vector<int>> i_Lattice)
+{
+	if (Ready != true)
+	{
+		cout << "Critical Error: Object is not ready (TSimulationBase::SetSharedStartLattice)" << endl << endl;
+		return KMCERR_READY_NOT_TRUE;
+	}
+
+	if ((i_Lattice != NULL) && (i_Lattice->size() != size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spStackSize)))
+	{
+		cout << "Error: Shared start lattice does not match the lattice size of the job." << endl << endl;
+		return KMCERR_INVALID_INPUT;
+	}
+	SharedStartLattice = i_Lattice;
+
+	return KMCERR_OK;
+}
+
 // Simulation durchfuehren
 int TSimulationBase::MakeSimulation()
 {
@@ -418,11 +504,19 @@ bool TSimulationBase::IfCompleted()
 	return Completed;
 }
 
+// Rueckgabe von spConverged (true = Hauptsimulation durch das Konvergenzkriterium beendet)
+bool TSimulationBase::IfConverged()
+{
+	return spConverged;
+}
+
 // ********************* PRIVATE - SIMULATION PHASES ********************** //
 
 // Startvorbereitungen
 int TSimulationBase::SPStartPreparations()
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "SPStartPreparations");
+
 	if (Ready != true)
 	{
 		cout << "Critical Error: Object is not ready (TSimulationBase::SPStartPreparations)" << endl << endl;
@@ -434,19 +528,39 @@ int TSimulationBase::SPStartPreparations()
 	cout << endl;
 	cout << "Start preparations ..." << endl;
 
+	// Histogramm der adaptiven Normierung zuruecksetzen (wird ueber Vorlauf und Hauptsimulation gefuellt)
+	ClearAdaptNormHist();
+
 	// StartLattice erstellen (falls noetig)
-	if (StartLattice.size() == 0)
+	if (StartLattice.IsEmpty() == true)
 	{
 
-		ErrorCode = CreateRandomLattice(&StartLattice);
-		if (ErrorCode != KMCERR_OK) return ErrorCode;
+		if (SharedStartLattice != NULL)
+		{
+			// Gemeinsames Startgitter kopieren und validieren (Dotierung muss zu diesem Job passen)
+			T4DLattice<int> t_lattice;
+			vector<int, TSimAllocator<int>> t_lin_lattice(SharedStartLattice->begin(), SharedStartLattice->end());
+			if ((t_lattice.Assign(spLatticeSize, spStackSize, std::move(t_lin_lattice)) == false) ||
+				(ValidateLattice(&t_lattice) != KMCERR_OK))
+			{
+				cout << "Error: Shared start lattice is not valid for this job." << endl << endl;
+				return KMCERR_INVALID_INPUT;
+			}
+			StartLattice.Swap(t_lattice);
+		}
+		else
+		{
+			ErrorCode = CreateRandomLattice(&StartLattice);
+			if (ErrorCode != KMCERR_OK) return ErrorCode;
+		}
 
 		// -> daraus folgt, dass von hier an neu simuliert wird
 		PrerunPhaseData.Clear();
 		DynNormPhaseData.Clear();
 		MainPhaseData.Clear();
 
-		cout << "  Initial lattice setup complete." << endl;
+		if (SharedStartLattice != NULL) cout << "  Shared initial lattice is used." << endl;
+		else cout << "  Initial lattice setup complete." << endl;
 	}
 	else
 	{
@@ -458,6 +572,9 @@ int TSimulationBase::SPStartPreparations()
 	ErrorCode = LatticeAnalysis("    ", &StartLattice);
 	if (ErrorCode != KMCERR_OK) return ErrorCode;
 
+	// Speicherverbrauch ausgeben
+	MemoryReport("  ");
+
 	cout << "Start preparations finished successfully." << endl;
 
 	return KMCERR_OK;
@@ -466,6 +583,8 @@ int TSimulationBase::SPStartPreparations()
 // Vorbereitungen fuer die Vorlauf-Simulation
 int TSimulationBase::SPPrerunPreparations()
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "SPPrerunPreparations");
+
 	if (Ready != true)
 	{
 		cout << "Critical Error: Object is not ready (TSimulationBase::SPPrerunPreparations)" << endl << endl;
@@ -576,6 +695,20 @@ int TSimulationBase::SPPrerunPreparations()
 	{
 		spNormalization = 1.0;
 	}
+
+	// Adaptive Normierung (waehrend des gesamten Vorlaufs, ausgehend von der bisher verwendeten Normierung)
+	bool DoAdaptNorm = false;
+	double AdaptNormBudget = 0.0;
+	ErrorCode = m_Job->m_Settings->GetAdaptiveNormalization(DoAdaptNorm, AdaptNormBudget);
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+	if (DoAdaptNorm == true)
+	{
+		if (PrerunPhaseData.UsedNorm > spNormalization) spNormalization = PrerunPhaseData.UsedNorm;
+		spDoAdaptNorm = true;
+		spAdaptNormBudget = AdaptNormBudget;
+		spAdaptNormUntilMCSP = spTargetMCSP;
+		cout << "  Adaptive normalization: overkill budget " << spAdaptNormBudget << ", until " << spAdaptNormUntilMCSP << " MCSP" << endl;
+	}
 	cout << "  Normalization: " << spNormalization << endl;
 
 	cout << "  Data transfer complete." << endl;
@@ -600,12 +733,17 @@ int TSimulationBase::SPPrerunPostProcessing()
 	int ErrorCode = PhaseAnalysis("  ", false, PrerunPhaseData, true);
 	if (ErrorCode != KMCERR_OK) return ErrorCode;
 
+	// Speicherverbrauch ausgeben
+	MemoryReport("  ");
+
 	return KMCERR_OK;
 }
 
 // Vorbereitungen fuer die DynNorm-Simulation
 int TSimulationBase::SPDynNormPreparations()
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "SPDynNormPreparations");
+
 	if (Ready != true)
 	{
 		cout << "Critical Error: Object is not ready (TSimulationBase::SPDynNormPreparations)" << endl << endl;
@@ -628,6 +766,23 @@ int TSimulationBase::SPDynNormPreparations()
 	ErrorCode = m_Job->m_Settings->GetDynNormParameters(DoDynNorm, DynNormTargetAttempts, DynNormRecordAnz, DynNormListEntry);
 	if (ErrorCode != KMCERR_OK) return ErrorCode;
 
+	// Adaptive Normierung ersetzt die DynNorm-Phase
+	bool DoAdaptNorm = false;
+	double AdaptNormBudget = 0.0;
+	ErrorCode = m_Job->m_Settings->GetAdaptiveNormalization(DoAdaptNorm, AdaptNormBudget);
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+	if ((DoDynNorm == true) && (DoAdaptNorm == true))
+	{
+
+		DynNormPhaseData.Clear();		// -> HasValidData == false -> Signal an nachfolgende Routinen, dass kein DynNorm durchgefuehrt wurde
+		spTargetJumpAttempts = 0ULL;	// Signal an Hauptroutine, dass DynNorm nicht durchzufuehren ist
+
+		cout << "  Dynamic normalization is replaced by adaptive normalization." << endl;
+		cout << "Dynamic normalization skipped." << endl;
+
+		return KMCERR_OK;
+	}
+
 	// Feststellen, ob DynNorm aktiviert ist
 	if ((DoDynNorm == false) || (DynNormTargetAttempts <= 0LL) || (DynNormRecordAnz <= 0))
 	{
@@ -661,10 +816,10 @@ int TSimulationBase::SPDynNormPreparations()
 
 		DynNormPhaseData.Clear();
 
-		// Gitter vom Prerun uebertragen, falls vorhanden
+		// Gitter vom Prerun uebernehmen, falls vorhanden (Swap statt Kopie, der Prerun behaelt nur Zaehler und Statistiken)
 		if (PrerunPhaseData.HasValidData == true)
 		{
-			DynNormPhaseData.CurrentLattice = PrerunPhaseData.CurrentLattice;
+			DynNormPhaseData.CurrentLattice.Swap(PrerunPhaseData.CurrentLattice);
 		}
 		else
 		{
@@ -745,12 +900,17 @@ int TSimulationBase::SPDynNormPostProcessing()
 	int ErrorCode = PhaseAnalysis("  ", false, DynNormPhaseData, true);
 	if (ErrorCode != KMCERR_OK) return ErrorCode;
 
+	// Speicherverbrauch ausgeben
+	MemoryReport("  ");
+
 	return KMCERR_OK;
 }
 
 // Vorbereitungen fuer die Hauptsimulation 
 int TSimulationBase::SPMainPreparations()
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "SPMainPreparations");
+
 	if (Ready != true)
 	{
 		cout << "Critical Error: Object is not ready (TSimulationBase::SPMainPreparations)" << endl << endl;
@@ -778,6 +938,24 @@ int TSimulationBase::SPMainPreparations()
 		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 	}
 
+	// Konvergenzkriterium ermitteln
+	double ConvTargetError = 0.0;
+	long long ConvMinMCSP = 0LL;
+	ErrorCode = m_Job->m_Settings->GetConvergenceOptions(ConvTargetError, ConvMinMCSP);
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+	// Adaptive Normierung ermitteln
+	bool DoAdaptNorm = false;
+	double AdaptNormBudget = 0.0;
+	ErrorCode = m_Job->m_Settings->GetAdaptiveNormalization(DoAdaptNorm, AdaptNormBudget);
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+	// Observablen- und Trajektorienaufzeichnung ermitteln
+	long long ObsInterval = 0LL;
+	long long TrjInterval = 0LL;
+	ErrorCode = m_Job->m_Settings->GetObservablesOptions(ObsInterval, TrjInterval);
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+
 	// Feststellen, ob Simulation schon komplett durchgefuehrt wurde
 	if ((MainPhaseData.HasValidData == true) && (MainPhaseData.CurrentMCSP >= (unsigned long long) MainTargetMCSP))
 	{
@@ -791,21 +969,36 @@ int TSimulationBase::SPMainPreparations()
 		return KMCERR_OK;
 	}
 
+	// Feststellen, ob Simulation bereits durch das Konvergenzkriterium beendet wurde
+	if ((MainPhaseData.HasValidData == true) && (ConvTargetError > 0.0) && (MainPhaseData.CurrentMCSP >= (unsigned long long) ConvMinMCSP) &&
+		(MainPhaseData.CurrentConvergence.IfConverged(ConvTargetError, spCanCalcCond) == true))
+	{
+
+		spMCSP = MainPhaseData.CurrentMCSP;						// Signal an Hauptroutine, dass Simulation schon fertig ist
+		spTargetMCSP = MainPhaseData.CurrentMCSP;
+		spConverged = true;										// Signal an MakeResults, dass die Simulation durch das Konvergenzkriterium beendet wurde
+
+		cout << "  Main simulation is already converged (" << MainPhaseData.CurrentMCSP << " of " << MainTargetMCSP << " MCSP, target error: " << ConvTargetError << ")." << endl;
+		cout << "Main simulation skipped." << endl;
+
+		return KMCERR_OK;
+	}
+
 	// PhaseData erstellen (wenn nicht vorher bereits geladen)
 	if (MainPhaseData.HasValidData == false)
 	{
 		MainPhaseData.Clear();
 
-		// Gitter aus DynNorm oder Prerun uebertragen, falls moeglich
+		// Gitter aus DynNorm oder Prerun uebernehmen, falls moeglich (Swap statt Kopie, die vorherige Phase behaelt nur Zaehler und Statistiken)
 		if (DynNormPhaseData.HasValidData == true)
 		{
-			MainPhaseData.CurrentLattice = DynNormPhaseData.CurrentLattice;
+			MainPhaseData.CurrentLattice.Swap(DynNormPhaseData.CurrentLattice);
 		}
 		else
 		{
 			if (PrerunPhaseData.HasValidData == true)
 			{
-				MainPhaseData.CurrentLattice = PrerunPhaseData.CurrentLattice;
+				MainPhaseData.CurrentLattice.Swap(PrerunPhaseData.CurrentLattice);
 			}
 			else
 			{
@@ -831,6 +1024,12 @@ int TSimulationBase::SPMainPreparations()
 			MainPhaseData.UsedNorm = 1.0;
 		}
 
+		// Adaptive Normierung: mit der im Vorlauf erreichten Normierung fortfahren
+		if ((DoAdaptNorm == true) && (PrerunPhaseData.HasValidData == true) && (PrerunPhaseData.UsedNorm > MainPhaseData.UsedNorm))
+		{
+			MainPhaseData.UsedNorm = PrerunPhaseData.UsedNorm;
+		}
+
 		MainPhaseData.HasValidData = true;
 
 		cout << "  New main simulation data was created." << endl;
@@ -853,9 +1052,62 @@ int TSimulationBase::SPMainPreparations()
 	// Zielparameter setzen
 	spTargetMCSP = (unsigned long long) MainTargetMCSP;
 	spTargetJumpAttempts = 0ULL;
+	spConvTargetError = ConvTargetError;
+	spConvMinMCSP = (unsigned long long) ConvMinMCSP;
+	if (spConvTargetError > 0.0)
+	{
+		cout << "  Convergence target: " << spConvTargetError << " (relative standard error of the ";
+		cout << ((spCanCalcCond == true) ? "conductivity" : "mean squared displacement") << ", min. " << spConvMinMCSP << " MCSP)" << endl;
+	}
+
+	// Observablen-Zeitreihe und Gittertrajektorie (neben der CheckPoint-Datei, ohne CheckPoint-Pfad keine Aufzeichnung,
+	// Observablen ohne CheckPoint-Pfad nur an einen ggf. gesetzten Callback)
+	string RecordBasePath = GetRecordBasePath();
+	if ((ObsInterval > 0LL) && (CheckPointPath != ""))
+	{
+		spObsInterval = (unsigned long long) ObsInterval;
+		spObsPath = RecordBasePath + string(KMCPATH_OBS_EXT);
+		cout << "  Observables time series: every " << spObsInterval << " MCSP (" << spObsPath << ")" << endl;
+	}
+	else if ((ObsInterval > 0LL) && (m_Job->GetSimCallbacks().Observables))
+	{
+		spObsInterval = (unsigned long long) ObsInterval;
+		spObsPath = "";
+		cout << "  Observables time series: every " << spObsInterval << " MCSP (callback only)" << endl;
+	}
+	else if (ObsInterval > 0LL)
+	{
+		cout << "  Observables time series: disabled (no checkpoint path)" << endl;
+	}
+	if ((TrjInterval > 0LL) && (CheckPointPath != ""))
+	{
+		spTrjInterval = (unsigned long long) TrjInterval;
+		spTrjPath = RecordBasePath + string(KMCPATH_TRJ_EXT);
+		cout << "  Lattice trajectory: every " << spTrjInterval << " MCSP (" << spTrjPath << ")" << endl;
+	}
+	else if (TrjInterval > 0LL)
+	{
+		cout << "  Lattice trajectory: disabled (no checkpoint path)" << endl;
+	}
 
-	// Normierung setzen (aus dyn. Normierung falls moeglich)
-	if ((DynNormPhaseData.HasValidData == false) || (DynNormPhaseData.CurrentAttemptProbList.size() == 0))
+	// Normierung setzen (adaptiv, aus dyn. Normierung falls moeglich)
+	if (DoAdaptNorm == true)
+	{
+		if ((spHighestProb > 0.0) && (spHighestProb < 1.0))
+		{
+			spNormalization = 1.0 / spHighestProb;
+		}
+		else
+		{
+			spNormalization = 1.0;
+		}
+		if (MainPhaseData.UsedNorm > spNormalization) spNormalization = MainPhaseData.UsedNorm;
+		spDoAdaptNorm = true;
+		spAdaptNormBudget = AdaptNormBudget;
+		spAdaptNormUntilMCSP = (unsigned long long)(KMCVAR_ADAPTNORM_MAINFRACTION * double(MainTargetMCSP));
+		cout << "  Adaptive normalization: overkill budget " << spAdaptNormBudget << ", until " << spAdaptNormUntilMCSP << " MCSP" << endl;
+	}
+	else if ((DynNormPhaseData.HasValidData == false) || (DynNormPhaseData.CurrentAttemptProbList.size() == 0))
 	{
 		if ((spHighestProb > 0.0) && (spHighestProb < 1.0))
 		{
@@ -966,12 +1218,17 @@ int TSimulationBase::SPMainPostProcessing()
 	int ErrorCode = PhaseAnalysis("  ", false, MainPhaseData, true);
 	if (ErrorCode != KMCERR_OK) return ErrorCode;
 
+	// Speicherverbrauch ausgeben
+	MemoryReport("  ");
+
 	return KMCERR_OK;
 }
 
 // Simulationsroutine: KMC-Simulation durchfuehren (Achtung: alle Parameter muessen korrekt gesetzt sein -> keine weitere Pruefung)
 int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "SPSimulate");
+
 	if (Ready != true)
 	{
 		cout << "Critical Error: Object is not ready (TSimulationBase::SPSimulate)" << endl << endl;
@@ -980,13 +1237,27 @@ int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 
 	// Zusaetzliche Variablen initialisieren (isp = internal simulation parameters)
 	int ispErrorCode = KMCERR_OK;					// Fehlercode
-	streamsize ispCoutPrecision = cout.precision();	// Standardanzahl an Stellen bei der Double-Ausgabe
 	unsigned long long ispMaxMCSP = 0ULL;			// Maximale MCSP
 	unsigned long long ispMaxAttempts = 0ULL;		// Maximale JumpAttempts
 	double ispNextShortProgress = 0.01;				// Gibt die Prozentzahl an, bei der der naechste kurze Forschrittsbericht ausgegeben wird
 	double ispNextLongProgress = 0.1;				// Gibt die Prozentzahl an, bei der der naechste lange Forschrittsbericht ausgegeben wird
 	bool ispIsMCSPLimited = false;					// Flag: true = MCSP sind limitiert, false = JumpAttempts sind limitiert
 	bool ispIsSavingProbs = false;					// Flag fuer Wahrscheinlichkeitsaufzeichnung: true = wird durchgefuehrt, false = deaktiviert
+	bool ispIsCheckingConv = false;					// Flag fuer Konvergenzpruefung: true = Blockmittelung wird durchgefuehrt, false = deaktiviert
+	T3DVector ispConvDisp;							// Summe der Verschiebungen der beweglichen Spezies im aktuellen MCSP (fuer Konvergenzpruefung)
+	double ispConvSqDisp = 0.0;						// Zuwachs der Summe der Verschiebungsquadrate der beweglichen Spezies im aktuellen MCSP (fuer Konvergenzpruefung)
+	double ispConvLastTime = 0.0;					// spAttemptPathRatioSum am Beginn des aktuellen MCSP (fuer Konvergenzpruefung)
+	bool ispIsRecordingObs = false;					// Flag fuer Observablen-Zeitreihe: true = Messpunkte werden aufgezeichnet, false = deaktiviert
+	bool ispIsWritingObs = false;					// Flag fuer Observablen-Zeitreihe: true = Messpunkte werden in die Datei geschrieben
+	bool ispIsTrackingDisp = false;					// Flag: true = ispConvDisp und ispConvSqDisp werden je Sprung fortgeschrieben (Konvergenzpruefung oder Observablen)
+	T3DVector ispObsSumDisp;						// Summe der Verschiebungen der beweglichen Spezies seit Phasenbeginn in Angstrom (fuer Observablen)
+	double ispObsSumSqDisp = 0.0;					// Summe der Verschiebungsquadrate der beweglichen Spezies seit Phasenbeginn in Angstrom^2 (fuer Observablen)
+	TSimObservables ispObs;							// Aufzeichnung der Observablen-Zeitreihe (Ringpuffer und Schreib-Thread)
+	bool ispIsRecordingTrj = false;					// Flag fuer Gittertrajektorie: true = Spruenge und Frames werden aufgezeichnet, false = deaktiviert
+	TSimTrajectory ispTrj;							// Aufzeichnung der Gittertrajektorie (Frame-Queue und Schreib-Thread)
+	bool ispIsAdaptingNorm = false;					// Flag fuer adaptive Normierung: true = Histogramm wird aufgezeichnet und Normierung angepasst, false = deaktiviert
+	bool ispIsPublishing = false;					// Flag fuer Telemetrie: true = Zaehler werden einmal pro MCSP veroeffentlicht, false = weder Telemetrie noch Fortschritts-Callback aktiv
+	const TSimCallbacks& ispCallbacks = m_Job->GetSimCallbacks();	// Callbacks der Simulation (Fortschritt, Observablen)
 
 	// Loop-Zielwerte aufsetzen
 	if (numeric_limits<unsigned long long>::is_specialized == false)
@@ -1026,11 +1297,51 @@ int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 	// Wahrscheinlichkeitsspeicherflag setzen
 	ispIsSavingProbs = (spProbListSize > 0);
 
+	// Konvergenzpruefung aktivieren (nur bei MCSP-limitierter Simulation)
+	spConverged = false;
+	ispIsCheckingConv = ((spConvTargetError > 0.0) && (ispIsMCSPLimited == true));
+	ispConvDisp.Set(0.0, 0.0, 0.0);
+	ispConvLastTime = spAttemptPathRatioSum;
+
+	// Observablen-Zeitreihe aktivieren (Summen einmalig aus dem Bewegungsgitter, danach inkrementell je Sprung)
+	if ((spObsInterval > 0ULL) && (&ispPhase == &MainPhaseData))
+	{
+		vector<double> ispObsStart;
+		ispErrorCode = MovLatticeAnalysis(&(ispPhase.CurrentLattice), &(ispPhase.CurrentMovLattice), &ispObsStart);
+		if (ispErrorCode != KMCERR_OK) return ispErrorCode;
+		ispObsSumDisp.Set(ispObsStart[6] * 1.0E+08, ispObsStart[7] * 1.0E+08, ispObsStart[8] * 1.0E+08);
+		ispObsSumSqDisp = ispObsStart[5] * 1.0E+16 * double(spTotalMovAnz);
+		ispIsWritingObs = ((spObsPath != "") && (ispObs.Open(spObsPath, spMCSP) == KMCERR_OK));
+		ispIsRecordingObs = ((ispIsWritingObs == true) || (ispCallbacks.Observables));
+	}
+	ispIsTrackingDisp = ((ispIsCheckingConv == true) || (ispIsRecordingObs == true));
+
+	// Gittertrajektorie aktivieren (Keyframe des aktuellen Gitters, danach Spruenge je Frame)
+	if ((spTrjInterval > 0ULL) && (&ispPhase == &MainPhaseData))
+	{
+		ispIsRecordingTrj = (ispTrj.Open(spTrjPath, spLattice, spLatticeSize, spStackSize, spMCSP) == KMCERR_OK);
+	}
+
+	// Adaptive Normierung aktivieren (nur bei MCSP-limitierter Simulation)
+	ispIsAdaptingNorm = ((spDoAdaptNorm == true) && (ispIsMCSPLimited == true) && (spMCSP < spAdaptNormUntilMCSP));
+	if ((ispIsAdaptingNorm == true) && ((int)spAdaptNormHist.size() != KMCVAR_ADAPTNORM_BINS)) ClearAdaptNormHist();
+
+	// Telemetrie anmelden (Abmeldung beim Verlassen der Routine)
+	spTelemetry.JobName = GetRecordBasePath();
+	spTelemetry.Phase.store((&ispPhase == &MainPhaseData) ? TSimTelemetryCounters::Main :
+		((&ispPhase == &DynNormPhaseData) ? TSimTelemetryCounters::DynNorm : TSimTelemetryCounters::Prerun), memory_order_relaxed);
+	spTelemetry.TargetMCSP.store(spTargetMCSP, memory_order_relaxed);
+	spTelemetry.TargetJumpAttempts.store(spTargetJumpAttempts, memory_order_relaxed);
+	PublishTelemetry();
+	TSimTelemetryScope ispTelemetry(&spTelemetry);
+	ispIsPublishing = ((ispTelemetry.IsActive() == true) || (ispCallbacks.Progress));
+
 	// Start-Zeit speichern, Laufzeit setzen
 	cout << "Simulation started at ";
 	spStartTime = TCustomTime::GetCurrentTime(true);
 	cout << endl;
 	spRunTime = spPreviousRunTime;
+	if (m_Job != NULL) m_Job->m_Profile.MarkFirstStep();
 
 	// Start: ------------- Aeussere KMC-Schleife --------------
 	while ((spMCSP < ispMaxMCSP) && (spJumpAttempts < ispMaxAttempts))
@@ -1042,8 +1353,9 @@ int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 			{
 				// ShortProgress wird in jedem Fall hochgesetzt, d.h. es kann zwischendurch als Fortschrittspeicher verwendet werden
 				ispNextShortProgress = double(spMCSP) / double(ispMaxMCSP);
-				cout << "Progress: ";
-				cout << fixed << setprecision(1) << ispNextShortProgress * 100.0 << resetiosflags(ios::floatfield) << setprecision(ispCoutPrecision);
+				ostringstream ispProgressStream;		// Formatierung getrennt von cout (cout wird ggf. von mehreren Jobs gleichzeitig verwendet)
+				ispProgressStream << fixed << setprecision(1) << ispNextShortProgress * 100.0;
+				cout << "Progress: " << ispProgressStream.str();
 				cout << " % (" << spMCSP << " of " << ispMaxMCSP << " MCSP)" << endl;
 
 				// Laufzeit setzen
@@ -1081,8 +1393,9 @@ int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 
 				// ShortProgress wird in jedem Fall hochgesetzt, d.h. es kann zwischendurch als Fortschrittsspeicher verwendet werden
 				ispNextShortProgress = double(spJumpAttempts) / double(ispMaxAttempts);
-				cout << "Progress: ";
-				cout << fixed << setprecision(1) << ispNextShortProgress * 100 << resetiosflags(ios::floatfield) << setprecision(ispCoutPrecision);
+				ostringstream ispProgressStream;		// Formatierung getrennt von cout (cout wird ggf. von mehreren Jobs gleichzeitig verwendet)
+				ispProgressStream << fixed << setprecision(1) << ispNextShortProgress * 100;
+				cout << "Progress: " << ispProgressStream.str();
 				cout << " % (" << spJumpAttempts << " of " << ispMaxAttempts << " Jump Attempts)" << endl;
 
 				// Laufzeit setzen
@@ -1114,6 +1427,13 @@ int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 			}
 		}
 
+		// Zaehler fuer die Telemetrie und den Fortschritts-Callback veroeffentlichen (einmal pro MCSP, nur atomare Speicherzugriffe, keine Ausgabe)
+		if (ispIsPublishing == true)
+		{
+			PublishTelemetry();
+			if (ispCallbacks.Progress) ispCallbacks.Progress(spTelemetry);
+		}
+
 		// Start: ------------- Innere KMC-Schleife --------------
 		// Performance-relevanter Bereich: alle Sprungablehnungen finden in dieser inneren Schleife statt, 
 		// sodass diese in der Regel deutlich haeufiger durchlaufen wird als die aeussere Schleife.
@@ -1335,6 +1655,13 @@ int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 					}
 				}
 
+				// Unnormierte Wahrscheinlichkeit fuer die adaptive Normierung aufzeichnen
+				if (ispIsAdaptingNorm == true)
+				{
+					++spAdaptNormHist[GetAdaptNormBin(ispCurrProb)];
+					++spAdaptNormHistSum;
+				}
+
 				// Normierung hinzufuegen
 				ispCurrProb *= spNormalization;
 
@@ -1529,6 +1856,16 @@ int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 				ispCurrVac->z) * spMovStackSize + ispCurrVac->s);
 			T3DMovVector* ispCurrDestMov = spMovLattice + ((((size_t)isp4DDestX * spLatticeSize + isp4DDestY) * spLatticeSize +
 				isp4DDestZ) * spMovStackSize + isp4DDestS);
+			if (ispIsTrackingDisp == true)
+			{
+				// Atom am Zielplatz wird um -jump_vec verschoben: |d - v|^2 - |d|^2 = v * (v - 2 d)
+				ispConvSqDisp += ispCurrJump->jump_vec.x * (ispCurrJump->jump_vec.x - 2.0 * ispCurrDestMov->x) +
+					ispCurrJump->jump_vec.y * (ispCurrJump->jump_vec.y - 2.0 * ispCurrDestMov->y) +
+					ispCurrJump->jump_vec.z * (ispCurrJump->jump_vec.z - 2.0 * ispCurrDestMov->z);
+				ispConvDisp.x -= ispCurrJump->jump_vec.x;
+				ispConvDisp.y -= ispCurrJump->jump_vec.y;
+				ispConvDisp.z -= ispCurrJump->jump_vec.z;
+			}
 			++(ispCurrStartMov->jcount);
 			++(ispCurrDestMov->jcount);
 			ispCurrStartMov->x += ispCurrJump->jump_vec.x;
@@ -1544,8 +1881,10 @@ int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 			*ispCurrDestMov = ispSwapMov;
 
 			// Gitterpositionen tauschen
-			spLattice[(((size_t)ispCurrVac->x * spLatticeSize + ispCurrVac->y) * spLatticeSize + ispCurrVac->z) * spStackSize + ispCurrVac->s] = 0;
+			size_t ispCurrVacIndex = (((size_t)ispCurrVac->x * spLatticeSize + ispCurrVac->y) * spLatticeSize + ispCurrVac->z) * spStackSize + ispCurrVac->s;
+			spLattice[ispCurrVacIndex] = 0;
 			spLattice[ispCurrDestIndex] = 1;
+			if (ispIsRecordingTrj == true) ispTrj.AddSwap(ispCurrVacIndex, ispCurrDestIndex);
 
 			// Auswahlarrays und Leerstellenposition aktualisieren
 			int ispDestDirType = spDirLink[isp4DDestS];
@@ -1591,19 +1930,119 @@ int TSimulationBase::SPSimulate(TSimPhaseInfo& ispPhase)
 		if (ispMovCounter >= spTotalMovAnz)
 		{
 			++spMCSP;
+
+			// Observablen fortschreiben und ggf. Messpunkt aufzeichnen (einmal pro MCSP, daher nicht Performance-relevant)
+			if (ispIsRecordingObs == true)
+			{
+				ispObsSumDisp.x += ispConvDisp.x;
+				ispObsSumDisp.y += ispConvDisp.y;
+				ispObsSumDisp.z += ispConvDisp.z;
+				ispObsSumSqDisp += ispConvSqDisp;
+				if (ispIsCheckingConv == false)
+				{
+					ispConvDisp.Set(0.0, 0.0, 0.0);
+					ispConvSqDisp = 0.0;
+				}
+				if (spMCSP % spObsInterval == 0ULL)
+				{
+					TSimObsSample ispSample;
+					double ispInvMovAnz = 1.0 / double(spTotalMovAnz);
+					ispSample.MCSP = spMCSP;
+					ispSample.Time = spAttemptPathRatioSum * spNormalization / spFrequency;
+					ispSample.MSD = ispObsSumSqDisp * 1.0E-16 * ispInvMovAnz;
+					ispSample.COMx = ispObsSumDisp.x * 1.0E-08 * ispInvMovAnz;
+					ispSample.COMy = ispObsSumDisp.y * 1.0E-08 * ispInvMovAnz;
+					ispSample.COMz = ispObsSumDisp.z * 1.0E-08 * ispInvMovAnz;
+					ispSample.CollMSD = (ispObsSumDisp.x * ispObsSumDisp.x + ispObsSumDisp.y * ispObsSumDisp.y +
+						ispObsSumDisp.z * ispObsSumDisp.z) * 1.0E-16 * ispInvMovAnz;
+					ispSample.HavenRatio = (ispSample.CollMSD > 0.0) ? ispSample.MSD / ispSample.CollMSD : 0.0;
+					ispSample.Conductivity = 0.0;
+					if ((spCanCalcCond == true) && (spAttemptPathRatioSum > 0.0))
+					{
+						double ispObsParallel = 0.0;
+						double ispObsPerpendicular = 0.0;
+						ispErrorCode = GetProjOnEField(T3DVector(ispSample.COMx, ispSample.COMy, ispSample.COMz), ispObsParallel, ispObsPerpendicular);
+						if (ispErrorCode != KMCERR_OK) return ispErrorCode;
+						ispSample.Conductivity = spCondFactor * spFrequency * ispObsParallel / (spAttemptPathRatioSum * spNormalization);
+					}
+					if (ispIsWritingObs == true) ispObs.Push(ispSample);
+					if (ispCallbacks.Observables) ispCallbacks.Observables(ispSample);
+				}
+			}
+
+			// Trajektorien-Frame abschliessen (Kodierung und Schreiben im Schreib-Thread)
+			if ((ispIsRecordingTrj == true) && (spMCSP % spTrjInterval == 0ULL))
+			{
+				ispTrj.AddFrame(spLattice, spMCSP);
+			}
+
+			// Blockmittelung fortfuehren und Konvergenz pruefen (einmal pro MCSP, daher nicht Performance-relevant)
+			if (ispIsCheckingConv == true)
+			{
+				double ispConvParallel = 0.0;
+				double ispConvPerpendicular = 0.0;
+				if (spCanCalcCond == true)
+				{
+					ispErrorCode = GetProjOnEField(ispConvDisp, ispConvParallel, ispConvPerpendicular);
+					if (ispErrorCode != KMCERR_OK) return ispErrorCode;
+				}
+				bool ispBlockClosed = ispPhase.CurrentConvergence.AddMCSP(ispConvParallel, ispConvSqDisp, spAttemptPathRatioSum - ispConvLastTime);
+				ispConvDisp.Set(0.0, 0.0, 0.0);
+				ispConvSqDisp = 0.0;
+				ispConvLastTime = spAttemptPathRatioSum;
+				if ((ispBlockClosed == true) && (spMCSP >= spConvMinMCSP))
+				{
+					if (ispPhase.CurrentConvergence.IfConverged(spConvTargetError, spCanCalcCond) == true)
+					{
+						spConverged = true;
+						break;
+					}
+				}
+			}
+
+			// Normierung adaptiv anheben (einmal pro MCSP, daher nicht Performance-relevant)
+			if (ispIsAdaptingNorm == true)
+			{
+				ispErrorCode = AdaptNormalization(ispPhase);
+				if (ispErrorCode != KMCERR_OK) return ispErrorCode;
+				ispConvLastTime = spAttemptPathRatioSum;
+				if (spMCSP >= spAdaptNormUntilMCSP)
+				{
+					ispIsAdaptingNorm = false;
+					cout << "Adaptive normalization finished at " << spMCSP << " MCSP (normalization: " << spNormalization << ")" << endl;
+				}
+			}
 		}
 	}
 	// Ende: -------------- Aeussere KMC-Schleife --------------
 
+	// Endstand fuer die Telemetrie und den Fortschritts-Callback veroeffentlichen
+	if (ispIsPublishing == true)
+	{
+		PublishTelemetry();
+		if (ispCallbacks.Progress) ispCallbacks.Progress(spTelemetry);
+	}
+
+	// Observablen- und Trajektorienaufzeichnung abschliessen (Fehler beim Schreiben beenden die Simulation nicht)
+	if (ispIsWritingObs == true) ispObs.Close();
+	if (ispIsRecordingTrj == true) ispTrj.Close();
+
 	// Ergebnis ausgeben
 	if (ispIsMCSPLimited == true)
 	{
-		if (spMCSP != ispMaxMCSP)
+		if (spConverged == true)
 		{
-			cout << "Critical Error: JumpAttempts counter variable limit reached (TSimulationBase::SPSimulate)" << endl << endl;
-			return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
+			cout << "Convergence reached after " << spMCSP << " of " << ispMaxMCSP << " MCSP (target error: " << spConvTargetError << ")" << endl;
+		}
+		else
+		{
+			if (spMCSP != ispMaxMCSP)
+			{
+				cout << "Critical Error: JumpAttempts counter variable limit reached (TSimulationBase::SPSimulate)" << endl << endl;
+				return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
+			}
+			cout << "Progress: 100 % (" << spMCSP << " of " << ispMaxMCSP << " MCSP)" << endl;
 		}
-		cout << "Progress: 100 % (" << spMCSP << " of " << ispMaxMCSP << " MCSP)" << endl;
 	}
 	else
 	{
@@ -1660,7 +2099,8 @@ void TSimulationBase::Clear()
 	}
 
 	CheckPointPath = "";
-	StartLattice.clear();
+	StartLattice.Clear();
+	SharedStartLattice.reset();
 
 	PrerunPhaseData.Clear();
 	DynNormPhaseData.Clear();
@@ -1679,6 +2119,7 @@ void TSimulationBase::Clear()
 	spCanCalcCond = false;
 	spCondFactor = 0.0;
 
+	ClearAdaptNormHist();
 	ClearCurrentSim();
 
 }
@@ -1687,9 +2128,7 @@ void TSimulationBase::Clear()
 void TSimulationBase::ClearCurrentSim()
 {
 
-	delete[] spLattice;
 	spLattice = NULL;
-	delete[] spMovLattice;
 	spMovLattice = NULL;
 	delete[] spVacListSizes;
 	spVacListSizes = NULL;
@@ -1703,7 +2142,7 @@ void TSimulationBase::ClearCurrentSim()
 		{
 			for (int i = spDirSelCount - 1; i >= 0; i--)
 			{
-				delete[] spVacLists[i];
+				TSimAlloc::Delete(spVacLists[i]);
 				spVacLists[i] = NULL;
 			}
 		}
@@ -1723,12 +2162,78 @@ void TSimulationBase::ClearCurrentSim()
 	spNormalization = 1.0;
 	spAttemptPathRatioSum = 0.0;
 	spProbListSize = 0;
+	spConvTargetError = 0.0;
+	spConvMinMCSP = 0ULL;
+	spConverged = false;
+	spDoAdaptNorm = false;
+	spAdaptNormBudget = 0.0;
+	spAdaptNormUntilMCSP = 0ULL;
+	spObsInterval = 0ULL;
+	spObsPath = "";
+	spTrjInterval = 0ULL;
+	spTrjPath = "";
 	spPreviousRunTime = TCustomTime();
 	spStartTime = TCustomTime();
 	spRunTime = TCustomTime();
 
 }
 
+// Histogramm der adaptiven Normierung zuruecksetzen
+void TSimulationBase::ClearAdaptNormHist()
+{
+
+	spAdaptNormHist.assign(KMCVAR_ADAPTNORM_BINS, 0ULL);
+	spAdaptNormHistSum = 0ULL;
+
+}
+
+// Normierung anhand von spAdaptNormHist anheben und Zeitsumme sowie Wahrscheinlichkeitslisten umskalieren
+int TSimulationBase::AdaptNormalization(TSimPhaseInfo& ispPhase)
+{
+	if ((int)spAdaptNormHist.size() != KMCVAR_ADAPTNORM_BINS)
+	{
+		cout << "Critical Error: Invalid adaptive normalization histogram (TSimulationBase::AdaptNormalization)" << endl << endl;
+		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
+	}
+
+	// Erst anpassen, wenn der Overkill-Bereich statistisch erfasst ist
+	double t_allowed = spAdaptNormBudget * double(spAdaptNormHistSum);
+	if (t_allowed < KMCVAR_ADAPTNORM_MINTAILCOUNT) return KMCERR_OK;
+
+	// Von den hoechsten Wahrscheinlichkeiten aus den ersten Bin suchen, der das Budget ueberschreitet
+	// -> alle Versuche in hoeheren Bins duerfen nach der Normierung >= 1 sein
+	unsigned long long t_overkill = 0ULL;
+	int t_bin = 0;
+	for (t_bin = 0; t_bin < KMCVAR_ADAPTNORM_BINS - 1; t_bin++)
+	{
+		if (double(t_overkill + spAdaptNormHist[t_bin]) > t_allowed) break;
+		t_overkill += spAdaptNormHist[t_bin];
+	}
+	double t_newnorm = 1.0 / GetAdaptNormBinUpper(t_bin);
+
+	// Nur anheben, und nur um mindestens eine Binbreite (verhindert Anpassungen aufgrund von Rauschen)
+	if (t_newnorm * GetAdaptNormBinUpper(1) < KMCVAR_EQTHRESHOLD_PROBMINUS * spNormalization) return KMCERR_OK;
+
+	// Zeitbuchhaltung: simulierte Zeit = AttemptPathRatioSum * Normierung / Frequenz
+	// -> bisherige Summe auf die neue Normierung umrechnen, damit die Zeit jedes Normierungsabschnitts erhalten bleibt
+	double t_scale = spNormalization / t_newnorm;
+	spAttemptPathRatioSum *= t_scale;
+	ispPhase.CurrentConvergence.ScaleTime(t_scale);
+
+	// Wahrscheinlichkeitslisten auf die neue Normierung umrechnen
+	for (int i = 0; i < spProbListSize; i++)
+	{
+		spAttemptProbList[i].prob /= t_scale;
+		spAcceptedProbList[i].prob /= t_scale;
+	}
+
+	cout << "Adaptive normalization: " << spNormalization << " -> " << t_newnorm << " (at " << spMCSP << " MCSP, estimated overkill fraction: ";
+	cout << double(t_overkill) / double(spAdaptNormHistSum) << ")" << endl;
+	spNormalization = t_newnorm;
+
+	return KMCERR_OK;
+}
+
 // Alle Einstellungsklassen auf Existenz und Ready = true pruefen
 int TSimulationBase::IfAllClassesReady() const
 {
@@ -1800,6 +2305,8 @@ int TSimulationBase::IfAllClassesReady() const
 // Hoechstmoegliche Wahrscheinlichkeit (ohne Normierung) berechnen
 int TSimulationBase::GetHighestProb(double& o_prob) const
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "GetHighestProb");
+
 	if (Ready != true)
 	{
 		cout << "Critical Error: Object is not ready for normalization (TSimulationBase::GetHighestProb)" << endl << endl;
@@ -1962,8 +2469,10 @@ int TSimulationBase::GetCondFactor(bool& o_cancalccond, double& o_freq, double&
 }
 
 // Gitter mit zufaelliger Verteilung der Dopanden und Leerstellen erzeugen
-int TSimulationBase::CreateRandomLattice(vector<vector<vector<vector<int>>>>* o_lattice)
+int TSimulationBase::CreateRandomLattice(T4DLattice<int>* o_lattice)
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "CreateRandomLattice");
+
 	if (Ready != true)
 	{
 		cout << "Critical Error: Object is not ready (TSimulationBase::CreateRandomLattice)" << endl << endl;
@@ -2015,48 +2524,36 @@ int TSimulationBase::CreateRandomLattice(vector<vector<vector<vector<int>>>>* o_
 		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 	}
 
-	// Undotiertes Gitter erstellen
-	vector<vector<vector<vector<int>>>> t_lattice(spLatticeSize, vector<vector<vector<int>>>(spLatticeSize,
-		vector<vector<int>>(spLatticeSize, vector<int>(spStackSize, -1))));
-	for (int x = 0; x < spLatticeSize; x++)
+	// Undotiertes Gitter erstellen (Elementarzelle in jede Zelle des flachen Gitters kopieren)
+	T4DLattice<int> t_lattice(spLatticeSize, spStackSize, -1);
+	size_t t_CellCount = size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spLatticeSize);
+	for (size_t i = 0; i < t_CellCount; i++)
 	{
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				for (int s = 0; s < spStackSize; s++)
-				{
-					t_lattice[x][y][z][s] = t_UCElemIDs[s];
-				}
-			}
-		}
+		std::copy(t_UCElemIDs.begin(), t_UCElemIDs.end(), t_lattice.GetData() + i * size_t(spStackSize));
 	}
 
-	// Fuer jede ElemID die Anzahl in der undotierten Elementarzelle bestimmen
-	vector<int> t_UCElemCount((*max_element(t_UCElemIDs.begin(), t_UCElemIDs.end())) + 1, 0);
+	// Fuer jede ElemID die Stapelpositionen in der undotierten Elementarzelle bestimmen
+	// (Positionsnummer p einer ElemID e im Gitter: Zelle = p / Anzahl, Stapelposition = t_UCElemStack[e][p % Anzahl])
+	vector<vector<int>> t_UCElemStack((*max_element(t_UCElemIDs.begin(), t_UCElemIDs.end())) + 1);
 	for (int i = 0; i < (int)t_UCElemIDs.size(); i++)
 	{
-		t_UCElemCount[t_UCElemIDs[i]] += 1;
+		t_UCElemStack[t_UCElemIDs[i]].push_back(i);
 	}
 
 	// Dotierungen hinzufuegen (falls vorhanden)
 	size_t t_TotalDopAnz;							// Gesamtanzahl an Dopanden fuer eine ElemID
 	size_t t_TotalPosAnz;							// Gesamtanzahl an Positionen fuer eine ElemID im undotierten Gitter
+	size_t t_ElemCount;								// Anzahl einer ElemID in der undotierten Elementarzelle
 	vector<size_t> t_SelectedPositions;				// zufaellige Positionsnummern im Gitter, in aufsteigender Reihenfolge
-	vector<size_t> t_SelDopPos;						// Positionsnummern fuer eine Dotierung
 	uniform_int_distribution<size_t> t_SelDist;		// Random-Distribution zur Auswahl der Positionen aus t_SelectedPositions
 	size_t t_SelPos;
-	size_t t_x;
-	size_t t_y;
-	size_t t_z;
-	size_t t_s;
-	bool t_found;
 	if (t_DopedIDs.size() != 0)
 	{
-		for (int i = 0; i < (int)t_UCElemCount.size(); i++)
+		for (int i = 0; i < (int)t_UCElemStack.size(); i++)
 		{
-			if (t_UCElemCount[i] == 0) continue;
-			t_TotalPosAnz = size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(t_UCElemCount[i]);
+			t_ElemCount = t_UCElemStack[i].size();
+			if (t_ElemCount == 0) continue;
+			t_TotalPosAnz = t_CellCount * t_ElemCount;
 
 			// Gesamtanzahl an Dopanden fuer die ElemID i berechnen
 			t_TotalDopAnz = 0;
@@ -2074,67 +2571,34 @@ int TSimulationBase::CreateRandomLattice(vector<vector<vector<vector<int>>>>* o_
 				return ErrorCode;
 			}
 
-			// Fuer jede Dotierung mit DopedID = i zufaellige Positionen aus t_SelectedPositions besetzen
+			// Fuer jede Dotierung mit DopedID = i zufaellige Positionen aus t_SelectedPositions waehlen und direkt besetzen
 			for (int j = 0; j < (int)t_DopedIDs.size(); j++)
 			{
 				if ((t_DopedIDs[j] == i) && (t_DopandAnz[j] != 0))
 				{
-
-					// Positionen zufaellig aus t_SelectedPositions waehlen
-					t_SelDopPos.clear();
 					for (size_t k = 0; k < (size_t)t_DopandAnz[j]; k++)
 					{
 						t_SelDist = uniform_int_distribution<size_t>(0, size_t(t_SelectedPositions.size()) - 1);
 						t_SelPos = t_SelDist(spRNG);
-						t_SelDopPos.push_back(t_SelectedPositions[t_SelPos]);
+						t_lattice[(t_SelectedPositions[t_SelPos] / t_ElemCount) * size_t(spStackSize) +
+							size_t(t_UCElemStack[i][t_SelectedPositions[t_SelPos] % t_ElemCount])] = t_DopandIDs[j];
 						t_SelectedPositions[t_SelPos] = t_SelectedPositions.back();
 						t_SelectedPositions.pop_back();
 					}
-
-					// Dopanden platzieren
-					for (size_t k = 0; k < (size_t)t_SelDopPos.size(); k++)
-					{
-
-						t_SelPos = t_SelDopPos[k] / size_t(t_UCElemCount[i]);		// Anzahl an ganzen Elementarzellen vor der Position
-						t_x = t_SelPos / (size_t(spLatticeSize) * size_t(spLatticeSize));
-						t_SelPos -= t_x * size_t(spLatticeSize) * size_t(spLatticeSize);
-						t_y = t_SelPos / size_t(spLatticeSize);
-						t_SelPos -= t_y * size_t(spLatticeSize);
-						t_z = t_SelPos;
-						t_SelPos = t_SelDopPos[k] - ((t_x * size_t(spLatticeSize) + t_y) * size_t(spLatticeSize) + t_z) * size_t(t_UCElemCount[i]);
-						t_s = 0;
-						t_found = false;
-						for (int l = 0; l < (int)t_UCElemIDs.size(); l++)
-						{
-							if (t_UCElemIDs[l] == i)
-							{
-								if (t_SelPos == 0)
-								{
-									t_s = size_t(l);
-									t_found = true;
-									break;
-								}
-								else
-								{
-									t_SelPos--;
-								}
-							}
-						}
-						if (t_found == false)
-						{
-							cout << "Critical Error: Invalid stack position (TSimulationBase::CreateRandomLattice)" << endl << endl;
-							return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
-						}
-						t_lattice[t_x][t_y][t_z][t_s] = t_DopandIDs[j];
-					}
 				}
 			}
 		}
 	}
 
 	// Leerstellen berechnen
+	t_ElemCount = t_UCElemStack[0].size();
+	if ((int)t_ElemCount != spMovStackSize)
+	{
+		cout << "Critical Error: Invalid vacancy stack position (TSimulationBase::CreateRandomLattice)" << endl << endl;
+		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
+	}
 	t_TotalDopAnz = size_t(spTotalVacAnz);
-	t_TotalPosAnz = size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spMovStackSize);
+	t_TotalPosAnz = t_CellCount * t_ElemCount;
 
 	// Positionen ermitteln
 	ErrorCode = UniqueSampling(t_TotalDopAnz, t_TotalPosAnz, &t_SelectedPositions);
@@ -2145,50 +2609,20 @@ int TSimulationBase::CreateRandomLattice(vector<vector<vector<vector<int>>>>* o_
 	}
 
 	// Leerstellen platzieren
-	for (size_t i = 0LL; i < (size_t)t_SelectedPositions.size(); i++)
+	for (size_t i = 0; i < (size_t)t_SelectedPositions.size(); i++)
 	{
-
-		t_SelPos = t_SelectedPositions[i] / size_t(spMovStackSize);
-		t_x = t_SelPos / (size_t(spLatticeSize) * size_t(spLatticeSize));
-		t_SelPos -= t_x * size_t(spLatticeSize) * size_t(spLatticeSize);
-		t_y = t_SelPos / size_t(spLatticeSize);
-		t_SelPos -= t_y * size_t(spLatticeSize);
-		t_z = t_SelPos;
-		t_SelPos = t_SelectedPositions[i] - ((t_x * size_t(spLatticeSize) + t_y) * size_t(spLatticeSize) + t_z) * size_t(spMovStackSize);
-		t_s = 0;
-		t_found = false;
-		for (int j = 0; j < (int)t_UCElemIDs.size(); j++)
-		{
-			if (t_UCElemIDs[j] == 0)
-			{
-				if (t_SelPos == 0)
-				{
-					t_s = size_t(j);
-					t_found = true;
-					break;
-				}
-				else
-				{
-					t_SelPos--;
-				}
-			}
-		}
-		if (t_found == false)
-		{
-			cout << "Critical Error: Invalid vacancy stack position (TSimulationBase::CreateRandomLattice)" << endl << endl;
-			return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
-		}
-		t_lattice[t_x][t_y][t_z][t_s] = 1;
+		t_lattice[(t_SelectedPositions[i] / t_ElemCount) * size_t(spStackSize) +
+			size_t(t_UCElemStack[0][t_SelectedPositions[i] % t_ElemCount])] = 1;
 	}
 
 	// Gitter uebertragen
-	*o_lattice = t_lattice;
+	o_lattice->Swap(t_lattice);
 
 	return KMCERR_OK;
 }
 
 // Leeres Gitter zur Bewegungsspeicherung erstellen
-int TSimulationBase::CreateMovLattice(vector<vector<vector<vector<T3DMovVector>>>>* o_movlattice) const
+int TSimulationBase::CreateMovLattice(T4DLattice<T3DMovVector>* o_movlattice) const
 {
 	if (Ready != true)
 	{
@@ -2197,17 +2631,13 @@ int TSimulationBase::CreateMovLattice(vector<vector<vector<vector<T3DMovVector>>
 	}
 
 	// Leeres Gitter erstellen
-	vector<vector<vector<vector<T3DMovVector>>>> t_movlattice(spLatticeSize, vector<vector<vector<T3DMovVector>>>(spLatticeSize,
-		vector<vector<T3DMovVector>>(spLatticeSize, vector<T3DMovVector>(spMovStackSize, T3DMovVector()))));
-
-	// Gitter zuweisen
-	*o_movlattice = t_movlattice;
+	o_movlattice->Assign(spLatticeSize, spMovStackSize, T3DMovVector());
 
 	return KMCERR_OK;
 }
 
 // Gitterstatistik ausgeben
-int TSimulationBase::LatticeAnalysis(string i_space, const vector<vector<vector<vector<int>>>>* i_lattice) const
+int TSimulationBase::LatticeAnalysis(string i_space, const T4DLattice<int>* i_lattice) const
 {
 	if (Ready != true)
 	{
@@ -2226,41 +2656,35 @@ int TSimulationBase::LatticeAnalysis(string i_space, const vector<vector<vector<
 		return ErrorCode;
 	}
 
-	// Elemente auszaehlen
-	vector<long long> t_AtomCount(t_ElemCount, 0LL);
-	if (i_lattice->size() != 0)
+	// Elemente auszaehlen (parallel je x-Ebene, Teilzaehler anschliessend in fester Reihenfolge zusammenfassen)
+	int t_PlaneCount = i_lattice->GetLatticeSize();
+	size_t t_PlaneSites = (t_PlaneCount > 0) ? i_lattice->GetCount() / (size_t)t_PlaneCount : 0;
+	vector<vector<long long>> t_PlaneAtomCount(t_PlaneCount, vector<long long>(t_ElemCount, 0LL));
+	const int* t_sites = i_lattice->GetData();
+	ErrorCode = TParallel::For(t_PlaneCount, [&](int x) -> int
 	{
-		for (int x = 0; x < (int)i_lattice->size(); x++)
+		const int* t_plane_sites = t_sites + (size_t)x * t_PlaneSites;
+		vector<long long>& t_count = t_PlaneAtomCount[x];
+		for (size_t i = 0; i < t_PlaneSites; i++)
 		{
-			if (i_lattice->at(x).size() != 0)
-			{
-				for (int y = 0; y < (int)i_lattice->at(x).size(); y++)
-				{
-					if (i_lattice->at(x)[y].size() != 0)
-					{
-						for (int z = 0; z < (int)i_lattice->at(x)[y].size(); z++)
-						{
-							if (i_lattice->at(x)[y][z].size() != 0)
-							{
-								for (int s = 0; s < (int)i_lattice->at(x)[y][z].size(); s++)
-								{
 
-									// Auf gueltige ElemID pruefen
-									if ((i_lattice->at(x)[y][z][s] < 0) || (i_lattice->at(x)[y][z][s] >= t_ElemCount))
-									{
-										cout << "Critical Error: Invalid ElemID in the lattice (TSimulationBase::LatticeAnalysis)" << endl << endl;
-										return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
-									}
+			// Auf gueltige ElemID pruefen
+			if ((t_plane_sites[i] < 0) || (t_plane_sites[i] >= t_ElemCount)) return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 
-									// Zaehler erhoehen
-									t_AtomCount[i_lattice->at(x)[y][z][s]] += 1LL;
-								}
-							}
-						}
-					}
-				}
-			}
+			// Zaehler erhoehen
+			t_count[t_plane_sites[i]] += 1LL;
 		}
+		return KMCERR_OK;
+	});
+	if (ErrorCode != KMCERR_OK)
+	{
+		cout << "Critical Error: Invalid ElemID in the lattice (TSimulationBase::LatticeAnalysis)" << endl << endl;
+		return ErrorCode;
+	}
+	vector<long long> t_AtomCount(t_ElemCount, 0LL);
+	for (int x = 0; x < t_PlaneCount; x++)
+	{
+		for (int i = 0; i < t_ElemCount; i++) t_AtomCount[i] += t_PlaneAtomCount[x][i];
 	}
 
 	// Anzahlen ausgeben
@@ -2290,7 +2714,7 @@ int TSimulationBase::LatticeAnalysis(string i_space, const vector<vector<vector<
 }
 
 // Statistik aller aktuellen Sprungwahrscheinlichkeiten ausgeben (ohne Normierung)
-int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const vector<vector<vector<vector<int>>>>* i_lattice) const
+int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const T4DLattice<int>* i_lattice) const
 {
 	if (Ready != true)
 	{
@@ -2302,17 +2726,23 @@ int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const vector<v
 	// because the jump environments typically change because they also contain moving species positions
 	// -> Therefore, this analysis just reflects the momentary state of the lattice (and it cannot be used for normalization)
 
-	// Initialize analysis results (see further below for their meaning)
-	unsigned long long blocked_jumps = 0;
-	unsigned long long normal_jumps = 0;
-	unsigned long long nonsense_jumps = 0;
-	unsigned long long overkill_jumps = 0;
-	double lowest_prob = 1.0;
-	double highest_prob = 0.0;
+	// Analysis results of one x-plane (see further below for their meaning)
+	struct TProbStats
+	{
+		unsigned long long blocked_jumps = 0;
+		unsigned long long normal_jumps = 0;
+		unsigned long long nonsense_jumps = 0;
+		unsigned long long overkill_jumps = 0;
+		double lowest_prob = 1.0;
+		double highest_prob = 0.0;
+	};
+	vector<TProbStats> plane_stats(spLatticeSize);
 
 	// Unit cell positions (index s) are sorted by ElemID -> Iterate over all 4D positions of the moving species
-	for (int x_ini = 0; x_ini < spLatticeSize; ++x_ini)
+	// (parallel over the x-planes, the lattice and the jump data are only read)
+	TParallel::For(spLatticeSize, [&](int x_ini) -> int
 	{
+		TProbStats& t_stats = plane_stats[x_ini];
 		for (int y_ini = 0; y_ini < spLatticeSize; ++y_ini)
 		{
 			for (int z_ini = 0; z_ini < spLatticeSize; ++z_ini)
@@ -2320,7 +2750,7 @@ int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const vector<v
 				for (int s_ini = 0; s_ini < spMovStackSize; ++s_ini)
 				{
 					// Skip if no vacancy at jump start position
-					if (i_lattice->at(x_ini)[y_ini][z_ini][s_ini] != 1) continue;
+					if ((*i_lattice)(x_ini, y_ini, z_ini, s_ini) != 1) continue;
 
 					// Iterate over all possible directions dir
 					for (int dir = 0; dir < spDirCount[spDirLink[s_ini]]; ++dir)
@@ -2343,9 +2773,9 @@ int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const vector<v
 						while (s_end >= spStackSize) s_end -= spStackSize;
 
 						// Skip if vacancy at jump end position
-						if (i_lattice->at(x_end)[y_end][z_end][s_end] == 1)
+						if ((*i_lattice)(x_end, y_end, z_end, s_end) == 1)
 						{
-							blocked_jumps++;
+							t_stats.blocked_jumps++;
 							continue;
 						}
 
@@ -2373,7 +2803,7 @@ int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const vector<v
 							while (s_env < 0) s_env += spStackSize;
 							while (s_env >= spStackSize) s_env -= spStackSize;
 							hash_idx += analyzed_unique_jump->hash_mult[i_env] *
-								analyzed_unique_jump->hash_map[i_env][i_lattice->at(x_env)[y_env][z_env][s_env]];
+								analyzed_unique_jump->hash_map[i_env][(*i_lattice)(x_env, y_env, z_env, s_env)];
 						}
 
 						// Add contribution from non-additive environment
@@ -2399,7 +2829,7 @@ int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const vector<v
 							while (s_env < 0) s_env += spStackSize;
 							while (s_env >= spStackSize) s_env -= spStackSize;
 
-							jump_prob *= analyzed_unique_jump->add_energies[i_env][i_lattice->at(x_env)[y_env][z_env][s_env]];
+							jump_prob *= analyzed_unique_jump->add_energies[i_env][(*i_lattice)(x_env, y_env, z_env, s_env)];
 						}
 
 						// Pointer to the respective reverse jump object
@@ -2429,7 +2859,7 @@ int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const vector<v
 							while (s_env < 0) s_env += spStackSize;
 							while (s_env >= spStackSize) s_env -= spStackSize;
 							hash_idx += analyzed_unique_backjump->hash_mult[i_env] *
-								analyzed_unique_backjump->hash_map[i_env][i_lattice->at(x_env)[y_env][z_env][s_env]];
+								analyzed_unique_backjump->hash_map[i_env][(*i_lattice)(x_env, y_env, z_env, s_env)];
 						}
 
 						// Add contribution from non-additive environment
@@ -2455,7 +2885,7 @@ int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const vector<v
 							while (s_env < 0) s_env += spStackSize;
 							while (s_env >= spStackSize) s_env -= spStackSize;
 
-							backjump_prob *= analyzed_unique_backjump->add_energies[i_env][i_lattice->at(x_env)[y_env][z_env][s_env]];
+							backjump_prob *= analyzed_unique_backjump->add_energies[i_env][(*i_lattice)(x_env, y_env, z_env, s_env)];
 						}
 
 						// Analyze jump category
@@ -2476,31 +2906,49 @@ int TSimulationBase::LatticeProbabilitiesAnalysis(string i_space, const vector<v
 							if (backjump_prob < 1.0)
 							{
 								// -> Category 1
-								normal_jumps++;
+								t_stats.normal_jumps++;
 							}
 							else
 							{
 								// -> Category 2
-								nonsense_jumps++;
+								t_stats.nonsense_jumps++;
 							}
 						}
 						else
 						{
 							// -> Category 3
-							overkill_jumps++;
+							t_stats.overkill_jumps++;
 						}
 
 						// Analyze jump probability 
 						// (only category 1 = normal jumps that can be a Monte-Carlo step)
 						if ((jump_prob < 1.0) && (backjump_prob < 1.0))
 						{
-							if (jump_prob < lowest_prob) lowest_prob = jump_prob;
-							if (jump_prob > highest_prob) highest_prob = jump_prob;
+							if (jump_prob < t_stats.lowest_prob) t_stats.lowest_prob = jump_prob;
+							if (jump_prob > t_stats.highest_prob) t_stats.highest_prob = jump_prob;
 						}
 					}
 				}
 			}
 		}
+		return KMCERR_OK;
+	});
+
+	// Merge the results of all x-planes
+	unsigned long long blocked_jumps = 0;
+	unsigned long long normal_jumps = 0;
+	unsigned long long nonsense_jumps = 0;
+	unsigned long long overkill_jumps = 0;
+	double lowest_prob = 1.0;
+	double highest_prob = 0.0;
+	for (int x_ini = 0; x_ini < spLatticeSize; ++x_ini)
+	{
+		blocked_jumps += plane_stats[x_ini].blocked_jumps;
+		normal_jumps += plane_stats[x_ini].normal_jumps;
+		nonsense_jumps += plane_stats[x_ini].nonsense_jumps;
+		overkill_jumps += plane_stats[x_ini].overkill_jumps;
+		if (plane_stats[x_ini].lowest_prob < lowest_prob) lowest_prob = plane_stats[x_ini].lowest_prob;
+		if (plane_stats[x_ini].highest_prob > highest_prob) highest_prob = plane_stats[x_ini].highest_prob;
 	}
 
 	// Print statistics
@@ -2583,6 +3031,22 @@ int TSimulationBase::PhaseAnalysis(string i_space, bool is_short, const TSimPhas
 			cout << i_space << "Conductivity: " << t_conductivity << " S/cm" << endl;
 		}
 
+		// Konvergenzstatistik ausgeben (Blockmittelung, nur falls Konvergenzpruefung aktiv)
+		double t_cond_relerr = -1.0;
+		double t_msd_relerr = -1.0;
+		if (i_phase.CurrentConvergence.GetRelErrors(t_cond_relerr, t_msd_relerr) == true)
+		{
+			cout << i_space << "Relative standard error (" << i_phase.CurrentConvergence.BlockTime.size() << " blocks of ";
+			cout << i_phase.CurrentConvergence.BlockMCSP << " MCSP):";
+			if ((spCanCalcCond == true) && (t_cond_relerr >= 0.0)) cout << " conductivity " << t_cond_relerr << ",";
+			cout << " MSD rate " << t_msd_relerr << endl;
+		}
+		else if (i_phase.CurrentConvergence.IsEmpty() == false)
+		{
+			cout << i_space << "Relative standard error: not yet available (" << i_phase.CurrentConvergence.BlockTime.size() << " of ";
+			cout << KMCVAR_CONV_MINBLOCKS << " blocks)" << endl;
+		}
+
 		// Analysedaten ausgeben
 		// Zusaetzlich:
 		// sqrt(<x>*<x> + <y>*<y> + <z>*<z>) = Laenge des mittleren Verschiebungsvektors
@@ -2730,28 +3194,38 @@ int TSimulationBase::UniqueSampling(size_t id_count, size_t pos_count, vector<si
 
 	if ((id_count < 1) || (pos_count < 1) || (id_count > pos_count)) return KMCERR_INVALID_INPUT_CRIT;
 
-	// Der folgende Algorithmus ist dem Buch "The Art of Computer Programming Vol.2 - Seminumerical Algorithms" 
-	// von Donald E. Knuth (3. Ausgabe, 1997) entnommen. Er ist in Kapitel 3.4.2 (Seite 142) als "Algorithmus S" beschrieben.
-	// Im Anhang dieses Buchs erfolgt auch der Beweis durch Induktion, dass bei dieser Methode fuer jede Position
-	// die gleiche Wahrscheinlichkeit (id_count/(max_id+1)) besteht, ausgewaehlt zu werden.
+	// Der folgende Algorithmus ist Robert W. Floyds Stichprobenverfahren (J. Bentley, R. Floyd: "Programming Pearls -
+	// A Sample of Brilliance", Communications of the ACM 30(9), 1987). Fuer posnr = pos_count - id_count, ..., pos_count - 1
+	// wird eine Zahl t aus [0, posnr] gewuerfelt und t ausgewaehlt, falls noch nicht ausgewaehlt, sonst posnr.
+	// Jede id_count-elementige Teilmenge ist gleich wahrscheinlich, es werden nur id_count Zufallszahlen benoetigt
+	// (Knuths "Algorithmus S" benoetigt dagegen eine Zufallszahl je Position in [0, pos_count-1]).
 
-	size_t restpos;					// Anzahl uebriger Positionsnummern
-	size_t resttodraw;				// Anzahl noch zu wuerfelnder Positionen
+	vector<bool> taken(pos_count, false);		// Markierung der bereits ausgewaehlten Positionen
+	uniform_int_distribution<size_t> posdist;
+	size_t drawn;
 	o_selected->clear();
-	for (size_t posnr = 0; (posnr < pos_count) && (size_t(o_selected->size()) < id_count); ++posnr)
+	o_selected->reserve(id_count);
+	for (size_t posnr = pos_count - id_count; posnr < pos_count; ++posnr)
 	{
-		restpos = pos_count - posnr;
-		resttodraw = id_count - size_t(o_selected->size());
-		if (spProbDist(spRNG) < double(resttodraw) / double(restpos)) o_selected->push_back(posnr);		// Position mit Wahrscheinlichkeit resttodraw/restpos auswaehlen
+		posdist = uniform_int_distribution<size_t>(0, posnr);
+		drawn = posdist(spRNG);
+		if (taken[drawn] == true) drawn = posnr;
+		taken[drawn] = true;
+		o_selected->push_back(drawn);
 	}
 	if ((size_t)o_selected->size() != id_count) return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 
+	// Aufsteigend sortieren
+	sort(o_selected->begin(), o_selected->end());
+
 	return KMCERR_OK;
 }
 
-// Synchronisation: i_phase -> variable Simulationsparameter
-int TSimulationBase::SetSimulationData(const TSimPhaseInfo& i_phase)
+// Synchronisation: i_phase -> variable Simulationsparameter (Gitter von i_phase werden direkt simuliert)
+int TSimulationBase::SetSimulationData(TSimPhaseInfo& i_phase)
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "SetSimulationData");
+
 	if (Ready != true)
 	{
 		cout << "Critical Error: Object is not ready (TSimulationBase::SetSimulationData)" << endl << endl;
@@ -2770,53 +3244,22 @@ int TSimulationBase::SetSimulationData(const TSimPhaseInfo& i_phase)
 	spOverkillAttempts = i_phase.CurrentOverkillJumpAttempts;
 	spSiteBlockingCounter = i_phase.CurrentSiteBlockingCounter;
 
-	size_t t_size = 0;
-
-	// Linearisiertes Gitter erstellen
-	t_size = size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spStackSize);
-	delete[] spLattice;
-	spLattice = new (nothrow) int[t_size];
-	if (spLattice == NULL)
+	// Gitterdimensionen pruefen
+	if (i_phase.CurrentLattice.HasShape(spLatticeSize, spStackSize) == false)
 	{
-		cout << "Critical Error: Cannot create lattice array (TSimulationBase::SetSimulationData)" << endl << endl;
-		return KMCERR_MAXIMUM_INPUT_REACHED;
+		cout << "Critical Error: Invalid lattice size (TSimulationBase::SetSimulationData)" << endl << endl;
+		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 	}
-	for (int x = 0; x < spLatticeSize; x++)
+	if (i_phase.CurrentMovLattice.HasShape(spLatticeSize, spMovStackSize) == false)
 	{
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				for (int s = 0; s < spStackSize; s++)
-				{
-					spLattice[(((size_t)x * spLatticeSize + y) * spLatticeSize + z) * spStackSize + s] = i_phase.CurrentLattice[x][y][z][s];
-				}
-			}
-		}
+		cout << "Critical Error: Invalid mov lattice size (TSimulationBase::SetSimulationData)" << endl << endl;
+		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 	}
 
-	// Linearisiertes Gitter zur Bewegungsspeicherung erstellen
-	t_size = size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spMovStackSize);
-	delete[] spMovLattice;
-	spMovLattice = new (nothrow) T3DMovVector[t_size];
-	if (spMovLattice == NULL)
-	{
-		cout << "Critical Error: Cannot create movement detection array (TSimulationBase::SetSimulationData)" << endl << endl;
-		return KMCERR_MAXIMUM_INPUT_REACHED;
-	}
-	for (int x = 0; x < spLatticeSize; x++)
-	{
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				for (int s = 0; s < spMovStackSize; s++)
-				{
-					spMovLattice[(((size_t)x * spLatticeSize + y) * spLatticeSize + z) * spMovStackSize + s] = i_phase.CurrentMovLattice[x][y][z][s];
-				}
-			}
-		}
-	}
+	// Gitter der Phase direkt verwenden (gleiche Speicherreihenfolge wie T4DLattice, keine Arbeitskopie)
+	// -> i_phase muss bis zum Ende der Simulation bestehen bleiben und darf nicht umdimensioniert werden
+	spLattice = i_phase.CurrentLattice.GetData();
+	spMovLattice = i_phase.CurrentMovLattice.GetData();
 
 	// Liste der Leerstellenpositionen erstellen
 	delete[] spVacListSizes;
@@ -2835,7 +3278,7 @@ int TSimulationBase::SetSimulationData(const TSimPhaseInfo& i_phase)
 	{
 		for (int i = spDirSelCount - 1; i >= 0; i--)
 		{
-			delete[] spVacLists[i];
+			TSimAlloc::Delete(spVacLists[i]);
 		}
 		delete[] spVacLists;
 	}
@@ -2860,7 +3303,7 @@ int TSimulationBase::SetSimulationData(const TSimPhaseInfo& i_phase)
 			{
 				for (int j = i - 1; j >= 0; j--)
 				{
-					delete[] spVacLists[j];
+					TSimAlloc::Delete(spVacLists[j]);
 				}
 			}
 			delete[] spVacLists;
@@ -2869,13 +3312,13 @@ int TSimulationBase::SetSimulationData(const TSimPhaseInfo& i_phase)
 		size_t t_maxvac = size_t(t_atomcount[i]) * size_t(spLatticeSize) * size_t(spLatticeSize) * size_t(spLatticeSize);
 		if (t_maxvac > spTotalVacAnz) t_maxvac = size_t(spTotalVacAnz);
 
-		spVacLists[i] = new (nothrow) T4DLatticeVector[t_maxvac];
+		spVacLists[i] = TSimAlloc::New<T4DLatticeVector>(t_maxvac);
 		if (spVacLists[i] == NULL)
 		{
 			cout << "Critical Error: Cannot create vacancy position sub-array (TSimulationBase::SetSimulationData)" << endl << endl;
 			for (int j = i; j >= 0; j--)
 			{
-				delete[] spVacLists[j];
+				TSimAlloc::Delete(spVacLists[j]);
 			}
 			delete[] spVacLists;
 			return KMCERR_MAXIMUM_INPUT_REACHED;
@@ -2974,74 +3417,26 @@ int TSimulationBase::GetSimulationData(TSimPhaseInfo& o_phase) const
 	o_phase.CurrentSiteBlockingCounter = spSiteBlockingCounter;
 	o_phase.CurrentRunTime = spRunTime;
 
-	// Gitter uebertragen
-	if ((int)o_phase.CurrentLattice.size() != spLatticeSize)
+	// Gitter uebertragen (entfaellt, wenn spLattice bereits auf das Gitter von o_phase zeigt)
+	if (o_phase.CurrentLattice.HasShape(spLatticeSize, spStackSize) == false)
 	{
-		cout << "Critical Error: Invalid 1st dimension lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
+		cout << "Critical Error: Invalid lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
 		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 	}
-	for (int x = 0; x < spLatticeSize; x++)
+	if (spLattice != o_phase.CurrentLattice.GetData())
 	{
-		if ((int)o_phase.CurrentLattice[x].size() != spLatticeSize)
-		{
-			cout << "Critical Error: Invalid 2nd dimension lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
-			return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
-		}
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			if ((int)o_phase.CurrentLattice[x][y].size() != spLatticeSize)
-			{
-				cout << "Critical Error: Invalid 3rd dimension lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
-				return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
-			}
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				if ((int)o_phase.CurrentLattice[x][y][z].size() != spStackSize)
-				{
-					cout << "Critical Error: Invalid 4th dimension lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
-					return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
-				}
-				for (int s = 0; s < spStackSize; s++)
-				{
-					o_phase.CurrentLattice[x][y][z][s] = spLattice[(((size_t)x * spLatticeSize + y) * spLatticeSize + z) * spStackSize + s];
-				}
-			}
-		}
+		std::copy_n(spLattice, o_phase.CurrentLattice.GetCount(), o_phase.CurrentLattice.GetData());
 	}
 
-	// Gitter zur Bewegungsspeicherung uebertragen
-	if ((int)o_phase.CurrentMovLattice.size() != spLatticeSize)
+	// Gitter zur Bewegungsspeicherung uebertragen (entfaellt, wenn spMovLattice bereits auf das Gitter von o_phase zeigt)
+	if (o_phase.CurrentMovLattice.HasShape(spLatticeSize, spMovStackSize) == false)
 	{
-		cout << "Critical Error: Invalid 1st dimension mov lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
+		cout << "Critical Error: Invalid mov lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
 		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 	}
-	for (int x = 0; x < spLatticeSize; x++)
+	if (spMovLattice != o_phase.CurrentMovLattice.GetData())
 	{
-		if ((int)o_phase.CurrentMovLattice[x].size() != spLatticeSize)
-		{
-			cout << "Critical Error: Invalid 2nd dimension mov lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
-			return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
-		}
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			if ((int)o_phase.CurrentMovLattice[x][y].size() != spLatticeSize)
-			{
-				cout << "Critical Error: Invalid 3rd dimension mov lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
-				return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
-			}
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				if ((int)o_phase.CurrentMovLattice[x][y][z].size() != spMovStackSize)
-				{
-					cout << "Critical Error: Invalid 4th dimension mov lattice size (TSimulationBase::GetSimulationData)" << endl << endl;
-					return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
-				}
-				for (int s = 0; s < spMovStackSize; s++)
-				{
-					o_phase.CurrentMovLattice[x][y][z][s] = spMovLattice[(((size_t)x * spLatticeSize + y) * spLatticeSize + z) * spMovStackSize + s];
-				}
-			}
-		}
+		std::copy_n(spMovLattice, o_phase.CurrentMovLattice.GetCount(), o_phase.CurrentMovLattice.GetData());
 	}
 
 	// Wahrscheinlichkeitslisten uebertragen
@@ -3097,25 +3492,16 @@ int TSimulationBase::ValidatePrerunData(TSimPhaseInfo& i_phase)
 	i_phase.CurrentRunTime.CheckOverflow();
 	if (i_phase.CurrentRunTime.year < 0) return KMCERR_INVALID_INPUT;
 
-	// Gitter pruefen
-	ErrorCode = ValidateLattice(&(i_phase.CurrentLattice));
-	if (ErrorCode != KMCERR_OK) return ErrorCode;
-
-	// Bewegungsgitter pruefen
-	if ((int)i_phase.CurrentMovLattice.size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-	for (int x = 0; x < spLatticeSize; x++)
+	// Gitter pruefen (leer, wenn das Gitter an die naechste Phase abgegeben wurde, siehe LoadCheckPoint)
+	if (i_phase.CurrentLattice.IsEmpty() == false)
 	{
-		if ((int)i_phase.CurrentMovLattice[x].size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			if ((int)i_phase.CurrentMovLattice[x][y].size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				if ((int)i_phase.CurrentMovLattice[x][y][z].size() != spMovStackSize) return KMCERR_INVALID_INPUT;
-			}
-		}
+		ErrorCode = ValidateLattice(&(i_phase.CurrentLattice));
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
 	}
 
+	// Bewegungsgitter pruefen
+	if (i_phase.CurrentMovLattice.HasShape(spLatticeSize, spMovStackSize) == false) return KMCERR_INVALID_INPUT;
+
 	// Wahrscheinlichkeitslisten pruefen
 	ErrorCode = ValidateProbLists(i_phase, PrerunRecordAnz);
 	if (ErrorCode != KMCERR_OK) return ErrorCode;
@@ -3154,25 +3540,16 @@ int TSimulationBase::ValidateDynNormData(TSimPhaseInfo& i_phase)
 	i_phase.CurrentRunTime.CheckOverflow();
 	if (i_phase.CurrentRunTime.year < 0) return KMCERR_INVALID_INPUT;
 
-	// Gitter pruefen
-	ErrorCode = ValidateLattice(&(i_phase.CurrentLattice));
-	if (ErrorCode != KMCERR_OK) return ErrorCode;
-
-	// Bewegungsgitter pruefen
-	if ((int)i_phase.CurrentMovLattice.size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-	for (int x = 0; x < spLatticeSize; x++)
+	// Gitter pruefen (leer, wenn das Gitter an die naechste Phase abgegeben wurde, siehe LoadCheckPoint)
+	if (i_phase.CurrentLattice.IsEmpty() == false)
 	{
-		if ((int)i_phase.CurrentMovLattice[x].size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			if ((int)i_phase.CurrentMovLattice[x][y].size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				if ((int)i_phase.CurrentMovLattice[x][y][z].size() != spMovStackSize) return KMCERR_INVALID_INPUT;
-			}
-		}
+		ErrorCode = ValidateLattice(&(i_phase.CurrentLattice));
+		if (ErrorCode != KMCERR_OK) return ErrorCode;
 	}
 
+	// Bewegungsgitter pruefen
+	if (i_phase.CurrentMovLattice.HasShape(spLatticeSize, spMovStackSize) == false) return KMCERR_INVALID_INPUT;
+
 	// Wahrscheinlichkeitslisten pruefen
 	ErrorCode = ValidateProbLists(i_phase, DynNormRecordAnz);
 	if (ErrorCode != KMCERR_OK) return ErrorCode;
@@ -3214,19 +3591,7 @@ int TSimulationBase::ValidateMainData(TSimPhaseInfo& i_phase)
 	if (ErrorCode != KMCERR_OK) return ErrorCode;
 
 	// Bewegungsgitter pruefen
-	if ((int)i_phase.CurrentMovLattice.size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-	for (int x = 0; x < spLatticeSize; x++)
-	{
-		if ((int)i_phase.CurrentMovLattice[x].size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			if ((int)i_phase.CurrentMovLattice[x][y].size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				if ((int)i_phase.CurrentMovLattice[x][y][z].size() != spMovStackSize) return KMCERR_INVALID_INPUT;
-			}
-		}
-	}
+	if (i_phase.CurrentMovLattice.HasShape(spLatticeSize, spMovStackSize) == false) return KMCERR_INVALID_INPUT;
 
 	// Wahrscheinlichkeitslisten pruefen
 	ErrorCode = ValidateProbLists(i_phase, MainRecordAnz);
@@ -3237,7 +3602,7 @@ int TSimulationBase::ValidateMainData(TSimPhaseInfo& i_phase)
 }
 
 // Gitter validieren
-int TSimulationBase::ValidateLattice(vector<vector<vector<vector<int>>>>* i_lattice)
+int TSimulationBase::ValidateLattice(T4DLattice<int>* i_lattice)
 {
 	if (Ready != true)
 	{
@@ -3253,19 +3618,7 @@ int TSimulationBase::ValidateLattice(vector<vector<vector<vector<int>>>>* i_latt
 	int ErrorCode = KMCERR_OK;
 
 	// Gittergroesse validieren
-	if ((int)i_lattice->size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-	for (int x = 0; x < spLatticeSize; x++)
-	{
-		if ((int)i_lattice->at(x).size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			if ((int)i_lattice->at(x)[y].size() != spLatticeSize) return KMCERR_INVALID_INPUT;
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				if ((int)i_lattice->at(x)[y][z].size() != spStackSize) return KMCERR_INVALID_INPUT;
-			}
-		}
-	}
+	if (i_lattice->HasShape(spLatticeSize, spStackSize) == false) return KMCERR_INVALID_INPUT;
 
 	// ElemIDs in der undotierten Elementarzelle ermitteln
 	vector<int> t_UCElemID;
@@ -3298,55 +3651,67 @@ int TSimulationBase::ValidateLattice(vector<vector<vector<vector<int>>>>* i_latt
 		return KMCERR_INVALID_INPUT_CRIT;
 	}
 
-	// Zaehler aufsetzen
-	unsigned long long i_VacAnz = 0LL;
-	vector<long long> i_DopandAnz;
-	if (t_DopedID.size() != 0) i_DopandAnz = vector<long long>(t_DopedID.size(), 0LL);
-
-	// Gitter pruefen
-	for (int x = 0; x < spLatticeSize; x++)
+	// Gitter pruefen (parallel je x-Ebene mit eigenen Zaehlern, je Elementarzelle spStackSize Gitterplaetze)
+	int t_PlaneCount = i_lattice->GetLatticeSize();
+	size_t t_PlaneSites = i_lattice->GetCount() / (size_t)t_PlaneCount;
+	vector<unsigned long long> t_PlaneVacAnz(t_PlaneCount, 0ULL);
+	vector<vector<long long>> t_PlaneDopandAnz(t_PlaneCount, vector<long long>(t_DopedID.size(), 0LL));
+	const int* t_sites = i_lattice->GetData();
+	ErrorCode = TParallel::For(t_PlaneCount, [&](int x) -> int
 	{
-		for (int y = 0; y < spLatticeSize; y++)
+		const int* t_plane_sites = t_sites + (size_t)x * t_PlaneSites;
+		unsigned long long& t_VacAnz = t_PlaneVacAnz[x];
+		vector<long long>& t_DopandAnz = t_PlaneDopandAnz[x];
+		for (size_t i_cell = 0; i_cell < t_PlaneSites; i_cell += (size_t)spStackSize)
 		{
-			for (int z = 0; z < spLatticeSize; z++)
+			for (int s = 0; s < spStackSize; s++)
 			{
-				for (int s = 0; s < spStackSize; s++)
-				{
+				int t_site = t_plane_sites[i_cell + s];
 
-					// Auf Standardbesetzung pruefen
-					if (i_lattice->at(x)[y][z][s] == t_UCElemID[s])
-					{
-						if (i_lattice->at(x)[y][z][s] == 1) i_VacAnz++;
-						continue;
-					}
+				// Auf Standardbesetzung pruefen
+				if (t_site == t_UCElemID[s])
+				{
+					if (t_site == 1) t_VacAnz++;
+					continue;
+				}
 
-					// Auf Leerstelle pruefen
-					if ((i_lattice->at(x)[y][z][s] == 1) && ((t_UCElemID[s] == 0) || (t_UCElemID[s] == 1)))
-					{
-						i_VacAnz++;
-						continue;
-					}
+				// Auf Leerstelle pruefen
+				if ((t_site == 1) && ((t_UCElemID[s] == 0) || (t_UCElemID[s] == 1)))
+				{
+					t_VacAnz++;
+					continue;
+				}
 
-					// Auf Dotierung pruefen
-					if (t_DopedID.size() != 0)
+				// Auf Dotierung pruefen
+				if (t_DopedID.size() != 0)
+				{
+					bool t_dopand_found = false;
+					for (int i = 0; i < (int)t_DopedID.size(); i++)
 					{
-						bool t_dopand_found = false;
-						for (int i = 0; i < (int)t_DopedID.size(); i++)
+						if ((t_DopedID[i] == t_UCElemID[s]) && (t_site == t_DopandID[i]))
 						{
-							if ((t_DopedID[i] == t_UCElemID[s]) && (i_lattice->at(x)[y][z][s] == t_DopandID[i]))
-							{
-								(i_DopandAnz[i])++;
-								t_dopand_found = true;
-								break;
-							}
+							(t_DopandAnz[i])++;
+							t_dopand_found = true;
+							break;
 						}
-						if (t_dopand_found == true) continue;
 					}
-
-					return KMCERR_INVALID_INPUT;
+					if (t_dopand_found == true) continue;
 				}
+
+				return KMCERR_INVALID_INPUT;
 			}
 		}
+		return KMCERR_OK;
+	});
+	if (ErrorCode != KMCERR_OK) return ErrorCode;
+
+	// Zaehler der x-Ebenen zusammenfassen
+	unsigned long long i_VacAnz = 0LL;
+	vector<long long> i_DopandAnz(t_DopedID.size(), 0LL);
+	for (int x = 0; x < t_PlaneCount; x++)
+	{
+		i_VacAnz += t_PlaneVacAnz[x];
+		for (int i = 0; i < (int)i_DopandAnz.size(); i++) i_DopandAnz[i] += t_PlaneDopandAnz[x][i];
 	}
 
 	// Anzahlen vergleichen
@@ -3460,119 +3825,196 @@ void TSimulationBase::SaveCheckPoint(string i_space, string i_chkpath)
 	// Pruefen, ob Checkpoint geschrieben werden soll
 	if (m_Job->m_Settings->IfWriteCheckpoint() == false) return;
 	if (Trim(i_chkpath) == "") return;
+	TProfileScope ProfileScope(&m_Job->m_Profile, "SaveCheckPoint");
 
 	// Offset des untergeordneten Outputs definieren
 	string sub_offset = "";
 	if ((int)KMCOUT_TSIMULATION_CHK_OFFSET > 0) sub_offset = string((int)KMCOUT_TSIMULATION_CHK_OFFSET, ' ');
 
-	// Startgitter speichern
-	bool t_has_startlattice = false;
-	stringstream t_startlattice;
-	t_startlattice.precision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
-	if (StartLattice.size() != 0)
-	{
-		t_startlattice << sub_offset << KMCOUT_TSIMULATION_STARTLATTICE_START << endl;
-		for (int x = 0; x < (int)StartLattice.size(); x++)
-		{
-			for (int y = 0; y < (int)StartLattice[x].size(); y++)
-			{
-				for (int z = 0; z < (int)StartLattice[x][y].size(); z++)
-				{
-					t_startlattice << sub_offset;
-					for (int s = 0; s < (int)StartLattice[x][y][z].size(); s++)
-					{
-						t_startlattice << StartLattice[x][y][z][s] << " ";
-					}
-					t_startlattice << endl;
-				}
-			}
-		}
-		t_startlattice << sub_offset << KMCOUT_TSIMULATION_STARTLATTICE_END << endl;
-		t_has_startlattice = true;
-	}
-
-	// Prerun-Phase speichern
-	bool t_has_prerun = true;
-	stringstream t_prerun_stream;
-	t_prerun_stream.precision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
-	ErrorCode = PrerunPhaseData.SaveToStream(t_prerun_stream, KMCOUT_TSIMULATION_CHK_OFFSET, KMCOUT_TSIMULATION_PRERUN_START, KMCOUT_TSIMULATION_PRERUN_END);
-	if (ErrorCode != KMCERR_OK) t_has_prerun = false;
-
-	// DynNorm-Phase speichern
-	bool t_has_dynnorm = true;
-	stringstream t_dynnorm_stream;
-	t_dynnorm_stream.precision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
-	ErrorCode = DynNormPhaseData.SaveToStream(t_dynnorm_stream, KMCOUT_TSIMULATION_CHK_OFFSET, KMCOUT_TSIMULATION_DYNNORM_START, KMCOUT_TSIMULATION_DYNNORM_END);
-	if (ErrorCode != KMCERR_OK) t_has_dynnorm = false;
-
-	// Main-Phase speichern
-	bool t_has_main = true;
-	stringstream t_main_stream;
-	t_main_stream.precision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
-	ErrorCode = MainPhaseData.SaveToStream(t_main_stream, KMCOUT_TSIMULATION_CHK_OFFSET, KMCOUT_TSIMULATION_MAIN_START, KMCOUT_TSIMULATION_MAIN_END);
-	if (ErrorCode != KMCERR_OK) t_has_main = false;
-
 	// Pruefen ob ueberhaupt Daten vorhanden
+	bool t_has_startlattice = (StartLattice.IsEmpty() == false);
+	bool t_has_prerun = PrerunPhaseData.HasValidData;
+	bool t_has_dynnorm = DynNormPhaseData.HasValidData;
+	bool t_has_main = MainPhaseData.HasValidData;
 	if ((t_has_startlattice == false) && (t_has_prerun == false) && (t_has_dynnorm == false) && (t_has_main == false)) return;
 
-	// Datei oeffnen
-	ofstream outfile(std::string(Trim(i_chkpath)));
-	if (outfile.is_open() == false) return;
+	// Temporaere Datei oeffnen (der bisherige Checkpoint wird erst nach vollstaendigem Schreiben ersetzt)
+	chrono::steady_clock::time_point t_start = chrono::steady_clock::now();
+	string t_chkpath = std::string(Trim(i_chkpath));
+	string t_tmppath = t_chkpath + ".tmp";
+	ofstream outfile(t_tmppath);
+	if (outfile.is_open() == false)
+	{
+		cout << i_space << "Error: Cannot open checkpoint file: " << t_tmppath << endl;
+		return;
+	}
+
+	// Blockweise gepufferten Stream erstellen (Phasen werden direkt geschrieben, ohne Zwischenspeicherung in stringstreams)
+	TBlockStreamBuf outbuf(outfile.rdbuf(), KMCVAR_SAVEFILE_BLOCKSIZE);
+	ostream outstream(&outbuf);
 
 	// Double-Precision setzen
-	outfile.precision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
+	outstream.precision(KMCVAR_SAVEFILE_DOUBLEPRECISION);
 
 	// Dateiheader schreiben
-	outfile << "CHECKPOINT FILE" << endl;
-	outfile << "iCon - Kinetic Monte-Carlo Simulation of Ionic Conductivity" << endl;
-	outfile << "Copyright 2016-2025, P. Hein, Workgroup Martin, IPC, RWTH Aachen" << endl;
-	outfile << "Distributed under GPL v3 license. Publication of results requires proper attribution." << endl;
-	outfile << KMCOUT_VERSION << " " << KMC_VERSION << endl;
-	outfile << "File creation time: " << TCustomTime::GetCurrentTimeStr() << endl;
-	outfile << endl;
-	outfile << KMCOUT_TSIMULATION_CHK_START;
+	outstream << "CHECKPOINT FILE" << endl;
+	outstream << "iCon - Kinetic Monte-Carlo Simulation of Ionic Conductivity" << endl;
+	outstream << "Copyright 2016-2025, P. Hein, Workgroup Martin, IPC, RWTH Aachen" << endl;
+	outstream << "Distributed under GPL v3 license. Publication of results requires proper attribution." << endl;
+	outstream << KMCOUT_VERSION << " " << KMC_VERSION << endl;
+	outstream << "File creation time: " << TCustomTime::GetCurrentTimeStr() << endl;
+	outstream << endl;
+	outstream << KMCOUT_TSIMULATION_CHK_START;
 
 	// Startgitter schreiben
 	if (t_has_startlattice == true)
 	{
-		outfile << endl;
-		outfile << t_startlattice.str();
-		outfile.flush();
+		outstream << endl;
+		outstream << sub_offset << KMCOUT_TSIMULATION_STARTLATTICE_START << '\n';
+		for (size_t i = 0; i < StartLattice.GetCount(); i += (size_t)StartLattice.GetStackSize())
+		{
+			outstream << sub_offset;
+			for (int s = 0; s < StartLattice.GetStackSize(); s++)
+			{
+				WriteNumber(outstream, StartLattice[i + s]);
+				outstream.put(' ');
+			}
+			outstream.put('\n');
+		}
+		outstream << sub_offset << KMCOUT_TSIMULATION_STARTLATTICE_END << '\n';
 	}
 
 	// Prerun schreiben
 	if (t_has_prerun == true)
 	{
-		outfile << endl;
-		outfile << t_prerun_stream.str();
-		outfile.flush();
+		outstream << endl;
+		ErrorCode = PrerunPhaseData.SaveToStream(outstream, KMCOUT_TSIMULATION_CHK_OFFSET, KMCOUT_TSIMULATION_PRERUN_START, KMCOUT_TSIMULATION_PRERUN_END);
 	}
 
 	// DynNorm schreiben
-	if (t_has_dynnorm == true)
+	if ((t_has_dynnorm == true) && (ErrorCode == KMCERR_OK))
 	{
-		outfile << endl;
-		outfile << t_dynnorm_stream.str();
-		outfile.flush();
+		outstream << endl;
+		ErrorCode = DynNormPhaseData.SaveToStream(outstream, KMCOUT_TSIMULATION_CHK_OFFSET, KMCOUT_TSIMULATION_DYNNORM_START, KMCOUT_TSIMULATION_DYNNORM_END);
 	}
 
 	// Main schreiben
-	if (t_has_main == true)
+	if ((t_has_main == true) && (ErrorCode == KMCERR_OK))
 	{
-		outfile << endl;
-		outfile << t_main_stream.str();
-		outfile.flush();
+		outstream << endl;
+		ErrorCode = MainPhaseData.SaveToStream(outstream, KMCOUT_TSIMULATION_CHK_OFFSET, KMCOUT_TSIMULATION_MAIN_START, KMCOUT_TSIMULATION_MAIN_END);
 	}
 
 	// Abschlusszeile schreiben
-	outfile << KMCOUT_TSIMULATION_CHK_END << endl;
+	outstream << KMCOUT_TSIMULATION_CHK_END << endl;
 
 	// Datei schliessen
+	if ((outbuf.Flush() == false) || (outstream.fail() == true)) ErrorCode = KMCERR_INVALID_INPUT;
 	outfile.close();
+	if (outfile.fail() == true) ErrorCode = KMCERR_INVALID_INPUT;
+
+	// Bisherigen Checkpoint ersetzen, bei Fehlern bleibt dieser unveraendert erhalten
+	error_code ec;
+	if (ErrorCode == KMCERR_OK)
+	{
+		filesystem::rename(filesystem::path(t_tmppath), filesystem::path(t_chkpath), ec);
+		if (ec) ErrorCode = KMCERR_INVALID_INPUT;
+	}
+	if (ErrorCode != KMCERR_OK)
+	{
+		filesystem::remove(filesystem::path(t_tmppath), ec);
+		cout << i_space << "Error: Cannot write checkpoint file: " << t_chkpath << endl;
+		cout << i_space << "       The previous checkpoint is kept." << endl;
+		return;
+	}
+
+	// Dauer fuer die Telemetrie veroeffentlichen
+	spTelemetry.CheckpointDuration.store(chrono::duration<double>(chrono::steady_clock::now() - t_start).count(), memory_order_relaxed);
+	spTelemetry.CheckpointCount.fetch_add(1ULL, memory_order_relaxed);
 
 	cout << i_space << "Checkpoint saved." << endl;
 }
 
+// CheckPoint-Pfad ohne Dateiendung (Basis fuer Observablen, Trajektorie und Telemetrie)
+string TSimulationBase::GetRecordBasePath() const
+{
+	string t_path = CheckPointPath;
+	if ((t_path.size() > KMCPATH_CHK_EXT.size()) &&
+		(t_path.compare(t_path.size() - KMCPATH_CHK_EXT.size(), KMCPATH_CHK_EXT.size(), KMCPATH_CHK_EXT) == 0))
+	{
+		t_path.erase(t_path.size() - KMCPATH_CHK_EXT.size());
+	}
+	return t_path;
+}
+
+// Aktuelle Zaehler fuer die Telemetrie veroeffentlichen
+void TSimulationBase::PublishTelemetry()
+{
+
+	spTelemetry.MCSP.store(spMCSP, memory_order_relaxed);
+	spTelemetry.JumpAttempts.store(spJumpAttempts, memory_order_relaxed);
+	spTelemetry.AcceptedJumps.store(spMCSP * spTotalMovAnz, memory_order_relaxed);
+	spTelemetry.NonsenseAttempts.store(spNonsenseAttempts, memory_order_relaxed);
+	spTelemetry.OverkillAttempts.store(spOverkillAttempts, memory_order_relaxed);
+	spTelemetry.SiteBlocking.store(spSiteBlockingCounter, memory_order_relaxed);
+	spTelemetry.Normalization.store(spNormalization, memory_order_relaxed);
+}
+
+// Speicherbedarf der Gitterdaten, erhaltene Seitengroessen und bisherigen Spitzenspeicherverbrauch ausgeben
+void TSimulationBase::MemoryReport(string i_space) const
+{
+
+	// Gitterdaten: Startgitter, Gitter und Bewegungsgitter aller Phasen (die Simulation arbeitet direkt auf den Gittern der aktiven Phase)
+	size_t t_lattice_bytes = StartLattice.GetCount() * sizeof(int);
+	const TSimPhaseInfo* t_phases[3] = { &PrerunPhaseData, &DynNormPhaseData, &MainPhaseData };
+	for (int i = 0; i < 3; i++)
+	{
+		t_lattice_bytes += t_phases[i]->CurrentLattice.GetCount() * sizeof(int);
+		t_lattice_bytes += t_phases[i]->CurrentMovLattice.GetCount() * sizeof(T3DMovVector);
+	}
+	cout << i_space << "Memory usage of lattice data: " << double(t_lattice_bytes) / 1048576.0 << " MB" << endl;
+
+	// Erhaltene Seitengroessen der grossen Simulationsarrays (siehe TSimAlloc, jeweils groesstes Array)
+	const void* t_vaclist = NULL;
+	if (spVacLists != NULL)
+	{
+		for (int i = 0; i < spDirSelCount; i++)
+		{
+			if (TSimAlloc::GetBlockSize(spVacLists[i]) > TSimAlloc::GetBlockSize(t_vaclist)) t_vaclist = spVacLists[i];
+		}
+	}
+	const void* t_codeenergies = NULL;
+	if ((spJumps != NULL) && (spDirCount != NULL) && (spDirLink != NULL))
+	{
+		for (int i = 0; i < spMovStackSize; i++)
+		{
+			if (spJumps[i] == NULL) continue;
+			for (int j = 0; j < spDirCount[spDirLink[i]]; j++)
+			{
+				if (spJumps[i][j].unique_jump == NULL) continue;
+				if (TSimAlloc::GetBlockSize(spJumps[i][j].unique_jump->code_energies) > TSimAlloc::GetBlockSize(t_codeenergies))
+					t_codeenergies = spJumps[i][j].unique_jump->code_energies;
+			}
+		}
+	}
+	cout << i_space << "Memory pages obtained:" << endl;
+	cout << i_space << "  Lattice: " << TSimAlloc::GetPageInfo((spLattice != NULL) ? (const void*)spLattice : (const void*)StartLattice.GetData()) << endl;
+	if (spMovLattice != NULL) cout << i_space << "  Mov lattice: " << TSimAlloc::GetPageInfo(spMovLattice) << endl;
+	if (t_vaclist != NULL) cout << i_space << "  Vacancy lists: " << TSimAlloc::GetPageInfo(t_vaclist) << endl;
+	if (t_codeenergies != NULL) cout << i_space << "  Code energies: " << TSimAlloc::GetPageInfo(t_codeenergies) << endl;
+
+	// Spitzenwert des Prozesses
+	long long t_peak_bytes = GetPeakMemoryUsage();
+	if (t_peak_bytes >= 0LL)
+	{
+		cout << i_space << "Peak memory usage (process): " << double(t_peak_bytes) / 1048576.0 << " MB" << endl;
+	}
+	else
+	{
+		cout << i_space << "Peak memory usage (process): not available" << endl;
+	}
+}
+
 // Daten aus CheckPoint-Datei laden
 int TSimulationBase::LoadCheckPoint(string i_chkpath)
 {
@@ -3603,7 +4045,8 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 	string infilestr((istreambuf_iterator<char>(infile)), istreambuf_iterator<char>());
 	infile.close();
 	infilestr.erase(remove(infilestr.begin(), infilestr.end(), '\r'), infilestr.end());
-	stringstream infilestream(infilestr);
+	TMemoryStreamBuf infilebuf(infilestr);
+	istream infilestream(&infilebuf);
 
 	// Inputparameter setzen
 	infilestream >> skipws;
@@ -3611,10 +4054,11 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 	cout << endl;
 	cout << "Loading checkpoint ..." << endl;
 
+	// Phasenabschnitte werden nur lokalisiert und spaeter direkt aus infilestream geladen (keine Kopie als string)
 	vector<int> t_lin_startlattice;
-	string i_prerun_str = "";
-	string i_dynnorm_str = "";
-	string i_main_str = "";
+	streampos i_prerun_pos = streampos(-1);
+	streampos i_dynnorm_pos = streampos(-1);
+	streampos i_main_pos = streampos(-1);
 
 	string line = "";
 	bool chk_found = false;
@@ -3685,7 +4129,7 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 		else if ((s_temp == KMCOUT_TSIMULATION_PRERUN_START) && (chk_found == true))
 		{
 			s_temp = "";
-			stringstream temp_stream("");
+			streampos t_pos = infilestream.tellg();
 			while (s_temp != KMCOUT_TSIMULATION_PRERUN_END)
 			{
 				if (getline(infilestream, line).fail() == true)
@@ -3693,17 +4137,16 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 					if_failed = true;
 					break;
 				}
-				temp_stream << line << endl;
 				stringstream linestream2(line);
 				if ((linestream2 >> s_temp).fail() == true) s_temp = "";
 			}
 			if (if_failed == true) break;
-			i_prerun_str = temp_stream.str();
+			i_prerun_pos = t_pos;
 		}
 		else if ((s_temp == KMCOUT_TSIMULATION_DYNNORM_START) && (chk_found == true))
 		{
 			s_temp = "";
-			stringstream temp_stream("");
+			streampos t_pos = infilestream.tellg();
 			while (s_temp != KMCOUT_TSIMULATION_DYNNORM_END)
 			{
 				if (getline(infilestream, line).fail() == true)
@@ -3711,17 +4154,16 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 					if_failed = true;
 					break;
 				}
-				temp_stream << line << endl;
 				stringstream linestream2(line);
 				if ((linestream2 >> s_temp).fail() == true) s_temp = "";
 			}
 			if (if_failed == true) break;
-			i_dynnorm_str = temp_stream.str();
+			i_dynnorm_pos = t_pos;
 		}
 		else if ((s_temp == KMCOUT_TSIMULATION_MAIN_START) && (chk_found == true))
 		{
 			s_temp = "";
-			stringstream temp_stream("");
+			streampos t_pos = infilestream.tellg();
 			while (s_temp != KMCOUT_TSIMULATION_MAIN_END)
 			{
 				if (getline(infilestream, line).fail() == true)
@@ -3729,12 +4171,11 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 					if_failed = true;
 					break;
 				}
-				temp_stream << line << endl;
 				stringstream linestream2(line);
 				if ((linestream2 >> s_temp).fail() == true) s_temp = "";
 			}
 			if (if_failed == true) break;
-			i_main_str = temp_stream.str();
+			i_main_pos = t_pos;
 		}
 		else if (s_temp == KMCOUT_TSIMULATION_CHK_END) break;
 	}
@@ -3749,7 +4190,7 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 	cout << "  Checkpoint data found." << endl;
 
 	// Daten loeschen
-	StartLattice.clear();
+	StartLattice.Clear();
 	PrerunPhaseData.Clear();
 	DynNormPhaseData.Clear();
 	MainPhaseData.Clear();
@@ -3757,21 +4198,8 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 	cout << "  Previous simulation data deleted." << endl;
 
 	// Temporaeres StartLattice erstellen und validieren
-	vector<vector<vector<vector<int>>>> i_StartLattice(spLatticeSize, vector<vector<vector<int>>>(spLatticeSize,
-		vector<vector<int>>(spLatticeSize, vector<int>(spStackSize, -1))));
-	for (int x = 0; x < spLatticeSize; x++)
-	{
-		for (int y = 0; y < spLatticeSize; y++)
-		{
-			for (int z = 0; z < spLatticeSize; z++)
-			{
-				for (int s = 0; s < spStackSize; s++)
-				{
-					i_StartLattice[x][y][z][s] = t_lin_startlattice[(((size_t)spLatticeSize * x + y) * spLatticeSize + z) * spStackSize + s];
-				}
-			}
-		}
-	}
+	T4DLattice<int> i_StartLattice;
+	i_StartLattice.Assign(spLatticeSize, spStackSize, std::move(t_lin_startlattice));
 	ErrorCode = ValidateLattice(&i_StartLattice);
 	if (ErrorCode != KMCERR_OK)
 	{
@@ -3781,16 +4209,17 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 	}
 	else
 	{
-		StartLattice = i_StartLattice;
+		StartLattice.Swap(i_StartLattice);
 		cout << "  Valid start lattice loaded." << endl;
 	}
 
 	// Temporaere PrerunPhaseData erstellen und validieren
-	if (i_prerun_str != "")
+	if (i_prerun_pos != streampos(-1))
 	{
 		TSimPhaseInfo i_PrerunPhaseData;
-		stringstream t_prerun_stream(i_prerun_str);
-		ErrorCode = i_PrerunPhaseData.LoadFromStream(t_prerun_stream, spLatticeSize, spStackSize, spMovStackSize, KMCOUT_TSIMULATION_PRERUN_END);
+		infilestream.clear();
+		infilestream.seekg(i_prerun_pos);
+		ErrorCode = i_PrerunPhaseData.LoadFromStream(infilestream, spLatticeSize, spStackSize, spMovStackSize, KMCOUT_TSIMULATION_PRERUN_END);
 		if (ErrorCode != KMCERR_OK)
 		{
 			cout << "  No valid prerun data found." << endl;
@@ -3804,7 +4233,7 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 			}
 			else
 			{
-				PrerunPhaseData = i_PrerunPhaseData;
+				PrerunPhaseData.Swap(i_PrerunPhaseData);
 				cout << "  Valid prerun data loaded." << endl;
 			}
 		}
@@ -3815,11 +4244,12 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 	}
 
 	// Temporaere DynNormPhaseData erstellen und validieren
-	if (i_dynnorm_str != "")
+	if (i_dynnorm_pos != streampos(-1))
 	{
 		TSimPhaseInfo i_DynNormPhaseData;
-		stringstream t_dynnorm_stream(i_dynnorm_str);
-		ErrorCode = i_DynNormPhaseData.LoadFromStream(t_dynnorm_stream, spLatticeSize, spStackSize, spMovStackSize, KMCOUT_TSIMULATION_DYNNORM_END);
+		infilestream.clear();
+		infilestream.seekg(i_dynnorm_pos);
+		ErrorCode = i_DynNormPhaseData.LoadFromStream(infilestream, spLatticeSize, spStackSize, spMovStackSize, KMCOUT_TSIMULATION_DYNNORM_END);
 		if (ErrorCode != KMCERR_OK)
 		{
 			cout << "  No valid dyn. norm. data found." << endl;
@@ -3833,7 +4263,7 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 			}
 			else
 			{
-				DynNormPhaseData = i_DynNormPhaseData;
+				DynNormPhaseData.Swap(i_DynNormPhaseData);
 				cout << "  Valid dyn. norm. data loaded." << endl;
 			}
 		}
@@ -3844,11 +4274,12 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 	}
 
 	// Temporaere MainPhaseData erstellen und validieren
-	if (i_main_str != "")
+	if (i_main_pos != streampos(-1))
 	{
 		TSimPhaseInfo i_MainPhaseData;
-		stringstream t_main_stream(i_main_str);
-		ErrorCode = i_MainPhaseData.LoadFromStream(t_main_stream, spLatticeSize, spStackSize, spMovStackSize, KMCOUT_TSIMULATION_MAIN_END);
+		infilestream.clear();
+		infilestream.seekg(i_main_pos);
+		ErrorCode = i_MainPhaseData.LoadFromStream(infilestream, spLatticeSize, spStackSize, spMovStackSize, KMCOUT_TSIMULATION_MAIN_END);
 		if (ErrorCode != KMCERR_OK)
 		{
 			cout << "  No valid main simulation data found." << endl;
@@ -3862,7 +4293,7 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 			}
 			else
 			{
-				MainPhaseData = i_MainPhaseData;
+				MainPhaseData.Swap(i_MainPhaseData);
 				cout << "  Valid main simulation data loaded." << endl;
 			}
 		}
@@ -3872,6 +4303,19 @@ int TSimulationBase::LoadCheckPoint(string i_chkpath)
 		cout << "  No main simulation data present." << endl;
 	}
 
+	// Abgegebene Gitter pruefen (leeres Phasengitter nur gueltig, wenn die uebernehmende Phase gueltig geladen wurde)
+	if ((DynNormPhaseData.HasValidData == true) && (DynNormPhaseData.CurrentLattice.IsEmpty() == true) && (MainPhaseData.HasValidData == false))
+	{
+		DynNormPhaseData.Clear();
+		cout << "  Dyn. norm. data is invalid (lattice was handed over to missing main simulation data)." << endl;
+	}
+	if ((PrerunPhaseData.HasValidData == true) && (PrerunPhaseData.CurrentLattice.IsEmpty() == true) &&
+		(DynNormPhaseData.HasValidData == false) && ((i_dynnorm_pos != streampos(-1)) || (MainPhaseData.HasValidData == false)))
+	{
+		PrerunPhaseData.Clear();
+		cout << "  Prerun data is invalid (lattice was handed over to missing subsequent phase data)." << endl;
+	}
+
 	cout << "Checkpoint loading complete." << endl;
 	return KMCERR_OK;
 }
@@ -3893,8 +4337,8 @@ int TSimulationBase::ExceptionHandler()
 // ***************************** PROTECTED ********************************** //
 
 // Bewegungsstatistik ausgeben
-int TSimulationBase::MovLatticeAnalysis(const vector<vector<vector<vector<int>>>>* i_lattice,
-	const vector<vector<vector<vector<T3DMovVector>>>>* i_movlattice, vector<double>* o_results) const
+int TSimulationBase::MovLatticeAnalysis(const T4DLattice<int>* i_lattice,
+	const T4DLattice<T3DMovVector>* i_movlattice, vector<double>* o_results) const
 {
 	if (Ready != true)
 	{
@@ -3919,62 +4363,81 @@ int TSimulationBase::MovLatticeAnalysis(const vector<vector<vector<vector<int>>>
 	*o_results = vector<double>(18, 0.0);
 
 	// Bewegungsvektoren aufsummieren
-	int t_idshift = 0;
-	long long t_mov_count = 0LL;
-	long long t_vac_count = 0LL;
-	if (i_movlattice->size() != 0)
+	// (parallel je x-Ebene mit kompensierten Teilsummen, die in fester Reihenfolge zusammengefasst werden,
+	//  d.h. das Ergebnis haengt nicht von der Threadanzahl ab und bleibt auch fuer grosse Gitter genau)
+	if (i_movlattice->GetLatticeSize() != i_lattice->GetLatticeSize())
+	{
+		cout << "Critical Error: Inconsistent lattice sizes (TSimulationBase::MovLatticeAnalysis)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+	int t_PlaneCount = i_movlattice->GetLatticeSize();
+	size_t t_PlaneCells = 0;
+	if ((i_movlattice->GetStackSize() != 0) && (t_PlaneCount > 0))
+	{
+		t_PlaneCells = i_movlattice->GetCount() / ((size_t)i_movlattice->GetStackSize() * (size_t)t_PlaneCount);
+	}
+	vector<vector<TCompensatedSum>> t_PlaneSums(t_PlaneCount, vector<TCompensatedSum>(18));
+	vector<long long> t_PlaneMovCount(t_PlaneCount, 0LL);
+	vector<long long> t_PlaneVacCount(t_PlaneCount, 0LL);
+	const int* t_sites = i_lattice->GetData();
+	const T3DMovVector* t_movs = i_movlattice->GetData();
+	int ErrorCode = TParallel::For(t_PlaneCount, [&](int x) -> int
 	{
-		for (int x = 0; x < (int)i_movlattice->size(); x++)
+		int t_idshift = 0;
+		vector<TCompensatedSum>& t_sums = t_PlaneSums[x];
+		for (size_t i_cell = (size_t)x * t_PlaneCells; i_cell < (size_t)(x + 1) * t_PlaneCells; i_cell++)
 		{
-			if (i_movlattice->at(x).size() != 0)
+			const int* t_cell_sites = t_sites + i_cell * (size_t)i_lattice->GetStackSize();
+			const T3DMovVector* t_cell_movs = t_movs + i_cell * (size_t)i_movlattice->GetStackSize();
+			for (int s = 0; s < i_movlattice->GetStackSize(); s++)
 			{
-				for (int y = 0; y < (int)i_movlattice->at(x).size(); y++)
-				{
-					if (i_movlattice->at(x)[y].size() != 0)
-					{
-						for (int z = 0; z < (int)i_movlattice->at(x)[y].size(); z++)
-						{
-							if (i_movlattice->at(x)[y][z].size() != 0)
-							{
-								for (int s = 0; s < (int)i_movlattice->at(x)[y][z].size(); s++)
-								{
-
-									// ElemID ueberpruefen
-									if (i_lattice->at(x)[y][z][s] == 0)
-									{
-										t_idshift = 0;
-										t_mov_count += 1LL;
-									}
-									if (i_lattice->at(x)[y][z][s] == 1)
-									{
-										t_idshift = 9;
-										t_vac_count += 1LL;
-									}
-									if ((i_lattice->at(x)[y][z][s] != 0) && (i_lattice->at(x)[y][z][s] != 1))
-									{
-										cout << "Critical Error: Invalid ElemID in the lattice (TSimulationBase::MovLatticeAnalysis)" << endl << endl;
-										return KMCERR_INVALID_INPUT_CRIT;
-									}
 
-									// Bewegung einrechnen
-									o_results->at(0 + t_idshift) += double(i_movlattice->at(x)[y][z][s].jcount);
-									o_results->at(1 + t_idshift) += i_movlattice->at(x)[y][z][s].x;
-									o_results->at(2 + t_idshift) += i_movlattice->at(x)[y][z][s].y;
-									o_results->at(3 + t_idshift) += i_movlattice->at(x)[y][z][s].z;
-									o_results->at(4 + t_idshift) += sqrt(i_movlattice->at(x)[y][z][s].x * i_movlattice->at(x)[y][z][s].x +
-										i_movlattice->at(x)[y][z][s].y * i_movlattice->at(x)[y][z][s].y + i_movlattice->at(x)[y][z][s].z *
-										i_movlattice->at(x)[y][z][s].z);
-									o_results->at(5 + t_idshift) += i_movlattice->at(x)[y][z][s].x * i_movlattice->at(x)[y][z][s].x +
-										i_movlattice->at(x)[y][z][s].y * i_movlattice->at(x)[y][z][s].y + i_movlattice->at(x)[y][z][s].z *
-										i_movlattice->at(x)[y][z][s].z;
-								}
-							}
-						}
-					}
+				// ElemID ueberpruefen
+				if (t_cell_sites[s] == 0)
+				{
+					t_idshift = 0;
+					t_PlaneMovCount[x] += 1LL;
 				}
+				else if (t_cell_sites[s] == 1)
+				{
+					t_idshift = 9;
+					t_PlaneVacCount[x] += 1LL;
+				}
+				else
+				{
+					return KMCERR_INVALID_INPUT_CRIT;
+				}
+
+				// Bewegung einrechnen
+				const T3DMovVector& t_mov = t_cell_movs[s];
+				double t_sqdisp = t_mov.x * t_mov.x + t_mov.y * t_mov.y + t_mov.z * t_mov.z;
+				t_sums[0 + t_idshift].Add(double(t_mov.jcount));
+				t_sums[1 + t_idshift].Add(t_mov.x);
+				t_sums[2 + t_idshift].Add(t_mov.y);
+				t_sums[3 + t_idshift].Add(t_mov.z);
+				t_sums[4 + t_idshift].Add(sqrt(t_sqdisp));
+				t_sums[5 + t_idshift].Add(t_sqdisp);
 			}
 		}
+		return KMCERR_OK;
+	});
+	if (ErrorCode != KMCERR_OK)
+	{
+		cout << "Critical Error: Invalid ElemID in the lattice (TSimulationBase::MovLatticeAnalysis)" << endl << endl;
+		return ErrorCode;
+	}
+
+	// Teilsummen der x-Ebenen zusammenfassen
+	vector<TCompensatedSum> t_sums(18);
+	long long t_mov_count = 0LL;
+	long long t_vac_count = 0LL;
+	for (int x = 0; x < t_PlaneCount; x++)
+	{
+		for (int i = 0; i < 18; i++) t_sums[i].Add(t_PlaneSums[x][i]);
+		t_mov_count += t_PlaneMovCount[x];
+		t_vac_count += t_PlaneVacCount[x];
 	}
+	for (int i = 0; i < 18; i++) o_results->at(i) = t_sums[i].GetSum();
 	if ((t_mov_count <= 0) || (t_vac_count <= 0))
 	{
 		cout << "Critical Error: No moving atoms or vacancies found (TSimulationBase::MovLatticeAnalysis)" << endl << endl;
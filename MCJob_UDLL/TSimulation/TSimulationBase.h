@@ -20,6 +20,7 @@
 // Includes:
 #include <string>
 #include <vector>
+#include <memory>
 #include <random>
 
 // Eigene Includes:
@@ -27,8 +28,12 @@
 #include "TSimulation/TSimUniqueJump.h"
 #include "TSimulation/TSimJump.h"
 #include "TSimulation/TSimPhaseInfo.h"
+#include "TSimulation/TSimObservables.h"
+#include "TSimulation/TSimTrajectory.h"
+#include "TSimulation/TSimTelemetry.h"
 #include "GlobalDefinitions.h"
 #include "T4DLatticeVector.h"
+#include "T4DLattice.h"
 #include "T3DVector.h"
 #include "T3DMovVector.h"
 #include "TCustomTime.h"
@@ -49,7 +54,8 @@ protected:
 	string CheckPointPath;												// Pfad der CheckPoint-Datei
 
 	// Startparameter (letzter CheckPoint-Stand)
-	vector<vector<vector<vector<int>>>> StartLattice;					// Gitterzustand beim Start
+	T4DLattice<int> StartLattice;										// Gitterzustand beim Start
+	shared_ptr<const vector<int>> SharedStartLattice;					// Gemeinsames Startgitter mehrerer Jobs (nur lesend, NULL = zufaelliges Startgitter erzeugen)
 
 	// Vorlauf-Parameter (letzter CheckPoint-Stand)
 	TSimPhaseInfo PrerunPhaseData;										// aktueller Stand aller Vorlauf-Parameter
@@ -88,8 +94,8 @@ protected:
 	unsigned long long spOverkillAttempts;					// Zaehler fuer Sprungversuche mit Hinsprungwahrscheinlichkeit >= 1 (sind nicht in spJumpAttempts enthalten)
 	unsigned long long spSiteBlockingCounter;				// Zaehler fuer Site-Blocking, d.h. Zielplatz schon von Leerstelle besetzt (sind in spJumpAttempts enthalten)
 	double spNormalization;									// Skalierungsfaktor fuer die Wahrscheinlichkeiten
-	int* spLattice;											// Gitter
-	T3DMovVector* spMovLattice;								// Gitter zur Bewegungsspeicherung
+	int* spLattice;											// Gitter (zeigt auf CurrentLattice der aktiven Phase, kein eigener Speicher)
+	T3DMovVector* spMovLattice;								// Gitter zur Bewegungsspeicherung (zeigt auf CurrentMovLattice der aktiven Phase, kein eigener Speicher)
 	unsigned long long* spVacListSizes;						// Anzahlen an Leerstellen je Sprungrichtungsanzahl (schon multipliziert mit Richtungsanzahl)
 	T4DLatticeVector** spVacLists;							// Liste der Leerstellenpositionen je Sprungrichtungsanzahl
 	unsigned long long spVacMaxIndex;						// Maximaler Index zur Leerstellen- und Richtungsauswahl
@@ -98,6 +104,19 @@ protected:
 	int spProbListSize;										// Groesse der Wahrscheinlichkeitslisten
 	TSimProb* spAttemptProbList;							// Liste der Sprungversuchswahrscheinlichkeiten
 	TSimProb* spAcceptedProbList;							// Liste der Wahrscheinlichkeiten der durchgefuehrten Spruenge
+	double spConvTargetError;								// Zielfehler des Konvergenzkriteriums (0 = keine Konvergenzpruefung)
+	unsigned long long spConvMinMCSP;						// Mindest-MCSP vor einem vorzeitigen Abbruch durch das Konvergenzkriterium
+	bool spConverged;										// Flag: true = Simulation wurde durch das Konvergenzkriterium beendet
+	bool spDoAdaptNorm;										// Flag: true = Normierung wird in der aktuellen Phase adaptiv angehoben
+	double spAdaptNormBudget;								// Erlaubter Anteil an Sprungversuchen mit normierter Wahrscheinlichkeit >= 1 (adaptive Normierung)
+	unsigned long long spAdaptNormUntilMCSP;				// MCSP der aktuellen Phase, bis zu denen die Normierung angepasst wird
+	vector<unsigned long long> spAdaptNormHist;				// Log. Histogramm der unnormierten Sprungversuchswahrscheinlichkeiten (phasenuebergreifend, wird nicht von ClearCurrentSim geloescht)
+	unsigned long long spAdaptNormHistSum;					// Anzahl der Eintraege in spAdaptNormHist
+	unsigned long long spObsInterval;						// Intervall [MCSP] der Observablen-Zeitreihe (0 = keine Aufzeichnung in der aktuellen Phase)
+	string spObsPath;										// Pfad der Observablen-Zeitreihe
+	unsigned long long spTrjInterval;						// Intervall [MCSP] der Gittertrajektorie (0 = keine Aufzeichnung in der aktuellen Phase)
+	string spTrjPath;										// Pfad der Gittertrajektorie
+	TSimTelemetryCounters spTelemetry;						// Fuer die Telemetrie veroeffentlichte Zaehler (einmal pro MCSP aktualisiert)
 	TCustomTime spPreviousRunTime;							// Laufzeit der aktuellen Simulationsphase vor der aktuellen Simulation (fuer fortgesetzte Simulationen)
 	TCustomTime spStartTime;								// Startzeit der aktuellen Simulation
 	TCustomTime spRunTime;									// Laufzeit der aktuellen Simulation
@@ -111,12 +130,15 @@ public:
 	int InitializeSimulation();							// Simulationsdaten initialisieren, Ready = true setzen
 	int SetCheckPointPath(string i_CheckPointPath);		// CheckPoint-Dateipfad setzen
 	int LoadCheckPoint();								// Daten aus CheckPoint-Datei laden
+	int CreateSharedStartLattice(shared_ptr<const vector<int>>& o_Lattice);	// Zufaelliges Startgitter erzeugen und zur Verwendung in weiteren Jobs ausgeben
+	int SetSharedStartLattice(shared_ptr<const vector<int>> i_Lattice);		// Gemeinsames Startgitter anstelle eines zufaelligen Startgitters verwenden
 	int MakeSimulation();								// Simulation durchfuehren
 
 	// NON-PUBLISHED
 	TSimulationBase(TKMCJob* pJob);		// Constructor, Ready = false setzen
 	bool IfReady();						// Rueckgabe von Ready
 	bool IfCompleted();					// Rueckgabe von Completed
+	bool IfConverged();					// Rueckgabe von spConverged (true = Hauptsimulation durch das Konvergenzkriterium beendet)
 
 	// Member functions
 private:
@@ -136,20 +158,25 @@ private:
 	int IfAllClassesReady() const;				// Alle Einstellungsklassen auf Existenz und Ready = true pruefen
 	int GetHighestProb(double& o_prob) const;													// Hoechstmoegliche Wahrscheinlichkeit (ohne Normierung) berechnen
 	int GetCondFactor(bool& o_cancalccond, double& o_freq, double& o_condfactor) const;			// Pruefen ob Leitfaehigkeitsberechnung moeglich und Auswertungsparameter berechnen
-	int CreateRandomLattice(vector<vector<vector<vector<int>>>>* o_lattice);					// Gitter mit zufaelliger Verteilung der Dopanden und Leerstellen erzeugen
-	int CreateMovLattice(vector<vector<vector<vector<T3DMovVector>>>>* o_movlattice) const;				// Leeres Gitter zur Bewegungsspeicherung erstellen
-	int LatticeAnalysis(string i_space, const vector<vector<vector<vector<int>>>>* i_lattice) const;	// Gitterstatistik ausgeben
-	int LatticeProbabilitiesAnalysis(string i_space, const vector<vector<vector<vector<int>>>>* i_lattice) const;	// Statistik aller aktuellen Sprungwahrscheinlichkeiten ausgeben (ohne Normierung)
+	int CreateRandomLattice(T4DLattice<int>* o_lattice);					// Gitter mit zufaelliger Verteilung der Dopanden und Leerstellen erzeugen
+	int CreateMovLattice(T4DLattice<T3DMovVector>* o_movlattice) const;				// Leeres Gitter zur Bewegungsspeicherung erstellen
+	int LatticeAnalysis(string i_space, const T4DLattice<int>* i_lattice) const;	// Gitterstatistik ausgeben
+	int LatticeProbabilitiesAnalysis(string i_space, const T4DLattice<int>* i_lattice) const;	// Statistik aller aktuellen Sprungwahrscheinlichkeiten ausgeben (ohne Normierung)
 	int PhaseAnalysis(string i_space, bool is_short, const TSimPhaseInfo& i_phase, bool show_probs) const;			// Simulationsphase auswerten
 	int UniqueSampling(size_t id_count, size_t pos_count, vector<size_t>* o_selected);								// id_count Zahlen aus dem Interval [0, pos_count-1] zufaellig auswaehlen (keine Zahl doppelt, in aufsteigender Ordnung)
-	int SetSimulationData(const TSimPhaseInfo& i_phase);						// Synchronisation: i_phase -> variable Simulationsparameter
+	int AdaptNormalization(TSimPhaseInfo& ispPhase);											// Normierung anhand von spAdaptNormHist anheben und Zeitsumme sowie Wahrscheinlichkeitslisten umskalieren
+	void ClearAdaptNormHist();													// Histogramm der adaptiven Normierung zuruecksetzen
+	int SetSimulationData(TSimPhaseInfo& i_phase);								// Synchronisation: i_phase -> variable Simulationsparameter (Gitter von i_phase werden direkt simuliert)
 	int GetSimulationData(TSimPhaseInfo& o_phase) const;						// Synchronisation: variable Simulationsparameter -> o_phase
 	int ValidatePrerunData(TSimPhaseInfo& i_phase);								// PrerunPhaseData validieren
 	int ValidateDynNormData(TSimPhaseInfo& i_phase);							// DynNormPhaseData validieren
 	int ValidateMainData(TSimPhaseInfo& i_phase);								// MainPhaseData validieren
-	int ValidateLattice(vector<vector<vector<vector<int>>>>* i_lattice);		// Gitter validieren
+	int ValidateLattice(T4DLattice<int>* i_lattice);		// Gitter validieren
 	int ValidateProbLists(TSimPhaseInfo& i_phase, int i_listsize);		// Wahrscheinlichkeitslisten einer Phase validieren
 	void SaveCheckPoint(string i_space, string i_chkpath);				// Daten in CheckPoint-Datei speichern
+	void MemoryReport(string i_space) const;							// Speicherbedarf der Gitterdaten, erhaltene Seitengroessen und bisherigen Spitzenspeicherverbrauch ausgeben
+	string GetRecordBasePath() const;									// CheckPoint-Pfad ohne Dateiendung (Basis fuer Observablen, Trajektorie und Telemetrie)
+	void PublishTelemetry();											// Aktuelle Zaehler fuer die Telemetrie veroeffentlichen
 	int LoadCheckPoint(string i_chkpath);								// Daten aus CheckPoint-Datei laden
 	int StdExceptionHandler(exception& e);				// Standard Exception Handler
 	int ExceptionHandler();							// Exception Handler for unknown Exceptions
@@ -159,8 +186,8 @@ protected:
 	~TSimulationBase();					// Destructor
 
 	// Helper functions
-	int MovLatticeAnalysis(const vector<vector<vector<vector<int>>>>* i_lattice,
-		const vector<vector<vector<vector<T3DMovVector>>>>* i_movlattice, vector<double>* o_results) const;			// Bewegungsstatistik ausgeben
+	int MovLatticeAnalysis(const T4DLattice<int>* i_lattice,
+		const T4DLattice<T3DMovVector>* i_movlattice, vector<double>* o_results) const;			// Bewegungsstatistik ausgeben
 	int GetProjOnEField(const T3DVector& i_disp_vec, double& o_comp_parallel, double& o_comp_perpendicular) const;	// Verschiebungsvektor in eine Komponente parallel zum E-Feld und eine Komponente senkrecht zum E-Feld zerlegen (in der Ebene, die durch Verschiebungsvektor und E-Feld-Vektor aufgespannt wird)
 
 };
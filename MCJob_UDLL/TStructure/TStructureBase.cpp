@@ -20,12 +20,15 @@
 // Includes:
 #include <iomanip>
 #include <sstream>
+#include <cmath>
+#include <algorithm>
 
 // Eigene Includes:
 #include "ErrorCodes.h"
 #include "GlobalDefinitions.h"
 #include "TKMCJob/TKMCJob.h"
 #include "TElements/TElements.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -46,6 +49,11 @@ TStructureBase::TStructureBase(TKMCJob* pJob)
 	DopedID.clear();
 	DopandID.clear();
 	VacDopRatio.clear();
+	CellGridA = 0;
+	CellGridB = 0;
+	CellGridC = 0;
+	CellStart.clear();
+	CellAtoms.clear();
 }
 
 // Destructor
@@ -806,6 +814,9 @@ int TStructureBase::MakeStructure()
 		}
 	}
 
+	// Nachbarindex fuer NNAnalysis erstellen
+	MakeNeighborIndex();
+
 	Ready = true;
 	return KMCERR_OK;
 }
@@ -977,6 +988,7 @@ int TStructureBase::LoadFromStream(istream& input)
 	vector<int> i_DopandID;
 	vector<double> i_VacDopRatio;
 	string line = "";
+	TLineTokenizer linestream;
 	bool if_failed = false;
 	string s_temp = "";
 	int i_temp = 0;
@@ -990,12 +1002,12 @@ int TStructureBase::LoadFromStream(istream& input)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TSTRUCTURE_NAME)
 		{
-			if (getline(linestream, s_temp).fail() == true)
+			if (linestream.Rest(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1004,7 +1016,7 @@ int TStructureBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSTRUCTURE_BASIS)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1018,27 +1030,27 @@ int TStructureBase::LoadFromStream(istream& input)
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "="
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Basis[index].x).fail() == true)
+			if (linestream.Next(i_Basis[index].x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Basis[index].y).fail() == true)
+			if (linestream.Next(i_Basis[index].y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Basis[index].z).fail() == true)
+			if (linestream.Next(i_Basis[index].z) == false)
 			{
 				if_failed = true;
 				break;
@@ -1046,7 +1058,7 @@ int TStructureBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSTRUCTURE_ATOM)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1056,33 +1068,33 @@ int TStructureBase::LoadFromStream(istream& input)
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
 			i_Coord.push_back(T3DVector());
-			if ((linestream >> i_Coord.back().x).fail() == true)
+			if (linestream.Next(i_Coord.back().x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Coord.back().y).fail() == true)
+			if (linestream.Next(i_Coord.back().y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Coord.back().z).fail() == true)
+			if (linestream.Next(i_Coord.back().z) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// ")"
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1091,7 +1103,7 @@ int TStructureBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TSTRUCTURE_DOPING)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1101,19 +1113,19 @@ int TStructureBase::LoadFromStream(istream& input)
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
 			}
 			i_DopedID.push_back(i_temp);
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
 			}
 			i_DopandID.push_back(i_temp);
-			if ((linestream >> d_temp).fail() == true)
+			if (linestream.Next(d_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1213,4 +1225,56 @@ int TStructureBase::LoadFromStream(istream& input)
 	return KMCERR_OK;
 }
 
-// ***************************** PRIVATE ********************************** //
\ No newline at end of file
+// ***************************** PRIVATE ********************************** //
+
+// Nachbarindex (CellGridA/B/C, CellStart, CellAtoms) fuer NNAnalysis erstellen
+// (Elementarzelle wird in Teilzellen mit etwa einem Atom pro Teilzelle zerlegt, die Atome werden nach Teilzellen sortiert abgelegt)
+void TStructureBase::MakeNeighborIndex()
+{
+	CellGridA = 1;
+	CellGridB = 1;
+	CellGridC = 1;
+	CellStart.clear();
+	CellAtoms.clear();
+	if ((int)Coord.size() == 0) return;
+
+	// Teilzellenanzahl aus Elementarzelldicken und mittlerem Atomabstand bestimmen
+	double volume = abs(T3DVector::Cross(a, b) * c);
+	double d_a = volume / T3DVector::Cross(b, c).Length();		// Elementarzellendicke in a-Richtung
+	double d_b = volume / T3DVector::Cross(a, c).Length();		// Elementarzellendicke in b-Richtung
+	double d_c = volume / T3DVector::Cross(a, b).Length();		// Elementarzellendicke in c-Richtung
+	double spacing = cbrt(volume / (double)Coord.size());
+	if (spacing > 0.0)
+	{
+		CellGridA = max(1, min(64, (int)(d_a / spacing)));
+		CellGridB = max(1, min(64, (int)(d_b / spacing)));
+		CellGridC = max(1, min(64, (int)(d_c / spacing)));
+	}
+
+	// Teilzellen der Atome bestimmen (Atome ausserhalb [0,1) werden mit Verschiebung in die Elementarzelle abgelegt)
+	vector<T4DLatticeVector> t_Cells(Coord.size());
+	vector<int> t_Count(CellGridA * CellGridB * CellGridC, 0);
+	int cell_a = 0, cell_b = 0, cell_c = 0;
+	for (int s = 0; s < (int)Coord.size(); s++)
+	{
+		cell_a = (int)floor(Coord[s].x * CellGridA);
+		cell_b = (int)floor(Coord[s].y * CellGridB);
+		cell_c = (int)floor(Coord[s].z * CellGridC);
+		t_Cells[s].x = (cell_a - ((cell_a % CellGridA) + CellGridA) % CellGridA) / CellGridA;
+		t_Cells[s].y = (cell_b - ((cell_b % CellGridB) + CellGridB) % CellGridB) / CellGridB;
+		t_Cells[s].z = (cell_c - ((cell_c % CellGridC) + CellGridC) % CellGridC) / CellGridC;
+		t_Cells[s].s = ((cell_a - t_Cells[s].x * CellGridA) * CellGridB + (cell_b - t_Cells[s].y * CellGridB)) * CellGridC + (cell_c - t_Cells[s].z * CellGridC);
+		t_Count[t_Cells[s].s]++;
+	}
+
+	// Atome nach Teilzellen sortieren (innerhalb einer Teilzelle nach Atomindex)
+	CellStart.assign(t_Count.size() + 1, 0);
+	for (int m = 0; m < (int)t_Count.size(); m++) CellStart[m + 1] = CellStart[m] + t_Count[m];
+	CellAtoms.resize(Coord.size());
+	vector<int> t_Fill(CellStart.begin(), CellStart.end() - 1);
+	for (int s = 0; s < (int)Coord.size(); s++)
+	{
+		CellAtoms[t_Fill[t_Cells[s].s]].Set(t_Cells[s].x, t_Cells[s].y, t_Cells[s].z, s);
+		t_Fill[t_Cells[s].s]++;
+	}
+}
\ No newline at end of file
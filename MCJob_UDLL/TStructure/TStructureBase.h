@@ -23,6 +23,7 @@
 
 // Eigene Includes:
 #include "T3DVector.h"
+#include "T4DLatticeVector.h"
 
 using namespace std;
 
@@ -47,6 +48,10 @@ protected:
 	vector<double> VacDopRatio;		// Verhltnis Leerstellen/Dotieratome, beliebig, z.B. auch kein Einfluss auf Leerstellen oder Leerstellen-vermindernd
 	bool Ready;						// Flag, ob Struktur vollstndig und konsistent
 
+	int CellGridA, CellGridB, CellGridC;	// Nachbarindex fuer NNAnalysis: Anzahl der Teilzellen der Elementarzelle in a-, b- und c-Richtung
+	vector<int> CellStart;					// Nachbarindex: erster Eintrag von Teilzelle m in CellAtoms (Groesse = Teilzellenanzahl + 1)
+	vector<T4DLatticeVector> CellAtoms;		// Nachbarindex: Atome nach Teilzellen sortiert (s = Atom, x,y,z = Verschiebung der Teilzelle zur Atomposition in Elementarzellen)
+
 	// Member functions
 public:
 	// PUBLISHED
@@ -67,6 +72,9 @@ public:
 
 protected:
 	~TStructureBase();						// Destructor
+
+private:
+	void MakeNeighborIndex();				// Nachbarindex (CellGridA/B/C, CellStart, CellAtoms) fuer NNAnalysis erstellen
 };
 
 #endif
\ No newline at end of file
@@ -18,6 +18,8 @@
 #include "TStructure/TStructureFunc.h"
 
 // Includes:
+#include <cmath>
+#include <algorithm>
 
 // Eigene Includes:
 #include "ErrorCodes.h"
@@ -127,142 +129,157 @@ int TStructureFunc::NNAnalysis(const T3DVector& i_center, int shellanz, vector<i
 	center_3D = i_center - a * center_4D.x - b * center_4D.y - c * center_4D.z;
 
 
-	// 2. Naechstliegende Wand finden:
-	double d_atomwall = 0.0;			// kuerzester Abstand des Atoms zur Wand
-	double d_dir = 0.0;					// Elementarzelldicke in kuerzester Ausbreitungsrichtung
-	// -> Normaleneinheitsvektoren der Elementarzellseiten berechnen:
-	T3DVector n_ab = T3DVector::Cross(a, b) * (1 / T3DVector::Cross(a, b).Length());
-	T3DVector n_bc = T3DVector::Cross(b, c) * (1 / T3DVector::Cross(b, c).Length());
-	T3DVector n_ac = T3DVector::Cross(a, c) * (1 / T3DVector::Cross(a, c).Length());
-	// -> Elementarzelldicken berechnen (via Hessesche Normalenform):
-	double d_a = abs(a * n_bc);			// Elementarzellendicke in a-Richtung
-	double d_b = abs(b * n_ac);			// Elementarzellendicke in b-Richtung
-	double d_c = abs(c * n_ab);			// Elementarzellendicke in c-Richtung
-	double d_plusa = abs(abs(center_3D * n_bc) - d_a);		// Abstand des Atoms von der Wand in +a-Richtung
-	double d_minusa = abs(center_3D * n_bc);					// Abstand des Atoms von der Wand in -a-Richtung
-	double d_plusb = abs(abs(center_3D * n_ac) - d_b);		// Abstand des Atoms von der Wand in +b-Richtung
-	double d_minusb = abs(center_3D * n_ac);					// Abstand des Atoms von der Wand in -b-Richtung
-	double d_plusc = abs(abs(center_3D * n_ab) - d_c);		// Abstand des Atoms von der Wand in +c-Richtung
-	double d_minusc = abs(center_3D * n_ab);					// Abstand des Atoms von der Wand in -c-Richtung
-	// -> naechstliegende Wand finden:
-	d_atomwall = d_plusa;
-	d_dir = d_a;
-	if (d_minusa < d_atomwall)
+	// 2. Relative Koordinaten von center_3D und Elementarzelldicken berechnen (fuer die Teilzellen des Nachbarindex)
+	T3DVector n_ab = T3DVector::Cross(a, b);
+	T3DVector n_bc = T3DVector::Cross(b, c);
+	T3DVector n_ac = T3DVector::Cross(a, c);
+	double volume = abs(n_ab * c);
+	double d_a = volume / n_bc.Length();			// Elementarzellendicke in a-Richtung
+	double d_b = volume / n_ac.Length();			// Elementarzellendicke in b-Richtung
+	double d_c = volume / n_ab.Length();			// Elementarzellendicke in c-Richtung
+	double rel_a = (center_3D * n_bc) / (a * n_bc);	// relative Koordinaten von center_3D
+	double rel_b = (center_3D * n_ac) / (b * n_ac);
+	double rel_c = (center_3D * n_ab) / (c * n_ab);
+	if ((CellGridA <= 0) || (CellGridB <= 0) || (CellGridC <= 0) || ((int)CellStart.size() != CellGridA * CellGridB * CellGridC + 1))
 	{
-		d_atomwall = d_minusa; d_dir = d_a;
-	}
-	if (d_plusb < d_atomwall)
-	{
-		d_atomwall = d_plusb; d_dir = d_b;
-	}
-	if (d_minusb < d_atomwall)
-	{
-		d_atomwall = d_minusb; d_dir = d_b;
-	}
-	if (d_plusc < d_atomwall)
-	{
-		d_atomwall = d_plusc; d_dir = d_c;
+		cout << "Critical Error: Neighbor index not ready (in TStructureFunc::NNAnalysis)" << endl << endl;
+		return KMCERR_OBJECT_NOT_READY;
 	}
-	if (d_minusc < d_atomwall)
+
+	// Erlaubte Elemente (elem_ids) markieren
+	vector<bool> elem_ok(Coord.size(), false);
+	bool any_elem_ok = false;
+	for (int s = 0; s < (int)Coord.size(); s++)
 	{
-		d_atomwall = d_minusc; d_dir = d_c;
+		if ((int)elem_ids->size() != 0)
+		{
+			for (int v = 0; v < (int)elem_ids->size(); v++)
+			{
+				if (ElemID[s] == elem_ids->at(v))
+				{
+					elem_ok[s] = true;
+					break;
+				}
+			}
+		}
+		else elem_ok[s] = true;
+		if (elem_ok[s] == true) any_elem_ok = true;
 	}
+	if (any_elem_ok == false) return KMCERR_NO_SHELLS_FOUND;
 
 
 	// LOOP:
 	int shellcount = 0;					// Anzahl an gefundenen Schalen
-	int k_Gr = 0;						// Groesse des Kastens, der untersucht wird
+	double search_radius = 2.0 * cbrt(volume / (double)Coord.size());	// Radius der Kugel um center_3D, in der Atome gesammelt werden
+	int search_count = 0;				// Anzahl der Vergroesserungen von search_radius
 	double oldshellradius = 0.0;		// Radius der alten Schale
 	double newshellradius = 0.0;		// Radius der neuen Schale
 	T4DLatticeVector test;				// 4D-Koordinaten des test-Atoms
 	double testdist = 0.0;				// Abstand des test-Atoms vom moving_elem-Atom
+	vector<pair<double, T4DLatticeVector>> candidates;	// Atome im Suchradius (Abstand, 4D-Koordinaten), nach Abstand sortiert
 	vector<T4DLatticeVector> shell;		// speichert die aktuelle Schale
-	bool position_ok = true;			// Flag, ob Position als Umgebungsatom ok ist (in Bezug auf elem_ids und no_atoms)
+	bool position_ok = true;			// Flag, ob Position als Umgebungsatom ok ist (in Bezug auf no_atoms)
+	int p = 0;
+
+	// Sortierung der Atome innerhalb einer Schale wie bei Durchlauf ueber x, y, z, s (kleine vor grosse Werte)
+	auto lattice_less = [](const T4DLatticeVector& lhs, const T4DLatticeVector& rhs)
+	{
+		if (lhs.x != rhs.x) return lhs.x < rhs.x;
+		if (lhs.y != rhs.y) return lhs.y < rhs.y;
+		if (lhs.z != rhs.z) return lhs.z < rhs.z;
+		return lhs.s < rhs.s;
+	};
 
 	do
 	{
-		// 3. Kastengroesse k_Gr so waehlen, dass d_atomwall + k_Gr*d_dir > oldshellradius, dann k_Gr + 1, damit mind. 1 neues Umgebungsatom drin
-		k_Gr = (int)(abs(oldshellradius - d_atomwall) / d_dir) + 1 + 1;
-		newshellradius = d_atomwall + k_Gr * d_dir;										// ausserstes newshell waehlen
-
-		// 4. In Kasten alle Atome pruefen, welches am geringsten ueber oldshellradius liegt
-		//    -> alle Atome speichern (als T4DVectorLattice), die in [newshellradius-KMCVAR_EQTHRESHOLD_SHELL,newshellradius+KMCVAR_EQTHRESHOLD_SHELL] liegen
-		shell.clear();
-		for (int i = -k_Gr; i < k_Gr + 1; i++)
+		// 3. Alle Teilzellen durchlaufen, die die Kugel mit search_radius um center_3D beruehren (inkl. einer Teilzelle Sicherheitsabstand)
+		//    -> erlaubte Atome mit oldshellradius < Abstand <= search_radius sammeln
+		candidates.clear();
+		int lo_a = (int)floor((rel_a - search_radius / d_a) * CellGridA) - 1;
+		int hi_a = (int)floor((rel_a + search_radius / d_a) * CellGridA) + 1;
+		int lo_b = (int)floor((rel_b - search_radius / d_b) * CellGridB) - 1;
+		int hi_b = (int)floor((rel_b + search_radius / d_b) * CellGridB) + 1;
+		int lo_c = (int)floor((rel_c - search_radius / d_c) * CellGridC) - 1;
+		int hi_c = (int)floor((rel_c + search_radius / d_c) * CellGridC) + 1;
+		for (int ga = lo_a; ga <= hi_a; ga++)
 		{
-			for (int j = -k_Gr; j < k_Gr + 1; j++)
+			int ma = ((ga % CellGridA) + CellGridA) % CellGridA;
+			int ia = (ga - ma) / CellGridA;
+			for (int gb = lo_b; gb <= hi_b; gb++)
 			{
-				for (int k = -k_Gr; k < k_Gr + 1; k++)
+				int mb = ((gb % CellGridB) + CellGridB) % CellGridB;
+				int ib = (gb - mb) / CellGridB;
+				for (int gc = lo_c; gc <= hi_c; gc++)
 				{
-					for (int s = 0; s < (int)Coord.size(); s++)
+					int mc = ((gc % CellGridC) + CellGridC) % CellGridC;
+					int ic = (gc - mc) / CellGridC;
+					int m = (ma * CellGridB + mb) * CellGridC + mc;
+					for (int e = CellStart[m]; e < CellStart[m + 1]; e++)
 					{
-						test.Set(i, j, k, s);
+						int s = CellAtoms[e].s;
+						if (elem_ok[s] == false) continue;
+						test.Set(ia - CellAtoms[e].x, ib - CellAtoms[e].y, ic - CellAtoms[e].z, s);
 
-						// 5. Pruefen, ob erlaubtes Element (elem_ids) und erlaubte Position (no_atoms = nicht-erlaubte Positionen)
-						position_ok = false;
-						if ((int)elem_ids->size() != 0)
-						{
-							for (int v = 0; v < (int)elem_ids->size(); v++)
-							{
-								if (ElemID[s] == elem_ids->at(v))
-								{
-									position_ok = true;
-									break;
-								}
-							}
-						}
-						else position_ok = true;
-						if ((int)no_atoms->size() != 0)
+						// 4. Abstand pruefen
+						testdist = T3DVector::Length(a * test.x + b * test.y + c * test.z + a * Coord[s].x + b * Coord[s].y + c * Coord[s].z - center_3D);	// Abstand berechnen
+						if ((testdist <= oldshellradius) && ((testdist != 0) || (shellcount != 0))) continue;	// Atome die zu nah sind -> raus, mit Beruecksichtigung von Atom genau in center_3D
+						if (testdist > search_radius) continue;													// Atome die zu fern sind -> raus
+
+						// 5. Pruefen, ob erlaubte Position (no_atoms = nicht-erlaubte Positionen)
+						position_ok = true;
+						for (int v = 0; v < (int)no_atoms->size(); v++)
 						{
-							for (int v = 0; v < (int)no_atoms->size(); v++)
+							if (test + center_4D == no_atoms->at(v))
 							{
-								if (test + center_4D == no_atoms->at(v))
-								{
-									position_ok = false;
-									break;
-								}
+								position_ok = false;
+								break;
 							}
 						}
 						if (position_ok == false) continue;
 
-						// 6. Abstand pruefen
-						testdist = T3DVector::Length(a * test.x + b * test.y + c * test.z + a * Coord[s].x + b * Coord[s].y + c * Coord[s].z - center_3D);	// Abstand berechnen
-						if ((testdist <= oldshellradius) && ((testdist != 0) || (shellcount != 0))) continue;	// Atome die zu nah sind -> raus, mit Beruecksichtigung von Atom genau in center_3D
-						if (testdist > newshellradius + KMCVAR_EQTHRESHOLD_SHELL) continue;						// Atome die zu fern sind -> raus
-						if (testdist >= newshellradius - KMCVAR_EQTHRESHOLD_SHELL)
-						{							// wenn Atom zu aktueller kleinster Schale gehoert
-							shell.push_back(test);
-							continue;
-						}
-						// -> alle Faelle auer in (oldshellradius,newshellradius-KMCVAR_EQTHRESHOLD_SHELL) behandelt
-						shell.clear();
-						shell.push_back(test);
-						newshellradius = testdist;
+						candidates.push_back(make_pair(testdist, test));
 					}
 				}
 			}
 		}
-		if ((int)shell.size() == 0) return KMCERR_NO_SHELLS_FOUND;
-
-
-		// 7. oldshellradius setzen auf abstand des am weitesten entfernten Atoms in der Shell (wegen KMCVAR_EQTHRESHOLD_SHELL)
-		oldshellradius = 0.0;
-		for (int v = 0; v < (int)shell.size(); v++)
+		sort(candidates.begin(), candidates.end(),
+			[&lattice_less](const pair<double, T4DLatticeVector>& lhs, const pair<double, T4DLatticeVector>& rhs)
+			{
+				if (lhs.first != rhs.first) return lhs.first < rhs.first;
+				return lattice_less(lhs.second, rhs.second);
+			});
+
+		// 6. Schalen aus den gesammelten Atomen bilden, solange sie vollstaendig im Suchradius liegen
+		//    -> Schale = alle Atome in [newshellradius,newshellradius+KMCVAR_EQTHRESHOLD_SHELL], newshellradius = kleinster Abstand
+		p = 0;
+		while ((shellcount < shellanz) && (p < (int)candidates.size()))
 		{
-			if (T3DVector::Length(a * shell[v].x + b * shell[v].y + c * shell[v].z + a * Coord[shell[v].s].x + b * Coord[shell[v].s].y + c * Coord[shell[v].s].z - center_3D) > oldshellradius)
+			newshellradius = candidates[p].first;
+			if (newshellradius + 2.0 * KMCVAR_EQTHRESHOLD_SHELL >= search_radius) break;		// Schale evtl. nicht vollstaendig gesammelt
+			shell.clear();
+			while ((p < (int)candidates.size()) && (candidates[p].first <= newshellradius + KMCVAR_EQTHRESHOLD_SHELL))
 			{
-				oldshellradius = T3DVector::Length(a * shell[v].x + b * shell[v].y + c * shell[v].z + a * Coord[shell[v].s].x + b * Coord[shell[v].s].y + c * Coord[shell[v].s].z - center_3D);
+				shell.push_back(candidates[p].second);
+				p++;
 			}
-		}
-		if ((oldshellradius == 0) && (shellcount != 0)) return KMCERR_NO_SHELLS_FOUND;
+			sort(shell.begin(), shell.end(), lattice_less);
 
+			// 7. oldshellradius setzen auf abstand des am weitesten entfernten Atoms in der Shell (wegen KMCVAR_EQTHRESHOLD_SHELL)
+			oldshellradius = candidates[p - 1].first;
+			if ((oldshellradius == 0) && (shellcount != 0)) return KMCERR_NO_SHELLS_FOUND;
 
-		// 8. Shell speichern und shellcount erhoehen 
-		for (int v = 0; v < (int)shell.size(); v++)
-		{
-			out_atoms->push_back(shell[v] + center_4D);
+			// 8. Shell speichern und shellcount erhoehen
+			for (int v = 0; v < (int)shell.size(); v++)
+			{
+				out_atoms->push_back(shell[v] + center_4D);
+			}
+			shellcount++;
 		}
-		shellcount++;
+
+		// 9. Suchradius fuer die restlichen Schalen vergroessern
+		search_radius *= 2.0;
+		search_count++;
+		if (search_count > 32) return KMCERR_NO_SHELLS_FOUND;
 
 		// ENDLOOP until shellcount == shellanz;
 	} while (shellcount < shellanz);
@@ -0,0 +1,86 @@
+// **************************************************************** //
+//																	//
+//	Class: TThreadLogBuf											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Output stream buffer for cout that forwards the output of		//
+//    each thread to its own target (e.g. the log file of a job),	//
+//    threads without own target write to the original buffer		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+// Deklarierte Klasse:
+#include "TThreadLogBuf.h"
+
+// Includes:
+
+// Eigene Includes:
+
+using namespace std;
+
+// Ziel des aktuellen Threads
+thread_local streambuf* TThreadLogBuf::ThreadTarget = NULL;
+
+// ***************** CONSTRUCTOR/DESTRUCTOR/OPERATOREN ******************** //
+
+// Constructor, leitet io_Stream auf diesen Puffer um
+// (kein eigener Puffer, damit jedes Zeichen sofort beim Ziel des schreibenden Threads ankommt)
+TThreadLogBuf::TThreadLogBuf(ostream& io_Stream)
+{
+	Stream = &io_Stream;
+	Default = Stream->rdbuf(this);
+}
+
+// Destructor, stellt den urspruenglichen Puffer von io_Stream wieder her
+TThreadLogBuf::~TThreadLogBuf()
+{
+	Stream->rdbuf(Default);
+}
+
+// ***************************** PUBLIC *********************************** //
+
+// Ziel fuer den aktuellen Thread setzen (NULL = urspruenglicher Puffer)
+void TThreadLogBuf::SetThreadTarget(streambuf* i_Target)
+{
+	ThreadTarget = i_Target;
+}
+
+// Ziel des aktuellen Threads ausgeben (NULL = urspruenglicher Puffer)
+streambuf* TThreadLogBuf::GetThreadTarget()
+{
+	return ThreadTarget;
+}
+
+// ***************************** PROTECTED ******************************** //
+
+// Einzelnes Zeichen weiterleiten
+TThreadLogBuf::int_type TThreadLogBuf::overflow(int_type ch)
+{
+	if (traits_type::eq_int_type(ch, traits_type::eof()) == true) return traits_type::not_eof(ch);
+	if (ThreadTarget != NULL) return ThreadTarget->sputc(traits_type::to_char_type(ch));
+
+	lock_guard<mutex> lock(DefaultMutex);
+	return Default->sputc(traits_type::to_char_type(ch));
+}
+
+// Mehrere Zeichen weiterleiten
+streamsize TThreadLogBuf::xsputn(const char* s, streamsize n)
+{
+	if (ThreadTarget != NULL) return ThreadTarget->sputn(s, n);
+
+	lock_guard<mutex> lock(DefaultMutex);
+	return Default->sputn(s, n);
+}
+
+// Ziel des aktuellen Threads synchronisieren
+int TThreadLogBuf::sync()
+{
+	if (ThreadTarget != NULL) return ThreadTarget->pubsync();
+
+	lock_guard<mutex> lock(DefaultMutex);
+	return Default->pubsync();
+}
@@ -0,0 +1,52 @@
+// **************************************************************** //
+//																	//
+//	Class: TThreadLogBuf											//
+//	Author: Philipp Hein											//
+//	Description:													//
+//    Output stream buffer for cout that forwards the output of		//
+//    each thread to its own target (e.g. the log file of a job),	//
+//    threads without own target write to the original buffer		//
+//																	//
+//	Copyright (c) P. Hein, IPC, RWTH Aachen University				//
+//	Distributed under GPL v3 license								//
+//	(see LICENSE.txt file in the solution root folder)				//
+//																	//
+// **************************************************************** //
+
+#ifndef TThreadLogBuf_H
+#define TThreadLogBuf_H
+
+// Includes:
+#include <streambuf>
+#include <ostream>
+#include <mutex>
+
+// Eigene Includes:
+
+using namespace std;
+
+// Klassendeklaration:
+class TThreadLogBuf : public streambuf
+{
+	// Member variables
+protected:
+	ostream* Stream;						// Umgeleiteter Stream (z.B. cout)
+	streambuf* Default;						// Urspruenglicher Puffer von Stream (Ziel fuer Threads ohne eigenes Ziel)
+	mutex DefaultMutex;						// Serialisierung der Ausgaben in Default
+	static thread_local streambuf* ThreadTarget;	// Ziel des aktuellen Threads (NULL = Default)
+
+	// Member functions
+public:
+	TThreadLogBuf(ostream& io_Stream);		// Constructor, leitet io_Stream auf diesen Puffer um
+	~TThreadLogBuf();						// Destructor, stellt den urspruenglichen Puffer von io_Stream wieder her
+
+	static void SetThreadTarget(streambuf* i_Target);		// Ziel fuer den aktuellen Thread setzen (NULL = urspruenglicher Puffer)
+	static streambuf* GetThreadTarget();					// Ziel des aktuellen Threads ausgeben (NULL = urspruenglicher Puffer)
+
+protected:
+	int_type overflow(int_type ch) override;					// Einzelnes Zeichen weiterleiten
+	streamsize xsputn(const char* s, streamsize n) override;	// Mehrere Zeichen weiterleiten
+	int sync() override;										// Ziel des aktuellen Threads synchronisieren
+};
+
+#endif
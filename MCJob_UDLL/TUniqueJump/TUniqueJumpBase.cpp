@@ -20,6 +20,11 @@
 // Includes:
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <fstream>
+#include <filesystem>
+#include <random>
+#include <cstring>
 
 // Eigene Includes:
 #include "ErrorCodes.h"
@@ -30,6 +35,7 @@
 #include "TUniqueJump/TUniqueJump.h"
 #include "TUniqueJumps/TUniqueJumps.h"
 #include "TInteraction/TInteraction.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -58,6 +64,8 @@ TUniqueJumpBase::TUniqueJumpBase(TKMCJob* pJob)
 	FullCodes.clear();
 	FullToUniqueMap.clear();
 
+	InvalidateCoordGrid();
+
 	EnvReady = false;
 	JumpReady = false;
 	CodesReady = false;
@@ -226,6 +234,7 @@ int TUniqueJumpBase::SetEnv(int AtomID, int DirID)
 	AtomActive = i_AtomActive;
 	AtomAdditive = i_AtomAdditive;
 	JumpActive = true;
+	InvalidateCoordGrid();
 
 	// Aufbauende Inhalte lschen
 	InteractionMap.clear();
@@ -318,11 +327,15 @@ int TUniqueJumpBase::Sort()
 
 	// sortierte Inhalte bertragen
 	Coord = t_Coord;
+	InvalidateCoordGrid();
 	ElemID = t_ElemID;
 	AtomIgnore = t_AtomIgnore;
 	AtomActive = t_AtomActive;
 	AtomAdditive = t_AtomAdditive;
 
+	// Suchindex fuer MapToJump erstellen
+	MakeCoordGrid();
+
 	// Aufbauende Inhalte lschen
 	ClearInteractions();
 
@@ -340,6 +353,52 @@ int TUniqueJumpBase::Sort()
 	return KMCERR_OK;
 }
 
+// Bereits sortierte Sprungumgebung setzen (statt SetEnv + Sort, z.B. aus dem Sprungmodell-Cache), Atom-Flags wie in SetEnv
+int TUniqueJumpBase::SetSortedEnv(double i_Length, vector<T3DVector>* i_Coord, vector<int>* i_ElemID)
+{
+	if ((EnvReady != false) || (JumpReady != false) || (CodesReady != false))
+	{
+		cout << "Critical Error: TUniqueJump ready too early (in TUniqueJumpBase::SetSortedEnv)" << endl << endl;
+		return KMCERR_READY_NOT_FALSE;
+	}
+
+	// Input pruefen
+	if ((i_Coord == NULL) || (i_ElemID == NULL))
+	{
+		cout << "Critical Error: Invalid input pointer (in TUniqueJumpBase::SetSortedEnv)" << endl << endl;
+		return KMCERR_INVALID_POINTER;
+	}
+	if ((i_Length <= T3DVector::zero_threshold) || (i_Coord->size() == 0) || (i_Coord->size() != i_ElemID->size()))
+	{
+		cout << "Critical Error: Invalid jump environment (in TUniqueJumpBase::SetSortedEnv)" << endl << endl;
+		return KMCERR_INVALID_INPUT_CRIT;
+	}
+
+	// Werte bertragen
+	Length = i_Length;
+	Coord = *i_Coord;
+	ElemID = *i_ElemID;
+	AtomIgnore = vector<bool>(Coord.size(), false);
+	AtomActive = vector<bool>(Coord.size(), true);
+	AtomAdditive = vector<bool>(Coord.size(), false);
+	for (int i = 0; i < (int)ElemID.size(); i++)
+	{
+		if (ElemID[i] == 0) AtomAdditive[i] = true;			// Leerstellen standardmaessig additiv
+	}
+	JumpActive = true;
+	InvalidateCoordGrid();
+	EnvReady = true;
+
+	// Suchindex fuer MapToJump erstellen
+	MakeCoordGrid();
+
+	// Aufbauende Inhalte lschen
+	ClearInteractions();
+
+	JumpReady = true;
+	return KMCERR_OK;
+}
+
 // Sprung auf toJump mappen -> mapping = map: Jump.CoordID -> toJump.CoordID
 int TUniqueJumpBase::MapToJump(TUniqueJump& toJump, vector<int>* jMap)
 {
@@ -354,29 +413,11 @@ int TUniqueJumpBase::MapToJump(TUniqueJump& toJump, vector<int>* jMap)
 		return KMCERR_OBJECT_NOT_READY;
 	}
 
-	// Coord und ElemID von toJump bertragen
-	int ErrorCode = KMCERR_OK;
-	double Length2 = 0;
-	vector<T3DVector> Coord2;
-	vector<int> ElemID2;
-	ErrorCode = toJump.GetLength(Length2);
-	if (ErrorCode != KMCERR_OK)
-	{
-		cout << "Critical Error: Cannot retrieve jump length (in TUniqueJumpBase::MapToJump)" << endl << endl;
-		return ErrorCode;
-	}
-	ErrorCode = toJump.GetCoords(&Coord2);
-	if (ErrorCode != KMCERR_OK)
-	{
-		cout << "Critical Error: Cannot retrieve jump environment positions (in TUniqueJumpBase::MapToJump)" << endl << endl;
-		return ErrorCode;
-	}
-	ErrorCode = toJump.GetElemIDs(&ElemID2);
-	if (ErrorCode != KMCERR_OK)
-	{
-		cout << "Critical Error: Cannot retrieve jump environment elements (in TUniqueJumpBase::MapToJump)" << endl << endl;
-		return ErrorCode;
-	}
+	// Coord und ElemID von toJump referenzieren (keine Kopie, da MapToJump sehr haeufig aufgerufen wird)
+	TUniqueJumpBase& to = toJump;
+	double Length2 = to.Length;
+	const vector<T3DVector>& Coord2 = to.Coord;
+	const vector<int>& ElemID2 = to.ElemID;
 
 	// Vergleich der Sprnge
 	if ((Length >= Length2 + T3DVector::eq_threshold) || (Length <= Length2 - T3DVector::eq_threshold)) return KMCERR_UNEQUAL;
@@ -414,18 +455,18 @@ int TUniqueJumpBase::MapToJump(TUniqueJump& toJump, vector<int>* jMap)
 	// --- MAPPING --- //
 	jMap->clear();
 
+	// Suchindex von toJump verwenden (in Sort() erstellt), ansonsten jetzt erstellen
+	if (to.CoordGridValid == false) to.MakeCoordGrid();
+
 	// Falls in j1 und j2 kein Vektor y != 0 hat, dann besonderes mapping, denn alle Atome auf Sprungachse
+	int k = -1;
 	if (yzerocounterj1 == 0)
 	{	// d.h. alle Atome auf Sprungachse
 		for (int j = 0; j < (int)Coord.size(); j++)
 		{
-			for (int k = 0; k < (int)Coord2.size(); k++)
-			{
-				if (ElemID[j] != ElemID2[k]) continue;
-				if ((Coord[j].x >= Coord2[k].x + T3DVector::eq_threshold) || (Coord[j].x <= Coord2[k].x - T3DVector::eq_threshold)) continue;
-				jMap->push_back(k);
-				break;
-			}
+			k = to.FindCoord(Coord[j], ElemID[j], true, 0.0);
+			if (k == -1) break;
+			jMap->push_back(k);
 		}
 		if (jMap->size() == Coord.size())
 		{
@@ -453,18 +494,9 @@ int TUniqueJumpBase::MapToJump(TUniqueJump& toJump, vector<int>* jMap)
 		// Paare finden (gleichzeitig mapping)
 		for (int j = 0; j < (int)Coord.size(); j++)
 		{
-			for (int k = 0; k < (int)Coord2.size(); k++)
-			{
-				if (ElemID[j] != ElemID2[k]) continue;
-				if ((Coord[j].x >= Coord2[k].x + T3DVector::eq_threshold) || (Coord[j].x <= Coord2[k].x - T3DVector::eq_threshold)) continue;
-				if ((Coord[j].y >= Coord2[k].y + T3DVector::eq_threshold) || (Coord[j].y <= Coord2[k].y - T3DVector::eq_threshold)) continue;
-				if ((Coord2[k].y < -T3DVector::eq_threshold) || (Coord2[k].y > T3DVector::eq_threshold))
-				{
-					if (CirclePeriodicCompare(Coord[j].z + dangle, Coord2[k].z) == false) continue;			// periodische Abfrage wenn y != 0
-				}
-				jMap->push_back(k);
-				break;
-			}
+			k = to.FindCoord(Coord[j], ElemID[j], false, Coord[j].z + dangle);
+			if (k == -1) break;
+			jMap->push_back(k);
 		}
 		if (jMap->size() == Coord.size()) break;		// d.h. mapping gefunden
 		// Paare finden (gleichzeitig mapping) mit gespiegelten Winkeln (an 0,180-Achse) des j1-Jumps -> axiale Chiralitaet der Umgebung umgehen
@@ -475,18 +507,9 @@ int TUniqueJumpBase::MapToJump(TUniqueJump& toJump, vector<int>* jMap)
 		jMap->clear();
 		for (int j = 0; j < (int)Coord.size(); j++)
 		{
-			for (int k = 0; k < (int)Coord2.size(); k++)
-			{
-				if (ElemID[j] != ElemID2[k]) continue;
-				if ((Coord[j].x >= Coord2[k].x + T3DVector::eq_threshold) || (Coord[j].x <= Coord2[k].x - T3DVector::eq_threshold)) continue;
-				if ((Coord[j].y >= Coord2[k].y + T3DVector::eq_threshold) || (Coord[j].y <= Coord2[k].y - T3DVector::eq_threshold)) continue;
-				if ((Coord2[k].y < -T3DVector::eq_threshold) || (Coord2[k].y > T3DVector::eq_threshold))
-				{
-					if (CirclePeriodicCompare(dangle - Coord[j].z, Coord2[k].z) == false) continue;		// periodische Abfrage wenn y != 0
-				}
-				jMap->push_back(k);
-				break;
-			}
+			k = to.FindCoord(Coord[j], ElemID[j], false, dangle - Coord[j].z);
+			if (k == -1) break;
+			jMap->push_back(k);
 		}
 		if (jMap->size() == Coord.size()) break;
 	}
@@ -640,7 +663,7 @@ int TUniqueJumpBase::SetAtomAdditive(int CoordID, bool State)
 }
 
 // Wechselwirkungen charakterisieren
-int TUniqueJumpBase::CharacterizeInteractions(int UniqueJumpID, int InteractionShellCount, vector<TInteraction>* t_Interactions)
+int TUniqueJumpBase::CharacterizeInteractions(int UniqueJumpID, int InteractionShellCount, vector<TInteraction>* t_Interactions, TInteractionCache* t_Cache)
 {
 	if (EnvReady != true)
 	{
@@ -686,6 +709,12 @@ int TUniqueJumpBase::CharacterizeInteractions(int UniqueJumpID, int InteractionS
 		cout << "                Input: " << UniqueJumpID << " " << InteractionShellCount << endl << endl;
 		return KMCERR_OBJECT_NOT_READY;
 	}
+	if (t_Cache == NULL)
+	{
+		cout << "Critical Error: Interaction cache is null pointer (in TUniqueJumpBase::CharacterizeInteractions)" << endl;
+		cout << "                Input: " << UniqueJumpID << " " << InteractionShellCount << endl << endl;
+		return KMCERR_INVALID_POINTER;
+	}
 
 	// Pruefen ob keine nicht-ignorierten, additiven Atome in der Umgebung vorhanden sind -> nichts zu tun
 	int t_additivecount = 0;
@@ -778,24 +807,50 @@ int TUniqueJumpBase::CharacterizeInteractions(int UniqueJumpID, int InteractionS
 
 			// Wechselwirkung charakterisieren
 			TInteraction Interaction(m_Job);
-			int ErrorCode = Interaction.MakeInteraction(JumpStart4D, JumpEnv4D[i], JumpDest4D, InteractionShellCount);
+			int ErrorCode = Interaction.MakeInteraction(JumpStart4D, JumpEnv4D[i], JumpDest4D, InteractionShellCount, t_Cache);
 			if (ErrorCode != KMCERR_OK) return ErrorCode;
 
-			// Mit bisherigen Wechselwirkungen vergleichen
+			// Kandidaten aus dem Suchindex ermitteln (benachbarte Abstandsraster beruecksichtigen, da Compare Abstaende mit Toleranz vergleicht)
+			int ww_elemid = -1;
+			double ww_startdist = 0.0;
+			double ww_destdist = 0.0;
+			ErrorCode = Interaction.GetWWDesc(ww_elemid, ww_startdist, ww_destdist);
+			if (ErrorCode != KMCERR_OK)
+			{
+				cout << "Critical Error: Cannot retrieve interaction description (in TUniqueJumpBase::CharacterizeInteractions)" << endl;
+				cout << "                Input: " << UniqueJumpID << " " << InteractionShellCount << endl << endl;
+				return ErrorCode;
+			}
+			double dist_width = 100.0 * T3DVector::zero_threshold;
+			long long start_bin = min((long long)(ww_startdist / dist_width), 2097150LL);
+			long long dest_bin = min((long long)(ww_destdist / dist_width), 2097150LL);
+			auto index_key = [ww_elemid](long long i_start_bin, long long i_dest_bin) -> unsigned long long
+			{
+				return ((unsigned long long)ww_elemid * 2097152ULL + (unsigned long long)i_start_bin) * 2097152ULL + (unsigned long long)i_dest_bin;
+			};
+			vector<int> candidates;
+			for (long long ds = max(start_bin - 1, 0LL); ds <= start_bin + 1; ds++)
+			{
+				for (long long dd = max(dest_bin - 1, 0LL); dd <= dest_bin + 1; dd++)
+				{
+					auto index_it = t_Cache->Index.find(index_key(ds, dd));
+					if (index_it != t_Cache->Index.end()) candidates.insert(candidates.end(), index_it->second.begin(), index_it->second.end());
+				}
+			}
+			sort(candidates.begin(), candidates.end());
+
+			// Mit bisherigen Wechselwirkungen vergleichen (kleinster Index zuerst)
 			bool if_found = false;
-			if (t_Interactions->size() != 0)
+			for (int j = 0; j < (int)candidates.size(); j++)
 			{
-				for (int j = 0; j < (int)t_Interactions->size(); j++)
+				ErrorCode = t_Interactions->at(candidates[j]).Compare(Interaction);
+				if (ErrorCode == KMCERR_EQUAL)
 				{
-					ErrorCode = t_Interactions->at(j).Compare(Interaction);
-					if (ErrorCode == KMCERR_EQUAL)
-					{
-						if_found = true;
-						i_InteractionMap[i_help] = j;
-						break;
-					}
-					else if (ErrorCode != KMCERR_UNEQUAL) return ErrorCode;
+					if_found = true;
+					i_InteractionMap[i_help] = candidates[j];
+					break;
 				}
+				else if (ErrorCode != KMCERR_UNEQUAL) return ErrorCode;
 			}
 
 			// Wechselwirkung speichern falls noch nicht vorhanden
@@ -803,6 +858,7 @@ int TUniqueJumpBase::CharacterizeInteractions(int UniqueJumpID, int InteractionS
 			{
 				t_Interactions->push_back(Interaction);
 				i_InteractionMap[i_help] = t_Interactions->size() - 1;
+				t_Cache->Index[index_key(start_bin, dest_bin)].push_back(i_InteractionMap[i_help]);
 			}
 		}
 	}
@@ -883,7 +939,7 @@ int TUniqueJumpBase::UpdateInteractionMaps(vector<int>* old_id_map)
 }
 
 // Mgliche Umgebungsbesetzungen bestimmen und vergleichen (UniqueJumpID ist nur fr Fehlermeldungen)
-int TUniqueJumpBase::MakeUniqueCodes(int UniqueJumpID)
+int TUniqueJumpBase::MakeUniqueCodes(int UniqueJumpID, string CachePath)
 {
 	if (EnvReady != true)
 	{
@@ -1010,11 +1066,41 @@ int TUniqueJumpBase::MakeUniqueCodes(int UniqueJumpID)
 		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 	}
 
-	// Unique-Suche in FullCodes
-	int upos = -1;
+	// Sprungmodell-Cache pruefen (FullToUniqueMap haengt nur von Umgebung, Atom-Flags und dop_map ab)
 	vector<string> i_UniqueCodes;
 	vector<double> i_UniqueEnergies;
 	vector<int> i_FullToUniqueMap;
+	unsigned long long cache_key = 0;
+	if (CachePath != "")
+	{
+		cache_key = MakeCodeCacheKey(dop_map);
+		if (LoadCodesFromCache(CachePath, cache_key, (int)i_FullCodes.size(), i_FullToUniqueMap) == true)
+		{
+			for (int i = 0; i < (int)i_FullCodes.size(); i++)
+			{
+				if (i_FullToUniqueMap[i] == (int)i_UniqueCodes.size())
+				{
+					i_UniqueCodes.push_back(i_FullCodes[i]);
+					i_UniqueEnergies.push_back(0.0);
+				}
+				else
+				{
+					i_UniqueCodes[i_FullToUniqueMap[i]] = i_UniqueCodes[i_FullToUniqueMap[i]] + i_FullCodes[i];
+				}
+			}
+
+			FullCodes = i_FullCodes;
+			UniqueCodes = i_UniqueCodes;
+			UniqueEnergies = i_UniqueEnergies;
+			FullToUniqueMap = i_FullToUniqueMap;
+			CodesReady = true;
+			return KMCERR_OK;
+		}
+		i_FullToUniqueMap.clear();
+	}
+
+	// Unique-Suche in FullCodes
+	int upos = -1;
 	vector<int> mapping;
 	TUniqueJump jump1 = *static_cast<TUniqueJump*> (this);
 	TUniqueJump jump2 = *static_cast<TUniqueJump*> (this);
@@ -1056,6 +1142,7 @@ int TUniqueJumpBase::MakeUniqueCodes(int UniqueJumpID)
 			}
 		}
 	}
+	if (CachePath != "") SaveCodesToCache(CachePath, cache_key, i_FullToUniqueMap);
 
 	FullCodes = i_FullCodes;
 	UniqueCodes = i_UniqueCodes;
@@ -1674,6 +1761,7 @@ int TUniqueJumpBase::LoadJumpFromStream(istream& input, int JumpID)
 	vector<bool> i_AtomActive;
 
 	string line = "";
+	TLineTokenizer linestream;
 	bool if_failed = false;
 	string s_temp = "";
 	int i_temp = 0;
@@ -1686,12 +1774,12 @@ int TUniqueJumpBase::LoadJumpFromStream(istream& input, int JumpID)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TUNIQUEJUMP_LENGTH)
 		{
-			if ((linestream >> i_Length).fail() == true)
+			if (linestream.Next(i_Length) == false)
 			{
 				if_failed = true;
 				break;
@@ -1699,7 +1787,7 @@ int TUniqueJumpBase::LoadJumpFromStream(istream& input, int JumpID)
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMP_JUMPACTIVE)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1715,7 +1803,7 @@ int TUniqueJumpBase::LoadJumpFromStream(istream& input, int JumpID)
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMP_COORD)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1730,37 +1818,37 @@ int TUniqueJumpBase::LoadJumpFromStream(istream& input, int JumpID)
 			i_AtomIgnore.push_back(false);
 			i_AtomAdditive.push_back(false);
 			i_AtomActive.push_back(true);
-			if ((linestream >> i_ElemID.back()).fail() == true)
+			if (linestream.Next(i_ElemID.back()) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// "("
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Coord.back().x).fail() == true)
+			if (linestream.Next(i_Coord.back().x) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Coord.back().y).fail() == true)
+			if (linestream.Next(i_Coord.back().y) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_Coord.back().z).fail() == true)
+			if (linestream.Next(i_Coord.back().z) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{	// ")"
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1773,7 +1861,7 @@ int TUniqueJumpBase::LoadJumpFromStream(istream& input, int JumpID)
 			{
 				i_AtomIgnore.back() = false;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1786,7 +1874,7 @@ int TUniqueJumpBase::LoadJumpFromStream(istream& input, int JumpID)
 			{
 				i_AtomAdditive.back() = false;
 			}
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1892,8 +1980,10 @@ int TUniqueJumpBase::LoadCodesFromStream(istream& input)
 
 	string line = "";
 	bool if_failed = false;
-	string s_temp = "";
+	string_view s_temp = "";
+	string_view s_rest = "";
 	int i_temp = 0;
+	TLineTokenizer linestream;		// Zerlegung der Zeilen ohne stringstream (Codetabellen koennen sehr lang sein)
 	while (input.good() == true)
 	{
 		// Zeile laden
@@ -1903,12 +1993,12 @@ int TUniqueJumpBase::LoadCodesFromStream(istream& input)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TUNIQUEJUMP_INTERACTIONATOM)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1919,12 +2009,12 @@ int TUniqueJumpBase::LoadCodesFromStream(istream& input)
 				break;
 			}
 			i_InteractionMap.push_back(-1);
-			if ((linestream >> i_InteractionMap.back()).fail() == true)
+			if (linestream.Next(i_InteractionMap.back()) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1938,12 +2028,12 @@ int TUniqueJumpBase::LoadCodesFromStream(istream& input)
 			i_InteractionEnergies.push_back(vector<double>(i_temp, 0));
 			for (int k = 0; k < i_temp; k++)
 			{
-				if ((linestream >> i_InteractionElemIDs.back().at(k)).fail() == true)
+				if (linestream.Next(i_InteractionElemIDs.back().at(k)) == false)
 				{
 					if_failed = true;
 					break;
 				}
-				if ((linestream >> i_InteractionEnergies.back().at(k)).fail() == true)
+				if (linestream.Next(i_InteractionEnergies.back().at(k)) == false)
 				{
 					if_failed = true;
 					break;
@@ -1952,7 +2042,7 @@ int TUniqueJumpBase::LoadCodesFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMP_UNIQUECODE)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1964,20 +2054,21 @@ int TUniqueJumpBase::LoadCodesFromStream(istream& input)
 			}
 			i_UniqueCodes.push_back("");
 			i_UniqueEnergies.push_back(0);
-			if ((linestream >> i_UniqueEnergies.back()).fail() == true)
+			if (linestream.Next(i_UniqueEnergies.back()) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if (getline(linestream, i_UniqueCodes.back()).fail() == true)
+			if (linestream.Rest(s_rest) == false)
 			{
 				if_failed = true;
 				break;
 			}
+			i_UniqueCodes.back().assign(s_rest.data(), s_rest.size());
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMP_FULLCODE)
 		{
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1989,16 +2080,17 @@ int TUniqueJumpBase::LoadCodesFromStream(istream& input)
 			}
 			i_FullCodes.push_back("");
 			i_FullToUniqueMap.push_back(-1);
-			if ((linestream >> i_FullToUniqueMap.back()).fail() == true)
+			if (linestream.Next(i_FullToUniqueMap.back()) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if (getline(linestream, i_FullCodes.back()).fail() == true)
+			if (linestream.Rest(s_rest) == false)
 			{
 				if_failed = true;
 				break;
 			}
+			i_FullCodes.back().assign(s_rest.data(), s_rest.size());
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMP_END) break;
 	}
@@ -2109,4 +2201,186 @@ void TUniqueJumpBase::RecursivePermutCodeGen(string recstr, int depth, vector<st
 	{
 		RecursivePermutCodeGen(recstr + " " + IntToStr(dmap->at(depth).at(i)), depth + 1, outstr, dmap);
 	}
+}
+
+// Suchindex (CoordGridKeys, CoordGridIDs) aus Coord erstellen
+// (Raster in x und y mit Rasterweite > eq_threshold, d.h. uebereinstimmende Atome liegen hoechstens in benachbarten Rasterzellen)
+void TUniqueJumpBase::MakeCoordGrid()
+{
+	double grid_width = 4.0 * T3DVector::eq_threshold;
+	vector<pair<long long, int>> t_Grid;
+	t_Grid.reserve(Coord.size());
+	for (int i = 0; i < (int)Coord.size(); i++)
+	{
+		t_Grid.push_back(make_pair((long long)floor(Coord[i].x / grid_width) * 4294967296LL + (long long)floor(Coord[i].y / grid_width), i));
+	}
+	sort(t_Grid.begin(), t_Grid.end());
+
+	CoordGridKeys.resize(t_Grid.size());
+	CoordGridIDs.resize(t_Grid.size());
+	for (int i = 0; i < (int)t_Grid.size(); i++)
+	{
+		CoordGridKeys[i] = t_Grid[i].first;
+		CoordGridIDs[i] = t_Grid[i].second;
+	}
+	CoordGridValid = true;
+}
+
+// Suchindex verwerfen (nach jeder Aenderung von Coord)
+void TUniqueJumpBase::InvalidateCoordGrid()
+{
+	CoordGridKeys.clear();
+	CoordGridIDs.clear();
+	CoordGridValid = false;
+}
+
+// Kleinste passende CoordID ueber den Suchindex finden (-1 = nicht gefunden)
+// (gleiche ElemID und x-Koordinate, bei i_AxisOnly == false zusaetzlich gleiche y-Koordinate und bei y != 0 gleicher Winkel z zu i_Angle)
+int TUniqueJumpBase::FindCoord(const T3DVector& i_Coord, int i_ElemID, bool i_AxisOnly, double i_Angle)
+{
+	double grid_width = 4.0 * T3DVector::eq_threshold;
+	long long cell_x = (long long)floor(i_Coord.x / grid_width);
+	long long cell_y = (long long)floor(i_Coord.y / grid_width);
+	int k_min = -1;
+	for (long long dx = -1; dx <= 1; dx++)
+	{
+		// Benachbarte Rasterzellen (cell_x + dx, cell_y - 1) bis (cell_x + dx, cell_y + 1) liegen in CoordGridKeys zusammenhaengend
+		long long key_first = (cell_x + dx) * 4294967296LL + cell_y - 1;
+		long long key_last = (cell_x + dx) * 4294967296LL + cell_y + 1;
+		for (int g = int(lower_bound(CoordGridKeys.begin(), CoordGridKeys.end(), key_first) - CoordGridKeys.begin());
+			(g < (int)CoordGridKeys.size()) && (CoordGridKeys[g] <= key_last); g++)
+		{
+			int k = CoordGridIDs[g];
+			if ((k_min != -1) && (k > k_min)) continue;
+			if (i_ElemID != ElemID[k]) continue;
+			if ((i_Coord.x >= Coord[k].x + T3DVector::eq_threshold) || (i_Coord.x <= Coord[k].x - T3DVector::eq_threshold)) continue;
+			if (i_AxisOnly == false)
+			{
+				if ((i_Coord.y >= Coord[k].y + T3DVector::eq_threshold) || (i_Coord.y <= Coord[k].y - T3DVector::eq_threshold)) continue;
+				if ((Coord[k].y < -T3DVector::eq_threshold) || (Coord[k].y > T3DVector::eq_threshold))
+				{
+					if (CirclePeriodicCompare(i_Angle, Coord[k].z) == false) continue;			// periodische Abfrage wenn y != 0
+				}
+			}
+			k_min = k;
+		}
+	}
+	return k_min;
+}
+
+// Schluessel fuer den Sprungmodell-Cache aus allen codierungsrelevanten Eingaben (FNV-1a ueber Formatversion, Programmversion,
+// Vergleichsschwelle, Sprunglaenge, Koordinaten, ElemIDs, Atom-Flags und Dotierungsmoeglichkeiten)
+unsigned long long TUniqueJumpBase::MakeCodeCacheKey(const vector<vector<int>>& dop_map)
+{
+	unsigned long long key = 14695981039346656037ULL;
+	auto add_bytes = [&key](const void* data, size_t size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; i++)
+		{
+			key ^= bytes[i];
+			key *= 1099511628211ULL;
+		}
+	};
+	auto add_int = [&add_bytes](long long val) { add_bytes(&val, sizeof(val)); };
+	auto add_double = [&add_bytes](double val) { add_bytes(&val, sizeof(val)); };
+
+	add_bytes(KMCPATH_MODELCACHE_MAGIC.data(), KMCPATH_MODELCACHE_MAGIC.size());
+	add_bytes(KMC_VERSION.data(), KMC_VERSION.size());
+	add_double(T3DVector::eq_threshold);
+	add_double(Length);
+	add_int(JumpActive ? 1 : 0);
+	add_int((long long)Coord.size());
+	for (int i = 0; i < (int)Coord.size(); i++)
+	{
+		add_double(Coord[i].x);
+		add_double(Coord[i].y);
+		add_double(Coord[i].z);
+		add_int(ElemID[i]);
+		add_int((AtomIgnore[i] ? 1 : 0) + (AtomActive[i] ? 2 : 0) + (AtomAdditive[i] ? 4 : 0));
+	}
+	add_int((long long)dop_map.size());
+	for (int i = 0; i < (int)dop_map.size(); i++)
+	{
+		add_int((long long)dop_map[i].size());
+		for (int j = 0; j < (int)dop_map[i].size(); j++)
+		{
+			add_int(dop_map[i][j]);
+		}
+	}
+	return key;
+}
+
+// FullToUniqueMap aus Cache laden (false = nicht vorhanden oder ungueltig)
+// Dateiformat (binaer): Kennung (KMCPATH_MODELCACHE_MAGIC), Schluessel (8 Byte), Anzahl FullCodes (4 Byte), FullToUniqueMap (je 4 Byte)
+bool TUniqueJumpBase::LoadCodesFromCache(const string& i_CachePath, unsigned long long i_Key, int i_FullCount, vector<int>& o_FullToUniqueMap)
+{
+	stringstream key_str;
+	key_str << hex << setw(16) << setfill('0') << i_Key;
+	filesystem::path cache_file = filesystem::path(i_CachePath) / (key_str.str() + std::string(KMCPATH_MODELCACHE_EXT));
+
+	ifstream infile(cache_file, ios::binary);
+	if (infile.is_open() == false) return false;
+
+	// Kopf pruefen (Schluesselkollisionen und fremde Dateien ausschliessen)
+	char magic[8] = {};
+	unsigned long long key = 0;
+	int count = 0;
+	infile.read(magic, sizeof(magic));
+	infile.read(reinterpret_cast<char*>(&key), sizeof(key));
+	infile.read(reinterpret_cast<char*>(&count), sizeof(count));
+	if ((infile.good() == false) ||
+		(KMCPATH_MODELCACHE_MAGIC.size() != sizeof(magic)) ||
+		(memcmp(magic, KMCPATH_MODELCACHE_MAGIC.data(), sizeof(magic)) != 0) ||
+		(key != i_Key) || (count != i_FullCount)) return false;
+
+	vector<int> t_map(count, 0);
+	infile.read(reinterpret_cast<char*>(t_map.data()), sizeof(int) * count);
+	if (infile.gcount() != (streamsize)(sizeof(int) * count)) return false;
+
+	// Map pruefen: UniqueIDs muessen in der Reihenfolge ihres ersten Auftretens vergeben sein
+	int unique_count = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if ((t_map[i] < 0) || (t_map[i] > unique_count)) return false;
+		if (t_map[i] == unique_count) unique_count++;
+	}
+
+	o_FullToUniqueMap = t_map;
+	return true;
+}
+
+// FullToUniqueMap in Cache schreiben (Fehler werden ignoriert, da der Cache nur die Rechenzeit betrifft)
+// (Schreiben in temporaere Datei und anschliessendes Umbenennen, damit parallel laufende Jobs keine unvollstaendigen Dateien lesen)
+void TUniqueJumpBase::SaveCodesToCache(const string& i_CachePath, unsigned long long i_Key, const vector<int>& i_FullToUniqueMap)
+{
+	error_code ec;
+	filesystem::create_directories(filesystem::path(i_CachePath), ec);
+	if (filesystem::is_directory(filesystem::path(i_CachePath), ec) == false) return;
+
+	stringstream key_str;
+	key_str << hex << setw(16) << setfill('0') << i_Key;
+	filesystem::path cache_file = filesystem::path(i_CachePath) / (key_str.str() + std::string(KMCPATH_MODELCACHE_EXT));
+	if (filesystem::exists(cache_file, ec) == true) return;
+	stringstream tmp_str;
+	tmp_str << key_str.str() << "." << hex << random_device()() << ".tmp";
+	filesystem::path tmp_file = filesystem::path(i_CachePath) / tmp_str.str();
+
+	int count = (int)i_FullToUniqueMap.size();
+	{
+		ofstream outfile(tmp_file, ios::binary | ios::trunc);
+		if (outfile.is_open() == false) return;
+		outfile.write(KMCPATH_MODELCACHE_MAGIC.data(), KMCPATH_MODELCACHE_MAGIC.size());
+		outfile.write(reinterpret_cast<const char*>(&i_Key), sizeof(i_Key));
+		outfile.write(reinterpret_cast<const char*>(&count), sizeof(count));
+		outfile.write(reinterpret_cast<const char*>(i_FullToUniqueMap.data()), sizeof(int) * count);
+		outfile.close();
+		if (outfile.fail() == true)
+		{
+			filesystem::remove(tmp_file, ec);
+			return;
+		}
+	}
+	filesystem::rename(tmp_file, cache_file, ec);
+	if (ec) filesystem::remove(tmp_file, ec);
 }
\ No newline at end of file
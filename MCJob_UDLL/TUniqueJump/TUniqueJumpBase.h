@@ -30,6 +30,7 @@ using namespace std;
 class TKMCJob;
 class TUniqueJump;
 class TInteraction;
+struct TInteractionCache;
 
 // Klassendeklaration:
 class TUniqueJumpBase
@@ -56,6 +57,10 @@ protected:
 	vector<string> FullCodes;				// alle Besetzungsmglichkeiten der Sprungumgebung (fr nicht-additive Atome)
 	vector<int> FullToUniqueMap;			// map: FullCodesID -> UniqueCodesID
 
+	vector<long long> CoordGridKeys;		// Suchindex fuer MapToJump: sortierte Rasterschluessel der Umgebungsatome (aus x und y), wird in Sort() erstellt
+	vector<int> CoordGridIDs;				// Suchindex fuer MapToJump: CoordIDs in der Reihenfolge von CoordGridKeys
+	bool CoordGridValid;					// Flag, ob der Suchindex zu Coord passt (false nach jeder Aenderung von Coord)
+
 	bool EnvReady;							// Flag, ob Sprungumgebung vollstndig definiert wurde
 	bool JumpReady;							// Flag, ob Sprung vollstndig definiert wurde
 	bool CodesReady;						// Flag, ob mgliche Sprungumgebungsbesetzungen vollstndig definiert wurden
@@ -65,15 +70,16 @@ public:
 	// NON-PUBLISHED
 	int SetEnv(int AtomID, int DirID);									// Setzt Length, Coord und ElemID aus bestimmtem TJump in TJumps
 	int Sort();														// Sortieren (ElemID (gro zuerst), Abstand von Sprungmitte, x-Koordinate, y-Koordinate, z-Koordinate (klein zuerst))
+	int SetSortedEnv(double i_Length, vector<T3DVector>* i_Coord, vector<int>* i_ElemID);	// Bereits sortierte Sprungumgebung setzen (statt SetEnv + Sort, z.B. aus dem Sprungmodell-Cache)
 	int MapToJump(TUniqueJump& toJump, vector<int>* jMap);				// Sprung auf toJump mappen
 	int SetJumpActive(bool State);										// Sprung aktivieren oder deaktivieren
 	int SetAtomIgnore(int CoordID, bool State);						// Umgebungsatom ignorieren oder nicht
 	int SetAtomActive(int CoordID, bool State);						// Umgebungsatom aktivieren oder deaktivieren
 	int SetAtomAdditive(int CoordID, bool State);						// Umgebungsatom additiv oder nicht
-	int CharacterizeInteractions(int UniqueJumpID, int InteractionShellCount, vector<TInteraction>* t_Interactions);		// Wechselwirkungen charakterisieren
+	int CharacterizeInteractions(int UniqueJumpID, int InteractionShellCount, vector<TInteraction>* t_Interactions, TInteractionCache* t_Cache);		// Wechselwirkungen charakterisieren (t_Cache = Suchindex fuer t_Interactions und Schalenanalysen)
 	void ClearInteractions();											// Wechselwirkungsinformationen lschen (incl. Codes)
 	int UpdateInteractionMaps(vector<int>* old_id_map);				// InteractionMap nach Sortierung der Interactions in TUniqueJumps aktualisieren
-	int MakeUniqueCodes(int UniqueJumpID);								// Mgliche Umgebungsbesetzungen bestimmen und vergleichen (UniqueJumpID ist nur fr Fehlermeldungen)
+	int MakeUniqueCodes(int UniqueJumpID, string CachePath = "");		// Mgliche Umgebungsbesetzungen bestimmen und vergleichen (UniqueJumpID ist nur fr Fehlermeldungen, CachePath = Verzeichnis des Sprungmodell-Caches oder "")
 	void ClearCodes();													// Codes lschen
 	int ApplyCode(string i_code);										// ElemIDs entsprechend Code ndern
 	int SetInteractionEnergyByCoord(int CoordID, int ID, double Energy);			// WW-Energie fr bestimmte additive, nicht-ignorierte CoordID und eine bestimmte (Elem)ID-Besetzung setzen
@@ -92,6 +98,12 @@ protected:
 	~TUniqueJumpBase();					// Destructor
 
 	void RecursivePermutCodeGen(string recstr, int depth, vector<string>* outstr, vector<vector<int>>* dmap);		// Liefert rekursiv alle Code-Permutationen
+	void MakeCoordGrid();																// Suchindex (CoordGridKeys, CoordGridIDs) aus Coord erstellen
+	void InvalidateCoordGrid();															// Suchindex verwerfen (nach jeder Aenderung von Coord)
+	int FindCoord(const T3DVector& i_Coord, int i_ElemID, bool i_AxisOnly, double i_Angle);	// Kleinste passende CoordID ueber den Suchindex finden (-1 = nicht gefunden)
+	unsigned long long MakeCodeCacheKey(const vector<vector<int>>& dop_map);						// Schluessel fuer den Sprungmodell-Cache aus allen codierungsrelevanten Eingaben
+	bool LoadCodesFromCache(const string& i_CachePath, unsigned long long i_Key, int i_FullCount, vector<int>& o_FullToUniqueMap);	// FullToUniqueMap aus Cache laden (false = nicht vorhanden oder ungueltig)
+	void SaveCodesToCache(const string& i_CachePath, unsigned long long i_Key, const vector<int>& i_FullToUniqueMap);			// FullToUniqueMap in Cache schreiben (Fehler werden ignoriert)
 };
 
 #endif
\ No newline at end of file
@@ -27,6 +27,7 @@
 #include "TSettings/TSettings.h"
 #include "ErrorCodes.h"
 #include "GlobalDefinitions.h"
+#include "TSimAlloc.h"
 
 using namespace std;
 
@@ -147,7 +148,7 @@ int TUniqueJumpFunc::CreateSimUniqueJump(TSimUniqueJump& o_simuniquejump)
 	{
 
 		// Energie-Array erstellen
-		o_simuniquejump.code_energies = new (nothrow) double[FullToUniqueMap.size()];
+		o_simuniquejump.code_energies = TSimAlloc::New<double>(FullToUniqueMap.size());
 		if (o_simuniquejump.code_energies == NULL) return KMCERR_MAXIMUM_INPUT_REACHED;
 
 		// Code-Energien setzen
@@ -24,10 +24,14 @@
 // Eigene Includes:
 #include "ErrorCodes.h"
 #include "GlobalDefinitions.h"
+#include "TModelCache.h"
 #include "TKMCJob/TKMCJob.h"
+#include "TElements/TElements.h"
 #include "TJumps/TJumps.h"
 #include "TStructure/TStructure.h"
 #include "TInteraction/TInteraction.h"
+#include "TMemoryStreamBuf.h"
+#include "TLineTokenizer.h"
 
 using namespace std;
 
@@ -57,6 +61,8 @@ TUniqueJumpsBase::~TUniqueJumpsBase()
 // Aus Gittersprungumgebungen von TJumps die einzigartigen Sprnge finden
 int TUniqueJumpsBase::MakeUniqueJumps()
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "MakeUniqueJumps");
+
 	if (JumpsReady != false)
 	{
 		cout << "Critical Error: TUniqueJumps->Jumps ready too early (in TUniqueJumpsBase::MakeUniqueJumps)" << endl << endl;
@@ -123,6 +129,30 @@ int TUniqueJumpsBase::MakeUniqueJumps()
 	vector<vector<vector<int>>> mapping(AtomCount, vector<vector<int>>());	// Mapping fr alle i,j speichern und erst am Ende bertragen -> Klasse bleibt gltig, auch bei Abbruch zwischendrin
 	vector<vector<int>> IDs(AtomCount, vector<int>());						// UniqueIDs fr alle i,j speichern und erst am Ende bertragen
 	vector<TUniqueJump> i_UJumps;
+
+	// Sprungmodell-Cache pruefen (einzigartige Spruenge, IDs und Mappings haengen nur von Elementen, Struktur und TJumps ab)
+	string t_CachePath = m_Job->GetModelCachePath();
+	unsigned long long cache_key = 0;
+	if (t_CachePath != "")
+	{
+		if (MakeUJumpCacheKey(cache_key) == false) t_CachePath = "";
+	}
+	if (t_CachePath != "")
+	{
+		if (LoadUJumpsFromCache(t_CachePath, cache_key, DirCount, i_UJumps, IDs, mapping) == true)
+		{
+			ErrorCode = m_Job->m_Jumps->SetUniqueJumps(&IDs, &mapping);		// EnvPos in zugehrigem TJump umsortieren und UniqueJumpIDs setzen
+			if (ErrorCode != KMCERR_OK) return ErrorCode;
+			JumpsReady = true;
+			UJumps = i_UJumps;
+			Interactions.clear();
+			return KMCERR_OK;
+		}
+		i_UJumps.clear();
+		IDs = vector<vector<int>>(AtomCount, vector<int>());
+		mapping = vector<vector<vector<int>>>(AtomCount, vector<vector<int>>());
+	}
+
 	ErrorCode = jhelp.SetEnv(0, 0);							// ersten einzigartigen Sprung erstellen
 	if (ErrorCode != KMCERR_OK) return ErrorCode;
 	i_UJumps.push_back(jhelp);								// Sprung hinzufgen
@@ -244,6 +274,7 @@ int TUniqueJumpsBase::MakeUniqueJumps()
 		cout << "Critical Error: Unique jumps are not ready (in TUniqueJumpsBase::MakeUniqueJumps)" << endl << endl;
 		return KMCERR_MAKE_FAILED_DUE_TO_INCONSISTENCY;
 	}
+	if (t_CachePath != "") SaveUJumpsToCache(t_CachePath, cache_key, i_UJumps, IDs, mapping);		// Schluessel wurde vor SetUniqueJumps aus den unsortierten TJumps erstellt
 	UJumps = i_UJumps;
 	Interactions.clear();
 	return KMCERR_OK;
@@ -526,6 +557,8 @@ int TUniqueJumpsBase::ClearUniqueCodes()
 // Mgliche Umgebungsbesetzungen bestimmen und vergleichen
 int TUniqueJumpsBase::MakeUniqueCodes(int i_InteractionShellCount)
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "MakeUniqueCodes");
+
 	if (JumpsReady != true)
 	{
 		cout << "Critical Error: TUniqueJumps not ready (in TUniqueJumpsBase::MakeUniqueCodes)" << endl;
@@ -544,10 +577,11 @@ int TUniqueJumpsBase::MakeUniqueCodes(int i_InteractionShellCount)
 	// Wechselwirkungen aller additiven Atome mit der springenden Leerstelle in allen UJumps charakterisieren
 	vector<TUniqueJump> t_UJumps(UJumps);
 	vector<TInteraction> i_Interactions;
+	TInteractionCache i_InteractionCache;		// Suchindex fuer i_Interactions und Zwischenspeicher fuer Schalenanalysen
 	int ErrorCode = KMCERR_OK;
 	for (int i = 0; i < (int)t_UJumps.size(); i++)
 	{
-		ErrorCode = t_UJumps[i].CharacterizeInteractions(i, i_InteractionShellCount, &i_Interactions);		// Wechselwirkungen charakterisieren
+		ErrorCode = t_UJumps[i].CharacterizeInteractions(i, i_InteractionShellCount, &i_Interactions, &i_InteractionCache);		// Wechselwirkungen charakterisieren
 		if (ErrorCode != KMCERR_OK) return ErrorCode;
 	}
 
@@ -604,10 +638,16 @@ int TUniqueJumpsBase::MakeUniqueCodes(int i_InteractionShellCount)
 		}
 	}
 
-	// MakeUniqueCodes der UJumps aufrufen
+	// MakeUniqueCodes der UJumps aufrufen (mit Sprungmodell-Cache, falls gesetzt)
+	if (m_Job == 0)
+	{
+		cout << "Critical Error: m_Job is null pointer (in TUniqueJumpsBase::MakeUniqueCodes)" << endl << endl;
+		return KMCERR_INVALID_POINTER;
+	}
+	string t_CachePath = m_Job->GetModelCachePath();
 	for (int i = 0; i < (int)t_UJumps.size(); i++)
 	{
-		ErrorCode = t_UJumps[i].MakeUniqueCodes(i);
+		ErrorCode = t_UJumps[i].MakeUniqueCodes(i, t_CachePath);
 		if (ErrorCode != KMCERR_OK) return ErrorCode;
 	}
 
@@ -859,6 +899,8 @@ int TUniqueJumpsBase::SaveToStream(ostream& output, int offset)
 // Elemente aus einem Stream laden
 int TUniqueJumpsBase::LoadFromStream(istream& input)
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "LoadUniqueJumps");
+
 	if (JumpsReady != false)
 	{
 		cout << "Critical Error: TUniqueJumps->Jumps ready too early (in TUniqueJumpsBase::LoadFromStream)" << endl << endl;
@@ -916,6 +958,7 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 	vector<string> i_InteractionStream;
 
 	string line = "";
+	TLineTokenizer linestream;
 	bool if_failed = false;
 	string s_temp = "";
 	int i_temp = 0;
@@ -928,12 +971,12 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 			break;
 		}
 		// Zeile interpretieren
-		stringstream linestream(line);
-		if ((linestream >> s_temp).fail() == true) s_temp = "";
+		linestream.SetLine(line);
+		if (linestream.Next(s_temp) == false) s_temp = "";
 
 		if (s_temp == KMCOUT_TUNIQUEJUMPS_INTERACTIONSHELLCOUNT)
 		{
-			if ((linestream >> i_InteractionShellCount).fail() == true)
+			if (linestream.Next(i_InteractionShellCount) == false)
 			{
 				if_failed = true;
 				break;
@@ -941,7 +984,7 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMPS_CODESREADY)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -957,7 +1000,7 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMPS_UJUMPCOUNT)
 		{
-			if ((linestream >> i_UJumpCount).fail() == true)
+			if (linestream.Next(i_UJumpCount) == false)
 			{
 				if_failed = true;
 				break;
@@ -965,7 +1008,7 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMPS_INTERACTIONCOUNT)
 		{
-			if ((linestream >> i_InteractionCount).fail() == true)
+			if (linestream.Next(i_InteractionCount) == false)
 			{
 				if_failed = true;
 				break;
@@ -973,12 +1016,12 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMP_START1)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -994,7 +1037,8 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 				break;
 			}
 			s_temp = "";
-			stringstream temp_stream("");
+			string& temp_str = i_UJumpStream[i_temp];
+			temp_str.clear();
 			while (s_temp != KMCOUT_TUNIQUEJUMP_END)
 			{
 				if (getline(input, line).fail() == true)
@@ -1002,22 +1046,21 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 					if_failed = true;
 					break;
 				}
-				temp_stream << line << endl;
-				stringstream linestream2(line);
-				if ((linestream2 >> s_temp).fail() == true) s_temp = "";
+				temp_str.append(line).push_back('\n');
+				linestream.SetLine(line);
+				if (linestream.Next(s_temp) == false) s_temp = "";
 			}
 			if (if_failed == true) break;
-			i_UJumpStream[i_temp] = temp_stream.str();
 			i_UJumpChecked[i_temp] = true;
 		}
 		else if (s_temp == KMCOUT_TINTERACTION_START1)
 		{
-			if ((linestream >> s_temp).fail() == true)
+			if (linestream.Next(s_temp) == false)
 			{
 				if_failed = true;
 				break;
 			}
-			if ((linestream >> i_temp).fail() == true)
+			if (linestream.Next(i_temp) == false)
 			{
 				if_failed = true;
 				break;
@@ -1038,7 +1081,8 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 				break;
 			}
 			s_temp = "";
-			stringstream temp_stream("");
+			string& temp_str = i_InteractionStream[i_temp];
+			temp_str.clear();
 			while (s_temp != KMCOUT_TINTERACTION_END)
 			{
 				if (getline(input, line).fail() == true)
@@ -1046,12 +1090,11 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 					if_failed = true;
 					break;
 				}
-				temp_stream << line << endl;
-				stringstream linestream2(line);
-				if ((linestream2 >> s_temp).fail() == true) s_temp = "";
+				temp_str.append(line).push_back('\n');
+				linestream.SetLine(line);
+				if (linestream.Next(s_temp) == false) s_temp = "";
 			}
 			if (if_failed == true) break;
-			i_InteractionStream[i_temp] = temp_stream.str();
 			i_InteractionChecked[i_temp] = true;
 		}
 		else if (s_temp == KMCOUT_TUNIQUEJUMPS_END) break;
@@ -1099,10 +1142,11 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 		return ErrorCode;
 	}
 
-	// LoadJumpFromStream(Stream-Copy) fr alle UJumps aufrufen -> Umgebungen vergleichen und Aktivierungszustnde setzen
+	// LoadJumpFromStream(Abschnittspuffer) fr alle UJumps aufrufen -> Umgebungen vergleichen und Aktivierungszustnde setzen
 	for (int i = 0; i < (int)UJumps.size(); i++)
 	{
-		stringstream i_jumpstream(i_UJumpStream[i]);
+		TMemoryStreamBuf i_jumpbuf(i_UJumpStream[i]);
+		istream i_jumpstream(&i_jumpbuf);
 		ErrorCode = UJumps[i].LoadJumpFromStream(i_jumpstream, i);
 		if (ErrorCode != KMCERR_OK)
 		{
@@ -1125,7 +1169,8 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 	{
 		for (int i = 0; i < (int)UJumps.size(); i++)
 		{
-			stringstream i_jumpstream(i_UJumpStream[i]);
+			TMemoryStreamBuf i_jumpbuf(i_UJumpStream[i]);
+			istream i_jumpstream(&i_jumpbuf);
 			ErrorCode = UJumps[i].LoadCodesFromStream(i_jumpstream);
 			if (ErrorCode != KMCERR_OK)
 			{
@@ -1140,7 +1185,8 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 	{
 		for (int i = 0; i < (int)Interactions.size(); i++)
 		{
-			stringstream i_shellstream(i_InteractionStream[i]);
+			TMemoryStreamBuf i_shellbuf(i_InteractionStream[i]);
+			istream i_shellstream(&i_shellbuf);
 			ErrorCode = Interactions[i].LoadFromStream(i_shellstream);
 			if (ErrorCode != KMCERR_OK)
 			{
@@ -1169,4 +1215,155 @@ int TUniqueJumpsBase::LoadFromStream(istream& input)
 	return KMCERR_OK;
 }
 
-// ***************************** PRIVATE ********************************** //
\ No newline at end of file
+// ***************************** PRIVATE ********************************** //
+
+// Schluessel fuer den Sprungmodell-Cache aus Elementen, Struktur und TJumps (false = nicht moeglich)
+bool TUniqueJumpsBase::MakeUJumpCacheKey(unsigned long long& o_Key)
+{
+	if ((m_Job == 0) || (m_Job->m_Elements == 0) || (m_Job->m_Structure == 0) || (m_Job->m_Jumps == 0)) return false;
+
+	stringstream model_stream;
+	if (m_Job->m_Elements->SaveToStream(model_stream, 0) != KMCERR_OK) return false;
+	if (m_Job->m_Structure->SaveToStream(model_stream, 0) != KMCERR_OK) return false;
+	vector<int> jump_ints;
+	if (m_Job->m_Jumps->GetCacheData(&jump_ints) != KMCERR_OK) return false;
+
+	TModelCache cache_key(KMCPATH_UJUMPCACHE_MAGIC);
+	cache_key.AddString(model_stream.str());
+	cache_key.AddInt((long long)jump_ints.size());
+	cache_key.AddBytes(jump_ints.data(), sizeof(int) * jump_ints.size());
+	o_Key = cache_key.GetKey();
+	return true;
+}
+
+// Einzigartige Spruenge mit IDs und Mappings aus dem Cache laden (false = nicht vorhanden oder ungueltig)
+// Format: ints = UJump-Anzahl, je UJump: Atomanzahl und ElemIDs, dann je Gittersprung [i][j]: UniqueJumpID, Mapping-Laenge und Mapping;
+// doubles = je UJump: Sprunglaenge und Koordinaten (x,y,z)
+bool TUniqueJumpsBase::LoadUJumpsFromCache(const string& i_CachePath, unsigned long long i_Key, vector<int>& i_DirCount,
+	vector<TUniqueJump>& o_UJumps, vector<vector<int>>& o_IDs, vector<vector<vector<int>>>& o_Mappings)
+{
+	vector<int> t_Ints;
+	vector<double> t_Doubles;
+	if (TModelCache::Load(i_CachePath, KMCPATH_UJUMPCACHE_EXT, KMCPATH_UJUMPCACHE_MAGIC, i_Key, t_Ints, t_Doubles) == false) return false;
+
+	// Listen lesen (mit Bereichspruefung)
+	size_t ipos = 0;
+	size_t dpos = 0;
+	auto next_int = [&t_Ints, &ipos](int& val) -> bool
+	{
+		if (ipos >= t_Ints.size()) return false;
+		val = t_Ints[ipos];
+		ipos++;
+		return true;
+	};
+	auto next_double = [&t_Doubles, &dpos](double& val) -> bool
+	{
+		if (dpos >= t_Doubles.size()) return false;
+		val = t_Doubles[dpos];
+		dpos++;
+		return true;
+	};
+
+	// Einzigartige Spruenge
+	int ujump_count = 0;
+	if (next_int(ujump_count) == false) return false;
+	if ((ujump_count <= 0) || (ujump_count > (int)t_Ints.size())) return false;
+	vector<TUniqueJump> t_UJumps(ujump_count, TUniqueJump(m_Job));
+	vector<int> t_CoordCount(ujump_count, 0);
+	double t_Length = 0;
+	vector<T3DVector> t_Coord;
+	vector<int> t_ElemID;
+	for (int k = 0; k < ujump_count; k++)
+	{
+		if (next_int(t_CoordCount[k]) == false) return false;
+		if ((t_CoordCount[k] <= 0) || (t_CoordCount[k] > (int)(t_Ints.size() - ipos))) return false;
+		if (next_double(t_Length) == false) return false;
+		t_Coord.resize(t_CoordCount[k]);
+		t_ElemID.resize(t_CoordCount[k]);
+		for (int c = 0; c < t_CoordCount[k]; c++)
+		{
+			if (next_int(t_ElemID[c]) == false) return false;
+			if (next_double(t_Coord[c].x) == false) return false;
+			if (next_double(t_Coord[c].y) == false) return false;
+			if (next_double(t_Coord[c].z) == false) return false;
+		}
+		if (t_UJumps[k].SetSortedEnv(t_Length, &t_Coord, &t_ElemID) != KMCERR_OK) return false;
+	}
+
+	// UniqueJumpIDs und Mappings (unsortierte TJump-Umgebung -> sortierte UJump-Umgebung) der Gitterspruenge
+	vector<vector<int>> t_IDs(i_DirCount.size(), vector<int>());
+	vector<vector<vector<int>>> t_Mappings(i_DirCount.size(), vector<vector<int>>());
+	vector<T4DLatticeVector> t_Env;
+	vector<bool> t_Used;
+	int t_MapCount = 0;
+	for (int i = 0; i < (int)i_DirCount.size(); i++)
+	{
+		t_IDs[i] = vector<int>(i_DirCount[i], 0);
+		t_Mappings[i] = vector<vector<int>>(i_DirCount[i], vector<int>());
+		for (int j = 0; j < i_DirCount[i]; j++)
+		{
+			if (next_int(t_IDs[i][j]) == false) return false;
+			if ((t_IDs[i][j] < 0) || (t_IDs[i][j] >= ujump_count)) return false;
+			if (next_int(t_MapCount) == false) return false;
+			if (m_Job->m_Jumps->GetEnvPos(i, j, &t_Env) != KMCERR_OK) return false;
+			if ((t_MapCount != (int)t_Env.size()) || (t_MapCount != t_CoordCount[t_IDs[i][j]])) return false;
+			t_Mappings[i][j].resize(t_MapCount);
+			t_Used = vector<bool>(t_MapCount, false);
+			for (int c = 0; c < t_MapCount; c++)
+			{
+				if (next_int(t_Mappings[i][j][c]) == false) return false;
+				if ((t_Mappings[i][j][c] < 0) || (t_Mappings[i][j][c] >= t_MapCount)) return false;
+				if (t_Used[t_Mappings[i][j][c]] == true) return false;
+				t_Used[t_Mappings[i][j][c]] = true;
+			}
+		}
+	}
+	if ((ipos != t_Ints.size()) || (dpos != t_Doubles.size())) return false;
+
+	o_UJumps = t_UJumps;
+	o_IDs = t_IDs;
+	o_Mappings = t_Mappings;
+	return true;
+}
+
+// Einzigartige Spruenge mit IDs und Mappings in den Cache schreiben (Fehler werden ignoriert, Format siehe LoadUJumpsFromCache)
+void TUniqueJumpsBase::SaveUJumpsToCache(const string& i_CachePath, unsigned long long i_Key, vector<TUniqueJump>& i_UJumps,
+	vector<vector<int>>& i_IDs, vector<vector<vector<int>>>& i_Mappings)
+{
+	vector<int> t_Ints;
+	vector<double> t_Doubles;
+	double t_Length = 0;
+	vector<T3DVector> t_Coord;
+	vector<int> t_ElemID;
+
+	t_Ints.push_back((int)i_UJumps.size());
+	for (int k = 0; k < (int)i_UJumps.size(); k++)
+	{
+		if (i_UJumps[k].GetLength(t_Length) != KMCERR_OK) return;
+		if (i_UJumps[k].GetCoords(&t_Coord) != KMCERR_OK) return;
+		if (i_UJumps[k].GetElemIDs(&t_ElemID) != KMCERR_OK) return;
+		if (t_Coord.size() != t_ElemID.size()) return;
+		t_Ints.push_back((int)t_Coord.size());
+		t_Doubles.push_back(t_Length);
+		for (int c = 0; c < (int)t_Coord.size(); c++)
+		{
+			t_Ints.push_back(t_ElemID[c]);
+			t_Doubles.push_back(t_Coord[c].x);
+			t_Doubles.push_back(t_Coord[c].y);
+			t_Doubles.push_back(t_Coord[c].z);
+		}
+	}
+	if (i_IDs.size() != i_Mappings.size()) return;
+	for (int i = 0; i < (int)i_IDs.size(); i++)
+	{
+		if (i_IDs[i].size() != i_Mappings[i].size()) return;
+		for (int j = 0; j < (int)i_IDs[i].size(); j++)
+		{
+			t_Ints.push_back(i_IDs[i][j]);
+			t_Ints.push_back((int)i_Mappings[i][j].size());
+			t_Ints.insert(t_Ints.end(), i_Mappings[i][j].begin(), i_Mappings[i][j].end());
+		}
+	}
+
+	TModelCache::Save(i_CachePath, KMCPATH_UJUMPCACHE_EXT, KMCPATH_UJUMPCACHE_MAGIC, i_Key, t_Ints, t_Doubles);
+}
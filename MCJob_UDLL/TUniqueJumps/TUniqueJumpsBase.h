@@ -67,6 +67,12 @@ public:
 
 protected:
 	~TUniqueJumpsBase();					// Destructor
+
+	bool MakeUJumpCacheKey(unsigned long long& o_Key);		// Schluessel fuer den Sprungmodell-Cache aus Elementen, Struktur und TJumps (false = nicht moeglich)
+	bool LoadUJumpsFromCache(const string& i_CachePath, unsigned long long i_Key, vector<int>& i_DirCount,
+		vector<TUniqueJump>& o_UJumps, vector<vector<int>>& o_IDs, vector<vector<vector<int>>>& o_Mappings);		// Einzigartige Spruenge mit IDs und Mappings aus dem Cache laden (false = nicht vorhanden oder ungueltig)
+	void SaveUJumpsToCache(const string& i_CachePath, unsigned long long i_Key, vector<TUniqueJump>& i_UJumps,
+		vector<vector<int>>& i_IDs, vector<vector<vector<int>>>& i_Mappings);										// Einzigartige Spruenge mit IDs und Mappings in den Cache schreiben (Fehler werden ignoriert)
 };
 
 #endif
\ No newline at end of file
@@ -49,6 +49,8 @@ TUniqueJumpsFunc::~TUniqueJumpsFunc()
 // Minimalbeschreibung aller aktiven, einzigartigen Spruenge fuer die Simulation und Map: (alte UniqueID -> ID in Array) erstellen
 int TUniqueJumpsFunc::CreateSimUniqueJumps(TSimUniqueJump*& o_simuniquejumps, vector<int>* o_newuniqueidmap)
 {
+	TProfileScope ProfileScope((m_Job != NULL) ? &m_Job->m_Profile : NULL, "CreateSimUniqueJumps");
+
 	if (IfJumpsReady() != true) return KMCERR_READY_NOT_TRUE;
 	if (IfCodesReady() != true) return KMCERR_READY_NOT_TRUE;
 
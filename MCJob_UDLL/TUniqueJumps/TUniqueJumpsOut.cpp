@@ -17,6 +17,7 @@
 #include "TUniqueJumps/TUniqueJumpsOut.h"
 
 // Includes:
+#include <sstream>
 
 // Eigene Includes:
 #include "ErrorCodes.h"
@@ -365,8 +366,12 @@ int TUniqueJumpsOut::WriteUJumpToConsole(int JumpID)
 		return KMCERR_INVALID_INPUT_CRIT;
 	}
 
-	cout.precision(KMCOUT_TUNIQUEJUMP_COUT_PRECISION);
-	return UJumps[JumpID].SaveToStream(cout, JumpID, 0);
+	// Ausgabe ueber lokalen Stream, damit die Genauigkeit von cout unveraendert bleibt
+	stringstream t_stream;
+	t_stream.precision(KMCOUT_TUNIQUEJUMP_COUT_PRECISION);
+	int ErrorCode = UJumps[JumpID].SaveToStream(t_stream, JumpID, 0);
+	cout << t_stream.str();
+	return ErrorCode;
 }
 
 // Vollstndige Ausgabe einer Wechselwirkung
@@ -381,8 +386,11 @@ int TUniqueJumpsOut::WriteInteractionToConsole(int WWID)
 		return KMCERR_INVALID_INPUT_CRIT;
 	}
 
-	cout.precision(KMCOUT_TINTERACTION_COUT_PRECISION);
-	return Interactions[WWID].SaveToStream(cout, WWID, 0);
+	stringstream t_stream;
+	t_stream.precision(KMCOUT_TINTERACTION_COUT_PRECISION);
+	int ErrorCode = Interactions[WWID].SaveToStream(t_stream, WWID, 0);
+	cout << t_stream.str();
+	return ErrorCode;
 }
 
 // ***************************** PUBLIC *********************************** //
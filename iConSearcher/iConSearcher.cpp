@@ -16,11 +16,16 @@
 #include <string>
 #include <string_view>
 #include <fstream>
+#include <sstream>
 #include <vector>
 #include <filesystem>
+#include <atomic>
+#include <unordered_map>
 
 // Eigene Includes
 #include "TKMCJob/TKMCJob.h"
+#include "TParallel.h"
+#include "TThreadLogBuf.h"
 #include "GlobalDefinitions.h"
 #include "ErrorCodes.h"
 
@@ -37,6 +42,148 @@ void GetKMCFiles(const filesystem::path& dir, vector<string>& file_list)
 	}
 }
 
+// Zusammenfassung eines Jobs (Message != "" bedeutet, dass der Job nicht in die Zusammenfassung aufgenommen wird)
+struct TJobSummary
+{
+	string Message = "";
+	int DopingCount = -1;
+	string SummaryDesc = "";
+	string Summary = "";
+	string Log = "";				// Ausgaben beim Laden (werden in der Reihenfolge der Dateiliste ausgegeben)
+
+	string IndexKey = "";			// Pfad relativ zum Suchordner (Schluessel im Index)
+	long long FileSize = -1;		// Dateigroesse beim Laden (-1 = unbekannt)
+	long long FileTime = 0;		// Aenderungszeitpunkt beim Laden
+	bool FromIndex = false;		// true = Zusammenfassung aus dem Index uebernommen
+};
+
+// Dateigroesse und Aenderungszeitpunkt ermitteln (Size = -1, falls nicht verfuegbar)
+void GetFileStamp(const string& filepath, long long& o_Size, long long& o_Time)
+{
+	error_code ec;
+	o_Size = -1;
+	o_Time = 0;
+	uintmax_t size = filesystem::file_size(filepath, ec);
+	if (ec) return;
+	filesystem::file_time_type time = filesystem::last_write_time(filepath, ec);
+	if (ec) return;
+	o_Size = (long long)size;
+	o_Time = (long long)time.time_since_epoch().count();
+}
+
+// Index laden (fehlender oder ungueltiger Index wird als leer behandelt)
+// Format: Kopfzeile mit Version, dann je Job: "<Job> Pfad", "Groesse Zeit Dotierungsanzahl", Kopfzeile, Zusammenfassung
+void LoadSummaryIndex(const filesystem::path& indexpath, unordered_map<string, TJobSummary>& o_Index)
+{
+	o_Index.clear();
+	ifstream indexfile(indexpath);
+	if (indexfile.is_open() == false) return;
+
+	string line = "";
+	if ((getline(indexfile, line).fail() == true) || (line != std::string(KMCOUT_SUMMARYINDEX_HEADER) + " " + std::string(KMC_VERSION))) return;
+	string tag = std::string(KMCOUT_SUMMARYINDEX_JOB) + " ";
+	while (getline(indexfile, line))
+	{
+		if (line.compare(0, tag.size(), tag) != 0) break;
+		TJobSummary job;
+		job.IndexKey = line.substr(tag.size());
+		job.FromIndex = true;
+		if (getline(indexfile, line).fail() == true) break;
+		stringstream linestream(line);
+		if ((linestream >> job.FileSize >> job.FileTime >> job.DopingCount).fail() == true) break;
+		if (getline(indexfile, job.SummaryDesc).fail() == true) break;
+		if (getline(indexfile, job.Summary).fail() == true) break;
+		o_Index[job.IndexKey] = job;
+	}
+}
+
+// Index schreiben (nur vollstaendige Jobs, temporaere Datei wird anschliessend umbenannt)
+bool SaveSummaryIndex(const filesystem::path& indexpath, const vector<TJobSummary>& i_Jobs)
+{
+	filesystem::path temppath = indexpath;
+	temppath += ".tmp";
+	{
+		ofstream indexfile(temppath);
+		if (indexfile.is_open() == false) return false;
+		indexfile << KMCOUT_SUMMARYINDEX_HEADER << " " << KMC_VERSION << '\n';
+		for (const TJobSummary& job : i_Jobs)
+		{
+			if ((job.Message != "") || (job.FileSize < 0)) continue;
+			indexfile << KMCOUT_SUMMARYINDEX_JOB << " " << job.IndexKey << '\n';
+			indexfile << job.FileSize << " " << job.FileTime << " " << job.DopingCount << '\n';
+			indexfile << job.SummaryDesc << '\n';
+			indexfile << job.Summary << '\n';
+		}
+		indexfile.close();
+		if (indexfile.fail() == true) return false;
+	}
+	error_code ec;
+	filesystem::rename(temppath, indexpath, ec);
+	if (ec)
+	{
+		filesystem::remove(temppath, ec);
+		return false;
+	}
+	return true;
+}
+
+// Job laden (nur die fuer die Zusammenfassung noetigen Abschnitte) und Zusammenfassung ermitteln
+void GetJobSummary(TKMCJob& KMCJob, const string& filepath, TJobSummary& o_Job)
+{
+	// Job-Datei laden
+	bool completed = false;
+	int ErrorCode = KMCJob.LoadSummaryFromFile(filepath, completed);
+	if (ErrorCode != KMCERR_OK)
+	{
+		o_Job.Message = "Invalid job file (" + to_string(ErrorCode) + ")";
+		return;
+	}
+
+	// Status pruefen (Projektstatus nur fuer unvollstaendige Jobs durch vollstaendiges Laden ermitteln)
+	if (completed == false)
+	{
+		int job_status = 0;
+		ErrorCode = KMCJob.LoadFromFile(filepath);
+		if (ErrorCode != KMCERR_OK)
+		{
+			o_Job.Message = "Invalid job file (" + to_string(ErrorCode) + ")";
+			return;
+		}
+		ErrorCode = KMCJob.GetProjectState(job_status);
+		if (ErrorCode != KMCERR_OK)
+		{
+			o_Job.Message = "Invalid job status (" + to_string(ErrorCode) + ")";
+			return;
+		}
+		o_Job.Message = "Simulation incomplete (" + to_string(job_status) + ")";
+		return;
+	}
+
+	// Anzahl an Dotierungen ermitteln
+	ErrorCode = KMCJob.GetDopingCount(o_Job.DopingCount);
+	if (ErrorCode != KMCERR_OK)
+	{
+		o_Job.Message = "Invalid doping (" + to_string(ErrorCode) + ")";
+		return;
+	}
+
+	// Kopfzeile ermitteln
+	ErrorCode = KMCJob.GetResultSummaryDesc(" ; ", o_Job.SummaryDesc);
+	if (ErrorCode != KMCERR_OK)
+	{
+		o_Job.Message = "Invalid summary description (" + to_string(ErrorCode) + ")";
+		return;
+	}
+
+	// Zusammenfassung ermitteln
+	ErrorCode = KMCJob.GetResultSummary(" ; ", o_Job.Summary);
+	if (ErrorCode != KMCERR_OK)
+	{
+		o_Job.Message = "Invalid summary (" + to_string(ErrorCode) + ")";
+		return;
+	}
+}
+
 int main(int argc, char* argv[])
 {
 	// Default ist das aktuelle Arbeitsverzeichnis
@@ -65,6 +212,8 @@ int main(int argc, char* argv[])
 			cout << "-version: Show plain version number." << endl;
 			cout << "<directory path>: Path of the directory whose *.kmc files should be collected." << endl;
 			cout << "If no directory is specified, then it defaults to the current working directory." << endl;
+			cout << "Results of unchanged *.kmc files are taken from the index file (" << KMCPATH_DEFAULT_SUMMARYINDEX << ") next to the summary file." << endl;
+			cout << "Delete the index file to force the reloading of all *.kmc files." << endl;
 			return 0;
 		}
 		if (CmdArg == "-version")
@@ -149,11 +298,69 @@ int main(int argc, char* argv[])
 	cout << "OK" << endl;
 	cout << "Number of *.kmc files: " << FileList.size() << endl;
 
-	int ErrorCode = KMCERR_OK;
+	// Index laden und unveraenderte Jobs (gleicher Pfad, gleiche Groesse, gleicher Aenderungszeitpunkt) uebernehmen
+	// (Eintraege geloeschter oder verschobener Dateien werden beim Schreiben des Index verworfen)
+	filesystem::path IndexPath = RootDir / KMCPATH_DEFAULT_SUMMARYINDEX;
+	unordered_map<string, TJobSummary> Index;
+	try
+	{
+		LoadSummaryIndex(IndexPath, Index);
+	}
+	catch (const exception&)
+	{
+		Index.clear();
+	}
+	vector<TJobSummary> Summaries(FileList.size());
+	vector<int> LoadList;
+	for (int i = 0; i < (int)FileList.size(); i++)
+	{
+		Summaries[i].IndexKey = filesystem::path(FileList[i]).lexically_relative(RootDir).generic_string();
+		GetFileStamp(FileList[i], Summaries[i].FileSize, Summaries[i].FileTime);
+		auto it = Index.find(Summaries[i].IndexKey);
+		if ((Summaries[i].FileSize >= 0) && (it != Index.end()) &&
+			(it->second.FileSize == Summaries[i].FileSize) && (it->second.FileTime == Summaries[i].FileTime))
+		{
+			Summaries[i] = it->second;
+		}
+		else
+		{
+			LoadList.push_back(i);
+		}
+	}
+	cout << "Number of unchanged files in index: " << FileList.size() - LoadList.size() << endl;
 
-	// KMC-Job Objekt erstellen
-	TKMCJob KMCJob;
-	if (KMCJob.IfReady() == false)
+	// Neue und geaenderte Jobs parallel laden (je Thread ein KMC-Job Objekt, Dateien ueber gemeinsamen Zaehler verteilt)
+	// und Zusammenfassungen in der Reihenfolge der Dateiliste sammeln (Ausgaben beim Laden je Datei puffern)
+	int ThreadCount = TParallel::GetThreadCount();
+	if (ThreadCount > (int)LoadList.size()) ThreadCount = (int)LoadList.size();
+	atomic<int> next_file(0);
+	atomic<bool> job_creation_failed(false);
+	cout << "Loading " << LoadList.size() << " files (" << ThreadCount << " threads) ... " << endl;
+	{
+		TThreadLogBuf CoutRedirect(cout);
+		TParallel::For(ThreadCount, [&](int)
+			{
+				TKMCJob KMCJob;
+				if (KMCJob.IfReady() == false)
+				{
+					job_creation_failed = true;
+					return KMCERR_OK;
+				}
+				int i = 0;
+				while ((i = next_file.fetch_add(1)) < (int)LoadList.size())
+				{
+					TJobSummary& job = Summaries[LoadList[i]];
+					ostringstream loadlog;
+					TThreadLogBuf::SetThreadTarget(loadlog.rdbuf());
+					GetJobSummary(KMCJob, FileList[LoadList[i]], job);
+					cout.flush();
+					TThreadLogBuf::SetThreadTarget(NULL);
+					job.Log = loadlog.str();
+				}
+				return KMCERR_OK;
+			}, ThreadCount);
+	}
+	if (job_creation_failed == true)
 	{
 		cout << "Critical Error: Job object creation failed." << endl;
 		cout << "Contact the developers!" << endl;
@@ -188,56 +395,25 @@ int main(int argc, char* argv[])
 		return 1;
 	}
 
-	// Dateien laden und Ergebnisse speichern
+	// Ergebnisse speichern
 	int doping_count = -1;
-	cout << "Loading files ... " << endl;
-	for (const string& filepath : FileList)
+	for (int i = 0; i < (int)FileList.size(); i++)
 	{
-		// Job-Datei laden
-		ErrorCode = KMCJob.LoadFromFile(filepath);
-		if (ErrorCode != KMCERR_OK)
-		{
-			cout << "Invalid job file (" << ErrorCode << "): " << filepath << endl;
-			continue;
-		}
-
-		// Status pruefen
-		int job_status = 0;
-		ErrorCode = KMCJob.GetProjectState(job_status);
-		if (ErrorCode != KMCERR_OK)
-		{
-			cout << "Invalid job status (" << ErrorCode << "): " << filepath << endl;
-			continue;
-		}
-		if (job_status < 9)
+		const string& filepath = FileList[i];
+		const TJobSummary& job = Summaries[i];
+		if (job.Log != "") cout << job.Log;
+		if (job.Message != "")
 		{
-			cout << "Simulation incomplete (" << job_status << "): " << filepath << endl;
+			cout << job.Message << ": " << filepath << endl;
 			continue;
 		}
 
-		// Anzahl an Dotierungen pruefen
-		int t_dop_count = -1;
-		ErrorCode = KMCJob.GetDopingCount(t_dop_count);
-		if (ErrorCode != KMCERR_OK)
-		{
-			cout << "Invalid doping (" << ErrorCode << "): " << filepath << endl;
-			continue;
-		}
 		if (doping_count == -1)		// d.h. noch kein Job geschrieben
 		{
-			// Kopfzeile ermitteln
-			string t_summarydesc = "";
-			ErrorCode = KMCJob.GetResultSummaryDesc(" ; ", t_summarydesc);
-			if (ErrorCode != KMCERR_OK)
-			{
-				cout << "Invalid summary description (" << ErrorCode << "): " << filepath << endl;
-				continue;
-			}
-
 			// Kopfzeile in Datei schreiben
 			try
 			{
-				summaryfile << t_summarydesc << endl;
+				summaryfile << job.SummaryDesc << '\n';
 			}
 			catch (const exception& e)
 			{
@@ -250,31 +426,22 @@ int main(int argc, char* argv[])
 			}
 
 			// Dotierungsanzahl setzen
-			doping_count = t_dop_count;
+			doping_count = job.DopingCount;
 		}
 		else
 		{
 			// Dotierungsanzahl pruefen
-			if (t_dop_count != doping_count)
+			if (job.DopingCount != doping_count)
 			{
 				cout << "Inconsistent: " << filepath << endl;
 				continue;
 			}
 		}
 
-		// Zusammenfassung ermitteln
-		string t_summary = "";
-		ErrorCode = KMCJob.GetResultSummary(" ; ", t_summary);
-		if (ErrorCode != KMCERR_OK)
-		{
-			cout << "Invalid summary (" << ErrorCode << "): " << filepath << endl;
-			continue;
-		}
-
 		// Zusammenfassung in Datei schreiben
 		try
 		{
-			summaryfile << t_summary << endl;
+			summaryfile << job.Summary << '\n';
 		}
 		catch (const exception& e)
 		{
@@ -291,6 +458,18 @@ int main(int argc, char* argv[])
 
 	// Datei schlieen
 	summaryfile.close();
+
+	// Index aktualisieren (Fehler betreffen nur die Laufzeit des naechsten Aufrufs)
+	bool index_saved = false;
+	try
+	{
+		index_saved = SaveSummaryIndex(IndexPath, Summaries);
+	}
+	catch (const exception&)
+	{
+		index_saved = false;
+	}
+	if (index_saved == false) cout << "Warning: Failed to update the summary index (" << IndexPath.string() << ")." << endl;
 	cout << endl;
 	cout << "All files processed." << endl;
 	cout << "Program completed." << endl;
@@ -15,45 +15,88 @@
 #include <iostream>
 #include <string>
 #include <string_view>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <filesystem>
+#include <atomic>
+#include <algorithm>
+#include <unordered_set>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
 
 // Eigene Includes
 #include "TKMCJob/TKMCJob.h"
 #include "TCustomTime.h"
+#include "TParallel.h"
+#include "TThreadLogBuf.h"
+#include "TSimulation/TSimTelemetry.h"
 #include "GlobalDefinitions.h"
 #include "ErrorCodes.h"
 
 using namespace std;
 
-int main(int argc, char* argv[])
+// Endstatus eines Jobs
+enum class TJobStatus
 {
+	Completed,		// Simulation abgeschlossen (oder bereits vorher abgeschlossen)
+	Resumable,		// Simulation unvollstaendig, kann mit erneutem Aufruf fortgesetzt werden (Checkpoint vorhanden oder DynNorm-Eintrag fehlt)
+	Failed			// Simulation fehlgeschlagen
+};
 
-	// Kommandozeilenargumente verarbeiten (argv[0] = Programmpfad, argv[1] = Argument)
-	if (argc != 2)
-	{
-		cout << "Error: Invalid number of command line arguments. Use -help or -h for further information." << endl;
-		return 1;
-	}
-	string_view CmdArg = Trim(argv[1]);
-	if ((CmdArg == "-help") || (CmdArg == "-h"))
-	{
-		cout << "iCon - Kinetic Monte-Carlo Simulation of Ionic Conductivity" << endl;
-		cout << "Copyright 2016-2025, P. Hein, Workgroup Martin, IPC, RWTH Aachen" << endl;
-		cout << "Distributed under GPL v3 license. Publication of results requires proper attribution." << endl;
-		cout << KMCOUT_VERSION << " " << KMC_VERSION << endl;
-		cout << endl;
-		cout << "Available command line arguments:" << endl;
-		cout << "-help / -h: Show this help text." << endl;
-		cout << "-version: Show plain version number." << endl;
-		cout << "<file path>: Path of the job file (*.kmc) that should be processed." << endl;
-		return 0;
-	}
-	if (CmdArg == "-version")
+// Ergebnis eines Jobs im Batch-Modus
+struct TBatchJob
+{
+	string JobPath = "";
+	TJobStatus Status = TJobStatus::Failed;
+	string Message = "";
+	TCustomTime Runtime;
+};
+
+// Dateiendung eines Pfades ersetzen (bzw. anhaengen, falls keine vorhanden)
+string ReplaceExtension(const string& path, string_view ext)
+{
+	string newpath = path;
+	string::size_type ext_pos = newpath.rfind('.', newpath.length());
+	if (ext_pos != string::npos)
 	{
-		cout << KMC_VERSION << endl;
-		return 0;
+		newpath.erase(ext_pos);
 	}
-	string JobPath = std::string(CmdArg);
+	newpath += ext;
+	return newpath;
+}
+
+// Einen Job laden, simulieren und speichern (Rueckgabe = Exitcode, alle Ausgaben nach cout)
+int RunJob(const string& JobPath, const string& CachePath, TJobStatus& o_Status, string& o_Message)
+{
 	int ErrorCode = KMCERR_OK;
+	o_Status = TJobStatus::Failed;
+	o_Message = "";
+
+	// Checkpoint-Dateipfad erstellen
+	string ChkPath = ReplaceExtension(JobPath, KMCPATH_CHK_EXT);
+
+	// Status bei Abbruch: fortsetzbar, falls bereits ein Checkpoint existiert (Zeitprofil bis zum Abbruch ausgeben)
+	TKMCJob* ProfiledJob = NULL;
+	auto Terminated = [&](const string& message)
+	{
+		if (ProfiledJob != NULL)
+		{
+			ProfiledJob->WriteProfileToConsole();
+			cout << endl;
+		}
+		error_code ec;
+		o_Status = (filesystem::exists(ChkPath, ec) == true) ? TJobStatus::Resumable : TJobStatus::Failed;
+		o_Message = message;
+		cout << "Program terminated." << endl;
+		return 1;
+	};
 
 	// Log-File-Header ausgeben
 	cout << "SIMULATION LOG" << endl;
@@ -72,8 +115,19 @@ int main(int argc, char* argv[])
 		cout << "Critical Error: Job object creation failed." << endl;
 		cout << "Contact the developers!" << endl;
 		cout << endl;
-		cout << "Program terminated." << endl;
-		return 1;
+		return Terminated("Job object creation failed");
+	}
+	ProfiledJob = &KMCJob;
+
+	// Sprungmodell-Cache setzen (wird bereits beim Laden verwendet)
+	if (CachePath != "")
+	{
+		ErrorCode = KMCJob.SetModelCachePath(CachePath);
+		if (ErrorCode != KMCERR_OK)
+		{
+			return Terminated("Invalid cache directory (" + to_string(ErrorCode) + ")");
+		}
+		cout << "Jump model cache: " << CachePath << endl;
 	}
 
 	// Datei laden
@@ -81,8 +135,7 @@ int main(int argc, char* argv[])
 	ErrorCode = KMCJob.LoadFromFile(JobPath);
 	if (ErrorCode != KMCERR_OK)
 	{
-		cout << "Program terminated." << endl;
-		return 1;
+		return Terminated("Loading failed (" + to_string(ErrorCode) + ")");
 	}
 	cout << "Done." << endl << endl;
 
@@ -92,21 +145,21 @@ int main(int argc, char* argv[])
 	ErrorCode = KMCJob.GetProjectState(JobStatus);
 	if (ErrorCode != KMCERR_OK)
 	{
-		cout << "Program terminated." << endl;
-		return 1;
+		return Terminated("Invalid job status (" + to_string(ErrorCode) + ")");
 	}
 	if (JobStatus < 6)
 	{
 		cout << "Error: The job configuration in the input file is incomplete." << endl;
 		cout << "Cannot start simulation due to missing settings." << endl;
 		cout << endl;
-		cout << "Program terminated." << endl;
-		return 1;
+		return Terminated("Incomplete job configuration");
 	}
 	if (JobStatus >= 9)
 	{
 		cout << "The simulation is already complete." << endl;
 		cout << "Program terminated." << endl;
+		o_Status = TJobStatus::Completed;
+		o_Message = "Already complete";
 		return 1;
 	}
 	cout << "Done." << endl;
@@ -115,52 +168,548 @@ int main(int argc, char* argv[])
 	ErrorCode = KMCJob.ClearSimulation();
 	if (ErrorCode != KMCERR_OK)
 	{
-		cout << "Program terminated." << endl;
-		return 1;
+		return Terminated("Simulation reset failed (" + to_string(ErrorCode) + ")");
 	}
 	ErrorCode = KMCJob.InitializeSimulation();
 	if (ErrorCode != KMCERR_OK)
 	{
+		return Terminated("Simulation initialization failed (" + to_string(ErrorCode) + ")");
+	}
+	cout << endl;
+
+	// Checkpoint-Pfad setzen und Checkpoint laden
+	ErrorCode = KMCJob.SetCheckPointPath(ChkPath);
+	if (ErrorCode != KMCERR_OK)
+	{
+		return Terminated("Invalid checkpoint path (" + to_string(ErrorCode) + ")");
+	}
+	ErrorCode = KMCJob.LoadCheckPoint();
+	if (ErrorCode != KMCERR_OK)
+	{
+		return Terminated("Loading checkpoint failed (" + to_string(ErrorCode) + ")");
+	}
+
+	// Simulation durchfuehren
+	bool DynNormEntryMissing = false;
+	ErrorCode = KMCJob.MakeSimulation();
+	if (ErrorCode != KMCERR_OK)
+	{
+		if (ErrorCode == KMCERR_HAS_TO_SET_DYNNORM_ENTRY)
+		{
+			DynNormEntryMissing = true;
+		}
+		else
+		{
+			return Terminated("Simulation failed (" + to_string(ErrorCode) + ")");
+		}
+	}
+	cout << endl;
+
+	// Datei speichern
+	cout << "Saving job file ..." << endl;
+	ErrorCode = KMCJob.SaveToFile(JobPath);
+	if (ErrorCode != KMCERR_OK)
+	{
+		return Terminated("Saving failed (" + to_string(ErrorCode) + ")");
+	}
+	cout << "Done." << endl << endl;
+
+	// Zeitprofil ausgeben
+	KMCJob.WriteProfileToConsole();
+	cout << endl;
+
+	cout << "End-Time: ";
+	TCustomTime EndTime = TCustomTime::GetCurrentTime(true);
+	cout << endl;
+	TCustomTime TotalRuntime = EndTime - StartTime;
+	cout << "Total runtime: " << TotalRuntime.ToString() << endl;
+	cout << "Job completed successfully." << endl << endl;
+
+	if (DynNormEntryMissing == true)
+	{
+		o_Status = TJobStatus::Resumable;
+		o_Message = "DynNorm list entry has to be set";
+	}
+	else
+	{
+		o_Status = TJobStatus::Completed;
+	}
+	return 0;
+}
+
+// Job-Dateien des Batch-Modus ermitteln (Verzeichnis: alle *.kmc-Dateien incl. Unterverzeichnisse,
+// sonst Listendatei: ein Pfad je Zeile, relativ zur Listendatei, leere Zeilen und Zeilen mit # am Anfang werden ignoriert)
+bool GetBatchJobs(const filesystem::path& batchpath, vector<string>& o_JobPaths)
+{
+	vector<filesystem::path> candidates;
+	if (filesystem::is_directory(batchpath) == true)
+	{
+		for (const auto& file : filesystem::recursive_directory_iterator(batchpath))
+		{
+			if ((filesystem::is_regular_file(file)) && (file.path().extension() == ".kmc"))
+			{
+				candidates.push_back(file.path());
+			}
+		}
+		sort(candidates.begin(), candidates.end());
+	}
+	else
+	{
+		ifstream listfile(batchpath);
+		if (listfile.is_open() == false) return false;
+		string line = "";
+		while (getline(listfile, line))
+		{
+			string_view entry = Trim(line);
+			if ((entry.empty() == true) || (entry[0] == '#')) continue;
+			filesystem::path jobpath = filesystem::path(std::string(entry));
+			if (jobpath.is_relative() == true) jobpath = batchpath.parent_path() / jobpath;
+			candidates.push_back(jobpath);
+		}
+	}
+
+	// Doppelte Eintraege entfernen (ein Job darf nicht von zwei Threads gleichzeitig bearbeitet werden)
+	unordered_set<string> known;
+	for (const auto& jobpath : candidates)
+	{
+		if (known.insert(filesystem::weakly_canonical(jobpath).string()).second == true)
+		{
+			o_JobPaths.push_back(jobpath.string());
+		}
+	}
+	return true;
+}
+
+// Statustabelle des Batch- bzw. Sweep-Modus ausgeben (Rueckgabe = Exitcode)
+int WriteBatchSummary(string_view Title, const vector<TBatchJob>& Jobs)
+{
+	int CompletedCount = 0;
+	int ResumableCount = 0;
+	int FailedCount = 0;
+	cout << endl;
+	cout << Title << " summary:" << endl;
+	for (const auto& Job : Jobs)
+	{
+		cout << "  ";
+		switch (Job.Status)
+		{
+		case TJobStatus::Completed:
+			cout << "Completed ";
+			CompletedCount++;
+			break;
+		case TJobStatus::Resumable:
+			cout << "Resumable ";
+			ResumableCount++;
+			break;
+		default:
+			cout << "Failed    ";
+			FailedCount++;
+			break;
+		}
+		cout << Job.JobPath << " (runtime: " << Job.Runtime.ToString();
+		if (Job.Message != "") cout << ", " << Job.Message;
+		cout << ")" << endl;
+	}
+	cout << "Completed: " << CompletedCount << ", resumable: " << ResumableCount << ", failed: " << FailedCount << endl;
+	cout << endl;
+
+	return ((ResumableCount == 0) && (FailedCount == 0)) ? 0 : 1;
+}
+
+// Mehrere Jobs gleichzeitig simulieren (je Thread ein KMC-Job Objekt, Ausgaben je Job in eine eigene Log-Datei)
+int RunBatch(const filesystem::path& BatchPath, int ThreadCount, const string& CachePath)
+{
+	cout << "BATCH LOG" << endl;
+	cout << "iCon - Kinetic Monte-Carlo Simulation of Ionic Conductivity" << endl;
+	cout << "Copyright 2016-2025, P. Hein, Workgroup Martin, IPC, RWTH Aachen" << endl;
+	cout << "Distributed under GPL v3 license. Publication of results requires proper attribution." << endl;
+	cout << KMCOUT_VERSION << " " << KMC_VERSION << endl;
+	cout << "Start-Time: ";
+	TCustomTime StartTime = TCustomTime::GetCurrentTime(true);
+	cout << endl << endl;
+
+	// Job-Liste erstellen
+	vector<string> JobPaths;
+	try
+	{
+		if (filesystem::exists(BatchPath) == false)
+		{
+			cout << "Error: Specified job list or directory does not exist (" << BatchPath << ")." << endl;
+			cout << endl;
+			cout << "Program terminated." << endl;
+			return 1;
+		}
+		if (GetBatchJobs(BatchPath, JobPaths) == false)
+		{
+			cout << "Error: Cannot read job list (" << BatchPath << ")." << endl;
+			cout << endl;
+			cout << "Program terminated." << endl;
+			return 1;
+		}
+	}
+	catch (const exception& e)
+	{
+		cout << "Critical Error: Exception during job search:" << endl;
+		cout << e.what() << endl;
+		cout << endl;
 		cout << "Program terminated." << endl;
 		return 1;
 	}
+	if (JobPaths.size() == 0)
+	{
+		cout << "No *.kmc files found." << endl;
+		cout << endl;
+		cout << "Program completed." << endl;
+		return 0;
+	}
+
+	// Threadanzahl festlegen (Parallelisierung innerhalb der Jobs auf die verbleibenden Hardware-Threads begrenzen)
+	int HardwareThreads = TParallel::GetThreadCount();
+	if (ThreadCount <= 0) ThreadCount = HardwareThreads;
+	if (ThreadCount > (int)JobPaths.size()) ThreadCount = (int)JobPaths.size();
+	TParallel::SetMaxThreadCount(max(1, HardwareThreads / ThreadCount));
+	cout << "Number of jobs: " << JobPaths.size() << endl;
+	cout << "Number of threads: " << ThreadCount << endl;
+	if (CachePath != "") cout << "Jump model cache: " << CachePath << endl;
 	cout << endl;
 
+	// Jobs ueber gemeinsamen Zaehler auf die Threads verteilen
+	vector<TBatchJob> Jobs(JobPaths.size());
+	atomic<int> next_job(0);
+	{
+		TThreadLogBuf CoutRedirect(cout);
+		TParallel::For(ThreadCount, [&](int)
+			{
+				int i = 0;
+				while ((i = next_job.fetch_add(1)) < (int)Jobs.size())
+				{
+					TBatchJob& Job = Jobs[i];
+					Job.JobPath = JobPaths[i];
+					string LogPath = ReplaceExtension(Job.JobPath, KMCPATH_LOG_EXT);
+
+					ostringstream startline;
+					startline << "Started  [" << i + 1 << "/" << Jobs.size() << "]: " << Job.JobPath << endl;
+					cout << startline.str() << flush;
+
+					TCustomTime JobStart = TCustomTime::GetCurrentTime(false);
+					ofstream logfile(LogPath, ios::app);
+					if (logfile.is_open() == false)
+					{
+						Job.Status = TJobStatus::Failed;
+						Job.Message = "Cannot open log file " + LogPath;
+					}
+					else
+					{
+						TThreadLogBuf::SetThreadTarget(logfile.rdbuf());
+						RunJob(Job.JobPath, CachePath, Job.Status, Job.Message);
+						cout.flush();
+						TThreadLogBuf::SetThreadTarget(NULL);
+					}
+					Job.Runtime = TCustomTime::GetCurrentTime(false) - JobStart;
+
+					ostringstream endline;
+					endline << "Finished [" << i + 1 << "/" << Jobs.size() << "]: " << Job.JobPath << " -> ";
+					endline << ((Job.Status == TJobStatus::Completed) ? "completed" : ((Job.Status == TJobStatus::Resumable) ? "resumable" : "failed"));
+					if (Job.Message != "") endline << " (" << Job.Message << ")";
+					endline << endl;
+					cout << endline.str() << flush;
+				}
+				return KMCERR_OK;
+			}, ThreadCount);
+	}
+	TParallel::SetMaxThreadCount(0);
+
+	// Statustabelle ausgeben
+	int ExitCode = WriteBatchSummary("Batch", Jobs);
+
+	cout << "End-Time: ";
+	TCustomTime EndTime = TCustomTime::GetCurrentTime(true);
+	cout << endl;
+	TCustomTime TotalRuntime = EndTime - StartTime;
+	cout << "Total runtime: " << TotalRuntime.ToString() << endl;
+
+	return ExitCode;
+}
+
+// Achse einer Parameterstudie (Schluesselwort in der Sweep-Datei und zugehoerige Werte)
+struct TSweepAxis
+{
+	string Name = "";				// Temperature, EField, Doping, CodeEnergy oder InteractionEnergy
+	int ID1 = -1;					// Doping: DopingID, CodeEnergy: JumpID, InteractionEnergy: WWID
+	int ID2 = -1;					// CodeEnergy: CodeID, InteractionEnergy: (Elem)ID
+	vector<double> Values;			// Werte der Achse
+};
+
+// Definition einer Parameterstudie
+struct TSweepDefinition
+{
+	string BaseJobPath = "";		// Basis-Job (vollstaendig konfiguriert)
+	string OutputPrefix = "";		// Pfadpraefix der Ausgabe-Jobs (<Praefix>_<Punktindex>.kmc)
+	vector<TSweepAxis> Axes;		// Achsen, Punkte = kartesisches Produkt aller Achsen (letzte Achse laeuft am schnellsten)
+	bool SharedLattice = false;		// Flag: true = alle Punkte verwenden dasselbe zufaellige Startgitter (korrelierte Stichproben, z.B. fuer Arrhenius-Auftragungen)
+};
+
+// Sweep-Datei einlesen (ein Schluesselwort je Zeile, leere Zeilen und Zeilen mit # am Anfang werden ignoriert):
+// BaseJob: <Pfad>, Output: <Pfadpraefix>, SharedLattice: yes/no, Temperature: <Werte>, EField: <Werte>, Doping: <DopingID> <Werte>,
+// CodeEnergy: <JumpID> <CodeID> <Werte>, InteractionEnergy: <WWID> <ID> <Werte> (relative Pfade bzgl. der Sweep-Datei)
+bool ReadSweepDefinition(const filesystem::path& sweeppath, TSweepDefinition& o_Sweep, string& o_Message)
+{
+	ifstream sweepfile(sweeppath);
+	if (sweepfile.is_open() == false)
+	{
+		o_Message = "Cannot read sweep file";
+		return false;
+	}
+
+	string line = "";
+	int line_number = 0;
+	while (getline(sweepfile, line))
+	{
+		line_number++;
+		string_view entry = Trim(line);
+		if ((entry.empty() == true) || (entry[0] == '#')) continue;
+		stringstream linestream{ std::string(entry) };
+		string key = "";
+		linestream >> key;
+
+		if ((key == "BaseJob:") || (key == "Output:"))
+		{
+			string s_path = "";
+			getline(linestream, s_path);
+			filesystem::path path = filesystem::path(std::string(Trim(s_path)));
+			if (path.empty() == true)
+			{
+				o_Message = "Missing path in line " + to_string(line_number);
+				return false;
+			}
+			if (path.is_relative() == true) path = sweeppath.parent_path() / path;
+			if (key == "BaseJob:") o_Sweep.BaseJobPath = path.string();
+			else o_Sweep.OutputPrefix = path.string();
+			continue;
+		}
+
+		if (key == "SharedLattice:")
+		{
+			string s_flag = "";
+			linestream >> s_flag;
+			if ((s_flag != "yes") && (s_flag != "no"))
+			{
+				o_Message = "Invalid SharedLattice flag in line " + to_string(line_number) + " (yes or no expected)";
+				return false;
+			}
+			o_Sweep.SharedLattice = (s_flag == "yes");
+			continue;
+		}
+
+		TSweepAxis axis;
+		int id_count = 0;
+		if ((key == "Temperature:") || (key == "EField:")) id_count = 0;
+		else if (key == "Doping:") id_count = 1;
+		else if ((key == "CodeEnergy:") || (key == "InteractionEnergy:")) id_count = 2;
+		else
+		{
+			o_Message = "Unknown keyword in line " + to_string(line_number) + " (" + key + ")";
+			return false;
+		}
+		axis.Name = key.substr(0, key.length() - 1);
+		if (id_count >= 1) linestream >> axis.ID1;
+		if (id_count >= 2) linestream >> axis.ID2;
+		if ((linestream.fail() == true) || ((id_count >= 1) && (axis.ID1 < 0)) || ((id_count >= 2) && (axis.ID2 < 0)))
+		{
+			o_Message = "Invalid IDs in line " + to_string(line_number);
+			return false;
+		}
+		double value = 0.0;
+		while (linestream >> value) axis.Values.push_back(value);
+		if ((linestream.eof() == false) || (axis.Values.size() == 0))
+		{
+			o_Message = "Invalid values in line " + to_string(line_number);
+			return false;
+		}
+		o_Sweep.Axes.push_back(axis);
+	}
+
+	if (o_Sweep.BaseJobPath == "")
+	{
+		o_Message = "Missing BaseJob entry";
+		return false;
+	}
+	if (o_Sweep.Axes.size() == 0)
+	{
+		o_Message = "No sweep axis defined";
+		return false;
+	}
+	if ((o_Sweep.SharedLattice == true) && (any_of(o_Sweep.Axes.begin(), o_Sweep.Axes.end(), [](const TSweepAxis& axis) { return axis.Name == "Doping"; })))
+	{
+		o_Message = "SharedLattice cannot be combined with a Doping axis (dopand configuration depends on the doping)";
+		return false;
+	}
+	if (o_Sweep.OutputPrefix == "")
+	{
+		o_Sweep.OutputPrefix = ReplaceExtension(o_Sweep.BaseJobPath, "");
+	}
+	return true;
+}
+
+// Bezeichnung eines Achsenwertes fuer die Ausgabe (z.B. "CodeEnergy[0,3] = 0.25")
+string GetSweepLabel(const TSweepAxis& axis, double value)
+{
+	ostringstream label;
+	label << axis.Name;
+	if (axis.ID2 >= 0) label << "[" << axis.ID1 << "," << axis.ID2 << "]";
+	else if (axis.ID1 >= 0) label << "[" << axis.ID1 << "]";
+	label << " = " << value;
+	return label.str();
+}
+
+// Einen Punkt der Parameterstudie mit dem bereits geladenen Basis-Job simulieren (Rueckgabe = Exitcode, alle Ausgaben nach cout)
+// (das Sprungmodell bleibt erhalten, nur Energien und Einstellungen werden gesetzt und die Simulation neu initialisiert)
+// (SharedLattice != NULL: gemeinsames Startgitter aller Punkte verwenden)
+int RunSweepPoint(TKMCJob& KMCJob, const string& BaseSettings, shared_ptr<const vector<int>> SharedLattice, const vector<TSweepAxis>& Axes,
+	const vector<double>& Values, const string& JobPath, TJobStatus& o_Status, string& o_Message)
+{
+	int ErrorCode = KMCERR_OK;
+	o_Status = TJobStatus::Failed;
+	o_Message = "";
+
 	// Checkpoint-Dateipfad erstellen
-	string ChkPath = JobPath;
-	string::size_type ext_pos = ChkPath.rfind('.', ChkPath.length());
-	if (ext_pos != string::npos)
+	string ChkPath = ReplaceExtension(JobPath, KMCPATH_CHK_EXT);
+
+	// Status bei Abbruch: fortsetzbar, falls bereits ein Checkpoint existiert
+	auto Terminated = [&](const string& message)
 	{
-		ChkPath.erase(ext_pos);
+		error_code ec;
+		o_Status = (filesystem::exists(ChkPath, ec) == true) ? TJobStatus::Resumable : TJobStatus::Failed;
+		o_Message = message;
+		cout << "Program terminated." << endl;
+		return 1;
+	};
+
+	// Log-File-Header ausgeben
+	cout << "SIMULATION LOG" << endl;
+	cout << "iCon - Kinetic Monte-Carlo Simulation of Ionic Conductivity" << endl;
+	cout << "Copyright 2016-2025, P. Hein, Workgroup Martin, IPC, RWTH Aachen" << endl;
+	cout << "Distributed under GPL v3 license. Publication of results requires proper attribution." << endl;
+	cout << KMCOUT_VERSION << " " << KMC_VERSION << endl;
+	cout << "Start-Time: ";
+	TCustomTime StartTime = TCustomTime::GetCurrentTime(true);
+	cout << endl << endl;
+
+	cout << "Sweep point:" << endl;
+	for (int i = 0; i < (int)Axes.size(); i++)
+	{
+		cout << "  " << GetSweepLabel(Axes[i], Values[i]) << endl;
+	}
+	cout << endl;
+
+	// Bereits abgeschlossene Punkte ueberspringen (erneuter Aufruf setzt die Studie fort)
+	error_code ec;
+	if (filesystem::exists(JobPath, ec) == true)
+	{
+		TKMCJob SummaryJob;
+		bool IfCompleted = false;
+		if ((SummaryJob.IfReady() == true) && (SummaryJob.LoadSummaryFromFile(JobPath, IfCompleted) == KMCERR_OK) && (IfCompleted == true))
+		{
+			cout << "The simulation is already complete." << endl;
+			cout << "Program terminated." << endl;
+			o_Status = TJobStatus::Completed;
+			o_Message = "Already complete";
+			return 1;
+		}
 	}
-	ChkPath += KMCPATH_CHK_EXT;
+
+	// Energien setzen (loescht die Einstellungen, diese werden anschliessend aus dem Basis-Job wiederhergestellt)
+	cout << "Applying sweep parameters ..." << endl;
+	for (int i = 0; i < (int)Axes.size(); i++)
+	{
+		if (Axes[i].Name == "CodeEnergy")
+		{
+			ErrorCode = KMCJob.SetCodeEnergy(Axes[i].ID1, Axes[i].ID2, Values[i]);
+		}
+		else if (Axes[i].Name == "InteractionEnergy")
+		{
+			ErrorCode = KMCJob.SetInteractionEnergyByInteraction(Axes[i].ID1, Axes[i].ID2, Values[i]);
+		}
+		if (ErrorCode != KMCERR_OK)
+		{
+			return Terminated("Invalid " + GetSweepLabel(Axes[i], Values[i]) + " (" + to_string(ErrorCode) + ")");
+		}
+	}
+	ErrorCode = KMCJob.LoadSettingsFromString(BaseSettings);
+	if (ErrorCode != KMCERR_OK)
+	{
+		return Terminated("Restoring settings failed (" + to_string(ErrorCode) + ")");
+	}
+
+	// Einstellungen setzen (E-Feld-Richtung des Basis-Jobs bleibt erhalten)
+	for (int i = 0; i < (int)Axes.size(); i++)
+	{
+		if (Axes[i].Name == "Temperature")
+		{
+			ErrorCode = KMCJob.SetTemperature(Values[i]);
+		}
+		else if (Axes[i].Name == "EField")
+		{
+			double DirX = 0.0, DirY = 0.0, DirZ = 0.0, MaxEField = 0.0;
+			ErrorCode = KMCJob.GetEFieldSettings(DirX, DirY, DirZ, MaxEField);
+			if (ErrorCode == KMCERR_OK) ErrorCode = KMCJob.SetEField(DirX, DirY, DirZ, Values[i]);
+		}
+		else if (Axes[i].Name == "Doping")
+		{
+			ErrorCode = KMCJob.SetDopandConcentration(Axes[i].ID1, Values[i]);
+		}
+		if (ErrorCode != KMCERR_OK)
+		{
+			return Terminated("Invalid " + GetSweepLabel(Axes[i], Values[i]) + " (" + to_string(ErrorCode) + ")");
+		}
+	}
+	ErrorCode = KMCJob.MakeSettings();
+	if (ErrorCode != KMCERR_OK)
+	{
+		return Terminated("Invalid settings (" + to_string(ErrorCode) + ")");
+	}
+	cout << "Done." << endl;
+
+	// Simulation initialisieren (erstellt die Wahrscheinlichkeitstabellen fuer die Parameter dieses Punktes)
+	ErrorCode = KMCJob.InitializeSimulation();
+	if (ErrorCode != KMCERR_OK)
+	{
+		return Terminated("Simulation initialization failed (" + to_string(ErrorCode) + ")");
+	}
+	if (SharedLattice != NULL)
+	{
+		ErrorCode = KMCJob.SetSharedStartLattice(SharedLattice);
+		if (ErrorCode != KMCERR_OK)
+		{
+			return Terminated("Invalid shared start lattice (" + to_string(ErrorCode) + ")");
+		}
+	}
+	cout << endl;
 
 	// Checkpoint-Pfad setzen und Checkpoint laden
 	ErrorCode = KMCJob.SetCheckPointPath(ChkPath);
 	if (ErrorCode != KMCERR_OK)
 	{
-		cout << "Program terminated." << endl;
-		return 1;
+		return Terminated("Invalid checkpoint path (" + to_string(ErrorCode) + ")");
 	}
 	ErrorCode = KMCJob.LoadCheckPoint();
 	if (ErrorCode != KMCERR_OK)
 	{
-		cout << "Program terminated." << endl;
-		return 1;
+		return Terminated("Loading checkpoint failed (" + to_string(ErrorCode) + ")");
 	}
 
 	// Simulation durchfuehren
+	bool DynNormEntryMissing = false;
 	ErrorCode = KMCJob.MakeSimulation();
 	if (ErrorCode != KMCERR_OK)
 	{
 		if (ErrorCode == KMCERR_HAS_TO_SET_DYNNORM_ENTRY)
 		{
-
+			DynNormEntryMissing = true;
 		}
 		else
 		{
-			cout << "Program terminated." << endl;
-			return 1;
+			return Terminated("Simulation failed (" + to_string(ErrorCode) + ")");
 		}
 	}
 	cout << endl;
@@ -170,8 +719,7 @@ int main(int argc, char* argv[])
 	ErrorCode = KMCJob.SaveToFile(JobPath);
 	if (ErrorCode != KMCERR_OK)
 	{
-		cout << "Program terminated." << endl;
-		return 1;
+		return Terminated("Saving failed (" + to_string(ErrorCode) + ")");
 	}
 	cout << "Done." << endl << endl;
 
@@ -182,5 +730,663 @@ int main(int argc, char* argv[])
 	cout << "Total runtime: " << TotalRuntime.ToString() << endl;
 	cout << "Job completed successfully." << endl << endl;
 
+	if (DynNormEntryMissing == true)
+	{
+		o_Status = TJobStatus::Resumable;
+		o_Message = "DynNorm list entry has to be set";
+	}
+	else
+	{
+		o_Status = TJobStatus::Completed;
+	}
 	return 0;
 }
+
+// Parameterstudie durchfuehren (Basis-Job einmal laden, je Thread ein KMC-Job Objekt als Kopie im Speicher, Ausgaben je Punkt in eine eigene Log-Datei)
+int RunSweep(const filesystem::path& SweepPath, int ThreadCount, string CachePath)
+{
+	cout << "SWEEP LOG" << endl;
+	cout << "iCon - Kinetic Monte-Carlo Simulation of Ionic Conductivity" << endl;
+	cout << "Copyright 2016-2025, P. Hein, Workgroup Martin, IPC, RWTH Aachen" << endl;
+	cout << "Distributed under GPL v3 license. Publication of results requires proper attribution." << endl;
+	cout << KMCOUT_VERSION << " " << KMC_VERSION << endl;
+	cout << "Start-Time: ";
+	TCustomTime StartTime = TCustomTime::GetCurrentTime(true);
+	cout << endl << endl;
+
+	// Sweep-Datei einlesen
+	TSweepDefinition Sweep;
+	string Message = "";
+	try
+	{
+		if (ReadSweepDefinition(SweepPath, Sweep, Message) == false)
+		{
+			cout << "Error: Invalid sweep file " << SweepPath << ": " << Message << "." << endl;
+			cout << endl;
+			cout << "Program terminated." << endl;
+			return 1;
+		}
+		filesystem::path OutputDir = filesystem::path(Sweep.OutputPrefix).parent_path();
+		if (OutputDir.empty() == false) filesystem::create_directories(OutputDir);
+
+		// Ohne Cache-Verzeichnis das Ausgabeverzeichnis verwenden (Sprungmodell nur einmal erstellen)
+		if (CachePath == "") CachePath = (OutputDir.empty() == true) ? filesystem::current_path().string() : OutputDir.string();
+	}
+	catch (const exception& e)
+	{
+		cout << "Critical Error: Exception during sweep file processing:" << endl;
+		cout << e.what() << endl;
+		cout << endl;
+		cout << "Program terminated." << endl;
+		return 1;
+	}
+
+	// Punkte erstellen (kartesisches Produkt aller Achsen, letzte Achse laeuft am schnellsten)
+	size_t PointCount = 1;
+	for (const auto& Axis : Sweep.Axes) PointCount *= Axis.Values.size();
+	vector<vector<double>> PointValues(PointCount, vector<double>(Sweep.Axes.size(), 0.0));
+	for (size_t i = 0; i < PointCount; i++)
+	{
+		size_t index = i;
+		for (int j = (int)Sweep.Axes.size() - 1; j >= 0; j--)
+		{
+			PointValues[i][j] = Sweep.Axes[j].Values[index % Sweep.Axes[j].Values.size()];
+			index /= Sweep.Axes[j].Values.size();
+		}
+	}
+	int IndexWidth = (int)to_string(PointCount).length();
+
+	// Basis-Job laden und pruefen (fuellt den Sprungmodell-Cache fuer die Threads), als String fuer die Threads speichern
+	// und ggf. das gemeinsame Startgitter erzeugen (wird von allen Threads nur gelesen)
+	string BaseJobStr = "";
+	string BaseSettings = "";
+	shared_ptr<const vector<int>> SharedLattice;
+	{
+		TKMCJob BaseJob;
+		if (BaseJob.IfReady() == false)
+		{
+			cout << "Critical Error: Job object creation failed." << endl;
+			cout << "Contact the developers!" << endl;
+			cout << endl;
+			cout << "Program terminated." << endl;
+			return 1;
+		}
+		cout << "Base job: " << Sweep.BaseJobPath << endl;
+		cout << "Jump model cache: " << CachePath << endl;
+		cout << "Loading base job ..." << endl;
+		int ErrorCode = BaseJob.SetModelCachePath(CachePath);
+		if (ErrorCode == KMCERR_OK) ErrorCode = BaseJob.LoadFromFile(Sweep.BaseJobPath);
+		int JobStatus = 0;
+		if (ErrorCode == KMCERR_OK) ErrorCode = BaseJob.GetProjectState(JobStatus);
+		if ((ErrorCode == KMCERR_OK) && (JobStatus < 6))
+		{
+			cout << "Error: The base job configuration is incomplete." << endl;
+			cout << "Cannot start simulation due to missing settings." << endl;
+			cout << endl;
+			ErrorCode = KMCERR_OBJECT_NOT_READY;
+		}
+		if (ErrorCode == KMCERR_OK) ErrorCode = BaseJob.SaveToString(BaseJobStr);
+		if (ErrorCode == KMCERR_OK) ErrorCode = BaseJob.SaveSettingsToString(BaseSettings);
+		if ((ErrorCode == KMCERR_OK) && (Sweep.SharedLattice == true))
+		{
+			cout << "Creating shared start lattice ..." << endl;
+			ErrorCode = BaseJob.InitializeSimulation();
+			if (ErrorCode == KMCERR_OK) ErrorCode = BaseJob.CreateSharedStartLattice(SharedLattice);
+		}
+		if (ErrorCode != KMCERR_OK)
+		{
+			cout << "Program terminated." << endl;
+			return 1;
+		}
+		cout << "Done." << endl << endl;
+	}
+
+	// Threadanzahl festlegen (Parallelisierung innerhalb der Punkte auf die verbleibenden Hardware-Threads begrenzen)
+	int HardwareThreads = TParallel::GetThreadCount();
+	if (ThreadCount <= 0) ThreadCount = HardwareThreads;
+	if (ThreadCount > (int)PointCount) ThreadCount = (int)PointCount;
+	TParallel::SetMaxThreadCount(max(1, HardwareThreads / ThreadCount));
+	cout << "Number of points: " << PointCount << endl;
+	cout << "Number of threads: " << ThreadCount << endl;
+	cout << endl;
+
+	// Punkte ueber gemeinsamen Zaehler auf die Threads verteilen (Basis-Job je Thread nur einmal aus dem Speicher laden)
+	vector<TBatchJob> Points(PointCount);
+	atomic<int> next_point(0);
+	{
+		TThreadLogBuf CoutRedirect(cout);
+		TParallel::For(ThreadCount, [&](int)
+			{
+				// Kopie des Basis-Jobs aus dem Speicher laden (kein erneutes Lesen der Datei, das Sprungmodell kommt aus dem Cache,
+				// Ausgaben verwerfen, Fehler wurden bereits beim Basis-Job ausgegeben)
+				TKMCJob KMCJob;
+				ostringstream loadlog;
+				TThreadLogBuf::SetThreadTarget(loadlog.rdbuf());
+				bool IfLoaded = KMCJob.IfReady();
+				if (IfLoaded == true) IfLoaded = (KMCJob.SetModelCachePath(CachePath) == KMCERR_OK);
+				if (IfLoaded == true) IfLoaded = (KMCJob.LoadFromString(BaseJobStr) == KMCERR_OK);
+				TThreadLogBuf::SetThreadTarget(NULL);
+
+				int i = 0;
+				while ((i = next_point.fetch_add(1)) < (int)Points.size())
+				{
+					TBatchJob& Point = Points[i];
+					ostringstream pointname;
+					pointname << Sweep.OutputPrefix << "_" << setfill('0') << setw(IndexWidth) << i + 1 << ".kmc";
+					Point.JobPath = pointname.str();
+					string LogPath = ReplaceExtension(Point.JobPath, KMCPATH_LOG_EXT);
+
+					ostringstream startline;
+					startline << "Started  [" << i + 1 << "/" << Points.size() << "]: " << Point.JobPath << " (";
+					for (int j = 0; j < (int)Sweep.Axes.size(); j++)
+					{
+						if (j != 0) startline << ", ";
+						startline << GetSweepLabel(Sweep.Axes[j], PointValues[i][j]);
+					}
+					startline << ")" << endl;
+					cout << startline.str() << flush;
+
+					TCustomTime PointStart = TCustomTime::GetCurrentTime(false);
+					ofstream logfile(LogPath, ios::app);
+					if (IfLoaded == false)
+					{
+						Point.Status = TJobStatus::Failed;
+						Point.Message = "Copying base job failed";
+					}
+					else if (logfile.is_open() == false)
+					{
+						Point.Status = TJobStatus::Failed;
+						Point.Message = "Cannot open log file " + LogPath;
+					}
+					else
+					{
+						TThreadLogBuf::SetThreadTarget(logfile.rdbuf());
+						RunSweepPoint(KMCJob, BaseSettings, SharedLattice, Sweep.Axes, PointValues[i], Point.JobPath, Point.Status, Point.Message);
+						cout.flush();
+						TThreadLogBuf::SetThreadTarget(NULL);
+					}
+					Point.Runtime = TCustomTime::GetCurrentTime(false) - PointStart;
+
+					ostringstream endline;
+					endline << "Finished [" << i + 1 << "/" << Points.size() << "]: " << Point.JobPath << " -> ";
+					endline << ((Point.Status == TJobStatus::Completed) ? "completed" : ((Point.Status == TJobStatus::Resumable) ? "resumable" : "failed"));
+					if (Point.Message != "") endline << " (" << Point.Message << ")";
+					endline << endl;
+					cout << endline.str() << flush;
+				}
+				return KMCERR_OK;
+			}, ThreadCount);
+	}
+	TParallel::SetMaxThreadCount(0);
+
+	// Statustabelle ausgeben
+	int ExitCode = WriteBatchSummary("Sweep", Points);
+
+	cout << "End-Time: ";
+	TCustomTime EndTime = TCustomTime::GetCurrentTime(true);
+	cout << endl;
+	TCustomTime TotalRuntime = EndTime - StartTime;
+	cout << "Total runtime: " << TotalRuntime.ToString() << endl;
+
+	return ExitCode;
+}
+
+// Lock-Dateien der laufenden Jobs eines Worker-Prozesses regelmaessig aktualisieren (Lebenszeichen fuer andere Worker)
+class TWorkerHeartbeat
+{
+	// Member variables
+protected:
+	mutex LockMutex;						// Schutz von LockPaths und StopRequested
+	condition_variable StopCondition;		// Beenden des Heartbeat-Threads
+	bool StopRequested = false;				// Flag, ob der Heartbeat-Thread beendet werden soll
+	unordered_set<string> LockPaths;		// Lock-Dateien der laufenden Jobs
+	thread HeartbeatThread;					// Thread fuer die Aktualisierung (zuletzt initialisieren)
+
+	// Member functions
+public:
+	// Constructor, startet den Heartbeat-Thread
+	TWorkerHeartbeat() : HeartbeatThread(&TWorkerHeartbeat::Run, this)
+	{
+	}
+
+	// Destructor, beendet den Heartbeat-Thread
+	~TWorkerHeartbeat()
+	{
+		{
+			lock_guard<mutex> lock(LockMutex);
+			StopRequested = true;
+		}
+		StopCondition.notify_all();
+		HeartbeatThread.join();
+	}
+
+	// Lock-Datei hinzufuegen
+	void Add(const string& i_LockPath)
+	{
+		lock_guard<mutex> lock(LockMutex);
+		LockPaths.insert(i_LockPath);
+	}
+
+	// Lock-Datei entfernen
+	void Remove(const string& i_LockPath)
+	{
+		lock_guard<mutex> lock(LockMutex);
+		LockPaths.erase(i_LockPath);
+	}
+
+protected:
+	// Aenderungszeit aller Lock-Dateien im Abstand von KMCVAR_WORKER_HEARTBEATINTERVAL aktualisieren
+	void Run()
+	{
+		unique_lock<mutex> lock(LockMutex);
+		while (StopCondition.wait_for(lock, chrono::seconds(KMCVAR_WORKER_HEARTBEATINTERVAL), [this] { return StopRequested; }) == false)
+		{
+			for (const auto& lockpath : LockPaths)
+			{
+				error_code ec;
+				filesystem::last_write_time(lockpath, filesystem::file_time_type::clock::now(), ec);
+			}
+		}
+	}
+};
+
+// Datei umbenennen, falls vorhanden (Rueckgabe = Erfolg)
+bool MoveIfExists(const filesystem::path& from, const filesystem::path& to)
+{
+	error_code ec;
+	filesystem::rename(from, to, ec);
+	return !ec;
+}
+
+// Naechsten Job der Warteschlange beanspruchen (exklusives Anlegen der Lock-Datei und anschliessend Umbenennen nach running/,
+// bei gleichzeitigem Zugriff mehrerer Worker ist nur einer erfolgreich), Checkpoint und Log eines erneut eingereihten Jobs werden mitgenommen
+bool ClaimQueueJob(const filesystem::path& QueueDir, const string& WorkerName, filesystem::path& o_JobPath)
+{
+	vector<filesystem::path> candidates;
+	for (const auto& file : filesystem::directory_iterator(QueueDir))
+	{
+		if ((file.is_regular_file() == true) && (file.path().extension() == ".kmc"))
+		{
+			candidates.push_back(file.path());
+		}
+	}
+	sort(candidates.begin(), candidates.end());
+
+	filesystem::path RunningDir = QueueDir / KMCPATH_QUEUE_RUNNING;
+	for (const auto& jobpath : candidates)
+	{
+		filesystem::path target = RunningDir / jobpath.filename();
+
+		// Lock-Datei vor dem Verschieben exklusiv anlegen (Inhalt nur zur Information, massgeblich ist die Aenderungszeit),
+		// endet der Worker dazwischen, bleibt der Job in der Warteschlange und RequeueStaleJobs entfernt die veraltete Lock-Datei
+		filesystem::path lockpath = ReplaceExtension(target.string(), KMCPATH_LOCK_EXT);
+		FILE* lockfile = fopen(lockpath.string().c_str(), "wx");
+		if (lockfile == NULL) continue;
+		string lockline = WorkerName + " " + TCustomTime::GetCurrentTimeStr() + "\n";
+		fputs(lockline.c_str(), lockfile);
+		fclose(lockfile);
+		if (MoveIfExists(jobpath, target) == false)
+		{
+			error_code ec;
+			filesystem::remove(lockpath, ec);
+			continue;
+		}
+
+		MoveIfExists(ReplaceExtension(jobpath.string(), KMCPATH_CHK_EXT), ReplaceExtension(target.string(), KMCPATH_CHK_EXT));
+		MoveIfExists(ReplaceExtension(jobpath.string(), KMCPATH_LOG_EXT), ReplaceExtension(target.string(), KMCPATH_LOG_EXT));
+		MoveIfExists(ReplaceExtension(jobpath.string(), KMCPATH_OBS_EXT), ReplaceExtension(target.string(), KMCPATH_OBS_EXT));
+		MoveIfExists(ReplaceExtension(jobpath.string(), KMCPATH_TRJ_EXT), ReplaceExtension(target.string(), KMCPATH_TRJ_EXT));
+		o_JobPath = target;
+		return true;
+	}
+	return false;
+}
+
+// Jobs beendeter Worker (Lock-Datei aelter als KMCVAR_WORKER_STALETIMEOUT, z.B. nach Erreichen des Walltime-Limits)
+// mit ihrem Checkpoint erneut einreihen (Rueckgabe = Anzahl erneut eingereihter Jobs)
+// (liegt der Job noch in der Warteschlange, d.h. der Worker endete zwischen Lock-Datei und Umbenennen, wird nur die Lock-Datei entfernt)
+int RequeueStaleJobs(const filesystem::path& QueueDir)
+{
+	vector<filesystem::path> stale;
+	auto now = filesystem::file_time_type::clock::now();
+	for (const auto& file : filesystem::directory_iterator(QueueDir / KMCPATH_QUEUE_RUNNING))
+	{
+		if ((file.is_regular_file() == false) || (file.path().extension() != KMCPATH_LOCK_EXT)) continue;
+		error_code ec;
+		auto lasttime = filesystem::last_write_time(file.path(), ec);
+		if ((!ec) && (now - lasttime > chrono::seconds(KMCVAR_WORKER_STALETIMEOUT))) stale.push_back(file.path());
+	}
+
+	int RequeueCount = 0;
+	for (const auto& lockpath : stale)
+	{
+		// Lock-Datei atomar umbenennen, damit nur ein Worker den Job zurueckstellt
+		filesystem::path claimed = lockpath;
+		claimed += ".requeue";
+		if (MoveIfExists(lockpath, claimed) == false) continue;
+
+		// Checkpoint, Log, Observablen und Trajektorie vor der Job-Datei verschieben (ein neuer Worker findet den Job nur mit Checkpoint)
+		filesystem::path jobpath = ReplaceExtension(lockpath.string(), ".kmc");
+		filesystem::path target = QueueDir / jobpath.filename();
+		MoveIfExists(ReplaceExtension(jobpath.string(), KMCPATH_CHK_EXT), ReplaceExtension(target.string(), KMCPATH_CHK_EXT));
+		MoveIfExists(ReplaceExtension(jobpath.string(), KMCPATH_LOG_EXT), ReplaceExtension(target.string(), KMCPATH_LOG_EXT));
+		MoveIfExists(ReplaceExtension(jobpath.string(), KMCPATH_OBS_EXT), ReplaceExtension(target.string(), KMCPATH_OBS_EXT));
+		MoveIfExists(ReplaceExtension(jobpath.string(), KMCPATH_TRJ_EXT), ReplaceExtension(target.string(), KMCPATH_TRJ_EXT));
+		if (MoveIfExists(jobpath, target) == true)
+		{
+			ostringstream requeueline;
+			requeueline << "Requeued stale job: " << target.string() << endl;
+			cout << requeueline.str() << flush;
+			RequeueCount++;
+		}
+		error_code ec;
+		filesystem::remove(claimed, ec);
+	}
+	return RequeueCount;
+}
+
+// Jobs aus einer Warteschlange auf einem gemeinsamen Dateisystem abarbeiten (mehrere Worker-Prozesse auf mehreren Knoten moeglich):
+// *.kmc-Dateien im Warteschlangen-Verzeichnis werden nach running/ verschoben, simuliert und danach mit Log und Checkpoint nach
+// done/ bzw. failed/ verschoben, jeder Thread wird nach IdleTimeout Sekunden ohne neuen Job beendet
+int RunWorker(const filesystem::path& QueueDir, int ThreadCount, int IdleTimeout, const string& CachePath)
+{
+	cout << "WORKER LOG" << endl;
+	cout << "iCon - Kinetic Monte-Carlo Simulation of Ionic Conductivity" << endl;
+	cout << "Copyright 2016-2025, P. Hein, Workgroup Martin, IPC, RWTH Aachen" << endl;
+	cout << "Distributed under GPL v3 license. Publication of results requires proper attribution." << endl;
+	cout << KMCOUT_VERSION << " " << KMC_VERSION << endl;
+	cout << "Start-Time: ";
+	TCustomTime StartTime = TCustomTime::GetCurrentTime(true);
+	cout << endl << endl;
+
+	// Unterverzeichnisse der Warteschlange erstellen
+	try
+	{
+		if (filesystem::is_directory(QueueDir) == false)
+		{
+			cout << "Error: Specified queue directory does not exist (" << QueueDir << ")." << endl;
+			cout << endl;
+			cout << "Program terminated." << endl;
+			return 1;
+		}
+		filesystem::create_directories(QueueDir / KMCPATH_QUEUE_RUNNING);
+		filesystem::create_directories(QueueDir / KMCPATH_QUEUE_DONE);
+		filesystem::create_directories(QueueDir / KMCPATH_QUEUE_FAILED);
+	}
+	catch (const exception& e)
+	{
+		cout << "Critical Error: Exception during queue preparation:" << endl;
+		cout << e.what() << endl;
+		cout << endl;
+		cout << "Program terminated." << endl;
+		return 1;
+	}
+
+	// Worker-Name fuer die Lock-Dateien (Rechnername)
+	string WorkerName = "unknown";
+	if (getenv("HOSTNAME") != NULL) WorkerName = getenv("HOSTNAME");
+	else if (getenv("COMPUTERNAME") != NULL) WorkerName = getenv("COMPUTERNAME");
+
+	// Threadanzahl festlegen (Parallelisierung innerhalb der Jobs auf die verbleibenden Hardware-Threads begrenzen)
+	int HardwareThreads = TParallel::GetThreadCount();
+	if (ThreadCount <= 0) ThreadCount = HardwareThreads;
+	TParallel::SetMaxThreadCount(max(1, HardwareThreads / ThreadCount));
+	cout << "Queue directory: " << QueueDir.string() << endl;
+	cout << "Worker: " << WorkerName << endl;
+	cout << "Number of threads: " << ThreadCount << endl;
+	cout << "Idle timeout: " << IdleTimeout << " s" << endl;
+	if (CachePath != "") cout << "Jump model cache: " << CachePath << endl;
+	cout << endl;
+
+	// Jobs abarbeiten, bis jeder Thread IdleTimeout Sekunden keinen neuen Job gefunden hat
+	vector<TBatchJob> Jobs;
+	mutex JobsMutex;
+	atomic<int> RequeueCount(0);
+	{
+		TThreadLogBuf CoutRedirect(cout);
+		TWorkerHeartbeat Heartbeat;
+		TParallel::For(ThreadCount, [&](int)
+			{
+				auto LastActivity = chrono::steady_clock::now();
+				while (true)
+				{
+					TBatchJob Job;
+					try
+					{
+						RequeueCount += RequeueStaleJobs(QueueDir);
+						filesystem::path JobPath;
+						if (ClaimQueueJob(QueueDir, WorkerName, JobPath) == false)
+						{
+							auto IdleTime = chrono::steady_clock::now() - LastActivity;
+							if (IdleTime >= chrono::seconds(IdleTimeout)) break;
+							this_thread::sleep_for(min<chrono::steady_clock::duration>(chrono::seconds(KMCVAR_WORKER_POLLINTERVAL),
+								chrono::seconds(IdleTimeout) - IdleTime));
+							continue;
+						}
+						Job.JobPath = JobPath.string();
+					}
+					catch (const exception& e)
+					{
+						ostringstream errorline;
+						errorline << "Critical Error: Exception during queue access:" << endl << e.what() << endl;
+						cout << errorline.str() << flush;
+						break;
+					}
+
+					string LockPath = ReplaceExtension(Job.JobPath, KMCPATH_LOCK_EXT);
+					string LogPath = ReplaceExtension(Job.JobPath, KMCPATH_LOG_EXT);
+					Heartbeat.Add(LockPath);
+
+					ostringstream startline;
+					startline << "Started:  " << Job.JobPath << endl;
+					cout << startline.str() << flush;
+
+					TCustomTime JobStart = TCustomTime::GetCurrentTime(false);
+					{
+						ofstream logfile(LogPath, ios::app);
+						if (logfile.is_open() == false)
+						{
+							Job.Status = TJobStatus::Failed;
+							Job.Message = "Cannot open log file " + LogPath;
+						}
+						else
+						{
+							TThreadLogBuf::SetThreadTarget(logfile.rdbuf());
+							RunJob(Job.JobPath, CachePath, Job.Status, Job.Message);
+							cout.flush();
+							TThreadLogBuf::SetThreadTarget(NULL);
+						}
+					}
+					Job.Runtime = TCustomTime::GetCurrentTime(false) - JobStart;
+
+					// Job mit Log, Checkpoint, Observablen und Trajektorie nach done/ bzw. failed/ verschieben, danach Lock-Datei entfernen
+					filesystem::path TargetDir = QueueDir / ((Job.Status == TJobStatus::Completed) ? KMCPATH_QUEUE_DONE : KMCPATH_QUEUE_FAILED);
+					filesystem::path TargetPath = TargetDir / filesystem::path(Job.JobPath).filename();
+					MoveIfExists(ReplaceExtension(Job.JobPath, KMCPATH_CHK_EXT), ReplaceExtension(TargetPath.string(), KMCPATH_CHK_EXT));
+					MoveIfExists(LogPath, ReplaceExtension(TargetPath.string(), KMCPATH_LOG_EXT));
+					MoveIfExists(ReplaceExtension(Job.JobPath, KMCPATH_OBS_EXT), ReplaceExtension(TargetPath.string(), KMCPATH_OBS_EXT));
+					MoveIfExists(ReplaceExtension(Job.JobPath, KMCPATH_TRJ_EXT), ReplaceExtension(TargetPath.string(), KMCPATH_TRJ_EXT));
+					MoveIfExists(Job.JobPath, TargetPath);
+					Heartbeat.Remove(LockPath);
+					error_code ec;
+					filesystem::remove(LockPath, ec);
+					Job.JobPath = TargetPath.string();
+
+					ostringstream endline;
+					endline << "Finished: " << Job.JobPath << " -> ";
+					endline << ((Job.Status == TJobStatus::Completed) ? "completed" : ((Job.Status == TJobStatus::Resumable) ? "resumable" : "failed"));
+					if (Job.Message != "") endline << " (" << Job.Message << ")";
+					endline << endl;
+					cout << endline.str() << flush;
+
+					{
+						lock_guard<mutex> lock(JobsMutex);
+						Jobs.push_back(Job);
+					}
+					LastActivity = chrono::steady_clock::now();
+				}
+				return KMCERR_OK;
+			}, ThreadCount);
+	}
+	TParallel::SetMaxThreadCount(0);
+
+	// Statustabelle ausgeben
+	cout << endl;
+	cout << "Requeued stale jobs: " << RequeueCount << endl;
+	int ExitCode = WriteBatchSummary("Worker", Jobs);
+
+	cout << "End-Time: ";
+	TCustomTime EndTime = TCustomTime::GetCurrentTime(true);
+	cout << endl;
+	TCustomTime TotalRuntime = EndTime - StartTime;
+	cout << "Total runtime: " << TotalRuntime.ToString() << endl;
+
+	return ExitCode;
+}
+
+int main(int argc, char* argv[])
+{
+
+	// Telemetrie-Option (vor allen uebrigen Argumenten): -telemetry <Datei oder Named Pipe>
+	// (wird fuer die weitere Verarbeitung aus den Argumenten entfernt, Telemetrie endet mit dem Programm)
+	struct TTelemetryGuard
+	{
+		~TTelemetryGuard() { TSimTelemetry::Stop(); }
+	} TelemetryGuard;
+	if ((argc >= 3) && (Trim(argv[1]) == "-telemetry"))
+	{
+		if (TSimTelemetry::Start(std::string(Trim(argv[2])), KMCVAR_TELEMETRY_INTERVAL) != KMCERR_OK) return 1;
+		argv[2] = argv[0];
+		argc -= 2;
+		argv += 2;
+	}
+
+	// Kommandozeilenargumente verarbeiten (argv[0] = Programmpfad, argv[1] = Argument, argv[2] = optionales Cache-Verzeichnis)
+	// (Batch- bzw. Sweep-Modus: argv[1] = -batch bzw. -sweep, argv[2] = Job-Liste oder Verzeichnis bzw. Sweep-Datei,
+	// argv[3] = optionale Threadanzahl, argv[4] = optionales Cache-Verzeichnis)
+	if ((argc >= 3) && ((Trim(argv[1]) == "-batch") || (Trim(argv[1]) == "-sweep")))
+	{
+		if (argc > 5)
+		{
+			cout << "Error: Invalid number of command line arguments. Use -help or -h for further information." << endl;
+			return 1;
+		}
+		int ThreadCount = 0;
+		if (argc >= 4)
+		{
+			try
+			{
+				ThreadCount = stoi(std::string(Trim(argv[3])));
+			}
+			catch (const exception&)
+			{
+				ThreadCount = -1;
+			}
+			if (ThreadCount < 0)
+			{
+				cout << "Error: Invalid thread count (" << Trim(argv[3]) << ")." << endl;
+				return 1;
+			}
+		}
+		string CachePath = "";
+		if (argc == 5) CachePath = std::string(Trim(argv[4]));
+		if (Trim(argv[1]) == "-sweep") return RunSweep(filesystem::path(std::string(Trim(argv[2]))), ThreadCount, CachePath);
+		return RunBatch(filesystem::path(std::string(Trim(argv[2]))), ThreadCount, CachePath);
+	}
+	// (Worker-Modus: argv[1] = -worker, argv[2] = Warteschlangen-Verzeichnis, argv[3] = optionale Threadanzahl,
+	// argv[4] = optionale Wartezeit [s] ohne neuen Job, argv[5] = optionales Cache-Verzeichnis)
+	if ((argc >= 3) && (Trim(argv[1]) == "-worker"))
+	{
+		if (argc > 6)
+		{
+			cout << "Error: Invalid number of command line arguments. Use -help or -h for further information." << endl;
+			return 1;
+		}
+		int ThreadCount = 0;
+		int IdleTimeout = KMCVAR_WORKER_IDLETIMEOUT_INIT;
+		for (int i = 3; (i < argc) && (i <= 4); i++)
+		{
+			int Value = -1;
+			try
+			{
+				Value = stoi(std::string(Trim(argv[i])));
+			}
+			catch (const exception&)
+			{
+				Value = -1;
+			}
+			if (Value < 0)
+			{
+				cout << "Error: Invalid " << ((i == 3) ? "thread count" : "idle timeout") << " (" << Trim(argv[i]) << ")." << endl;
+				return 1;
+			}
+			if (i == 3) ThreadCount = Value;
+			else IdleTimeout = Value;
+		}
+		string CachePath = "";
+		if (argc == 6) CachePath = std::string(Trim(argv[5]));
+		return RunWorker(filesystem::path(std::string(Trim(argv[2]))), ThreadCount, IdleTimeout, CachePath);
+	}
+	if ((argc != 2) && (argc != 3))
+	{
+		cout << "Error: Invalid number of command line arguments. Use -help or -h for further information." << endl;
+		return 1;
+	}
+	string_view CmdArg = Trim(argv[1]);
+	if ((CmdArg == "-help") || (CmdArg == "-h"))
+	{
+		cout << "iCon - Kinetic Monte-Carlo Simulation of Ionic Conductivity" << endl;
+		cout << "Copyright 2016-2025, P. Hein, Workgroup Martin, IPC, RWTH Aachen" << endl;
+		cout << "Distributed under GPL v3 license. Publication of results requires proper attribution." << endl;
+		cout << KMCOUT_VERSION << " " << KMC_VERSION << endl;
+		cout << endl;
+		cout << "Available command line arguments:" << endl;
+		cout << "-help / -h: Show this help text." << endl;
+		cout << "-version: Show plain version number." << endl;
+		cout << "<file path>: Path of the job file (*.kmc) that should be processed." << endl;
+		cout << "<file path> <cache directory>: Same as above, but reuse the jump model (code enumeration) from" << endl;
+		cout << "    the cache directory if a job with identical structure and jump settings was processed before." << endl;
+		cout << "-batch <list file or directory> [<thread count>] [<cache directory>]: Process several jobs concurrently." << endl;
+		cout << "    The list file contains one job file path per line (relative to the list file, # = comment)," << endl;
+		cout << "    for a directory all *.kmc files including sub-directories are processed. Each job writes its" << endl;
+		cout << "    log to <job name>" << KMCPATH_LOG_EXT << " next to the job file. Thread count 0 or omitted = all hardware threads." << endl;
+		cout << "-sweep <sweep file> [<thread count>] [<cache directory>]: Parameter sweep of a base job. The sweep file contains" << endl;
+		cout << "    one keyword per line (# = comment, paths relative to the sweep file):" << endl;
+		cout << "      BaseJob: <job file>               Completely configured job that is used for all points" << endl;
+		cout << "      Output: <path prefix>             Points are saved to <path prefix>_<index>.kmc (default: base job path)" << endl;
+		cout << "      SharedLattice: <yes/no>           All points start from the same random dopand configuration" << endl;
+		cout << "                                        (correlated sampling, e.g. for Arrhenius plots, not with Doping axis)" << endl;
+		cout << "      Temperature: <values>             Temperatures [K]" << endl;
+		cout << "      EField: <values>                  Maximum E-field contributions [kT] (direction of the base job)" << endl;
+		cout << "      Doping: <DopingID> <values>       Dopand concentrations" << endl;
+		cout << "      CodeEnergy: <JumpID> <CodeID> <values>           Code energies [eV]" << endl;
+		cout << "      InteractionEnergy: <WWID> <ID> <values>          Interaction energies [eV]" << endl;
+		cout << "    All combinations of the axis values are simulated. The base job is read once, each thread works on an" << endl;
+		cout << "    in-memory copy. The jump model is built once and cached in the cache directory (default: output directory)," << endl;
+		cout << "    the copies load it from there and only the probability tables are rebuilt per point." << endl;
+		cout << "    Completed points are skipped, so an interrupted sweep is continued by calling it again." << endl;
+		cout << "-worker <queue directory> [<thread count>] [<idle timeout>] [<cache directory>]: Process the *.kmc files of a" << endl;
+		cout << "    queue directory on a shared filesystem, several workers on several nodes can share one queue. Jobs are" << endl;
+		cout << "    claimed by moving them to " << KMCPATH_QUEUE_RUNNING << "/ and afterwards moved with log and checkpoint to " << KMCPATH_QUEUE_DONE << "/ or " << KMCPATH_QUEUE_FAILED << "/." << endl;
+		cout << "    Jobs of workers that stopped (e.g. at the wall-time limit) are re-queued with their checkpoint after" << endl;
+		cout << "    " << KMCVAR_WORKER_STALETIMEOUT << " s. The worker exits after <idle timeout> seconds without new job (default: " << KMCVAR_WORKER_IDLETIMEOUT_INIT << " s)." << endl;
+		cout << "-telemetry <file or named pipe> <any of the above>: Additionally append machine-readable progress of all running" << endl;
+		cout << "    simulations as JSON lines (phase, MCSP, attempts/s, acceptance ratio, counters, ETA, RSS, checkpoint duration)" << endl;
+		cout << "    every " << KMCVAR_TELEMETRY_INTERVAL / 1000 << " s and at the start and end of each simulation phase." << endl;
+		cout << "    A named pipe has to be opened by its reader first. Lines are dropped while the reader lags behind," << endl;
+		cout << "    telemetry is disabled (the simulations continue) if the reader closes the pipe or writing fails." << endl;
+		return 0;
+	}
+	if (CmdArg == "-version")
+	{
+		cout << KMC_VERSION << endl;
+		return 0;
+	}
+	string JobPath = std::string(CmdArg);
+	string CachePath = "";
+	if (argc == 3) CachePath = std::string(Trim(argv[2]));
+
+	TJobStatus Status = TJobStatus::Failed;
+	string Message = "";
+	return RunJob(JobPath, CachePath, Status, Message);
+}